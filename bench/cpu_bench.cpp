@@ -0,0 +1,159 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+/// \file cpu_bench.cpp
+/// \author FilipeCN (filipedecn@gmail.com)
+/// \date 2026-10-19
+///
+/// \brief
+
+
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <circe/colors/color_palette.h>
+#include <circe/common/job_system.h>
+#include <circe/gl/utils/scene_snapshot.h>
+#include <circe/io/io.h>
+#include <circe/scene/shapes.h>
+#include <circe/ui/imgui_logger.h>
+#include <thread>
+
+using namespace circe;
+
+// CPU side benchmarks. They do not need any graphics context:
+//    circe_bench "[cpu]" -r json -o cpu.json
+
+TEST_CASE("OBJ loading", "[cpu]") {
+  hermes::Path assets_path(std::string(ASSETS_PATH));
+  for (const auto *name : {"suzanne.obj", "teapot.obj", "torusknot.obj"}) {
+    auto path = assets_path / name;
+    BENCHMARK(name) {
+      return io::readOBJ(path, shape_options::normal | shape_options::uv);
+    };
+  }
+}
+
+TEST_CASE("Shapes generators", "[cpu]") {
+  BENCHMARK("icosphere 5 divisions") {
+    return Shapes::icosphere(5, shape_options::normal | shape_options::uv);
+  };
+  BENCHMARK("box") {
+    return Shapes::box(hermes::bbox3::unitBox(), shape_options::normal | shape_options::uv);
+  };
+  BENCHMARK("plane 256x256") {
+    return Shapes::plane(hermes::Plane::XY(), {}, {1, 0, 0}, {1, 1}, {256, 256},
+                         shape_options::normal | shape_options::uv);
+  };
+}
+
+TEST_CASE("Shapes::convert", "[cpu]") {
+  auto sphere = Shapes::icosphere(5, shape_options::normal | shape_options::uv);
+  BENCHMARK("unique positions") {
+    return Shapes::convert(sphere, shape_options::unique_positions);
+  };
+  BENCHMARK("wireframe") {
+    return Shapes::convert(sphere, shape_options::wireframe);
+  };
+}
+
+TEST_CASE("Model copy and move", "[cpu]") {
+  auto sphere = Shapes::icosphere(5, shape_options::normal | shape_options::uv);
+  BENCHMARK("copy") {
+    Model copy;
+    copy = sphere;
+    return copy;
+  };
+  BENCHMARK_ADVANCED("move")(Catch::Benchmark::Chronometer meter) {
+    std::vector<Model> models(meter.runs());
+    for (auto &model : models)
+      model = sphere;
+    std::vector<Model> moved(meter.runs());
+    meter.measure([&](int i) { moved[i] = std::move(models[i]); });
+  };
+}
+
+TEST_CASE("ColorPalette batch mapping", "[cpu]") {
+  auto palette = ColorPalettes::Batlow();
+  std::vector<f32> values(1 << 22);
+  for (size_t i = 0; i < values.size(); ++i)
+    values[i] = static_cast<f32>((i * 7919) % values.size());
+  std::vector<Color> colors(values.size());
+  const f32 scale = 1.f / values.size();
+  BENCHMARK("operator() 4M values") {
+    for (size_t i = 0; i < values.size(); ++i)
+      colors[i] = palette(values[i] * scale);
+    return colors.back().r;
+  };
+  BENCHMARK("map 4M values") {
+    palette.map(values.data(), values.size(), colors.data(), 0.f, values.size());
+    return colors.back().r;
+  };
+  JobSystem jobs;
+  BENCHMARK("map 4M values " + std::to_string(jobs.workerCount()) + " threads") {
+    palette.map(values.data(), values.size(), colors.data(), 0.f, values.size(), -1, &jobs);
+    return colors.back().r;
+  };
+}
+
+TEST_CASE("HLogger concurrent producers", "[cpu]") {
+  HLogger logger(1 << 16);
+  auto message = hermes::Str() << "loading chunk 42 of 1024 from disk";
+  for (u32 thread_count : {1u, 4u}) {
+    BENCHMARK(std::to_string(thread_count) + " threads x 10000 messages") {
+      std::vector<std::thread> threads;
+      for (u32 t = 0; t < thread_count; ++t)
+        threads.emplace_back([&]() {
+          for (int i = 0; i < 10000; ++i)
+            logger.logMessage(message, hermes::logging_options::info);
+        });
+      for (auto &thread : threads)
+        thread.join();
+      return logger.droppedCount();
+    };
+  }
+}
+
+TEST_CASE("SnapshotMailbox step", "[cpu]") {
+  // 1M instances of 64 bytes, 1% of them change per step
+  const u64 instance_count = 1 << 20;
+  const u64 instance_size = 64;
+  gl::SnapshotMailbox mailbox;
+  u64 first = 0;
+  auto step = [&]() {
+    auto &snapshot = mailbox.beginWrite();
+    snapshot.resizeBuffer(0, instance_count * instance_size);
+    auto *data = snapshot.map<u8>(0, first * instance_size, instance_count / 100 * instance_size);
+    data[0]++;
+    first = (first + instance_count / 100) % (instance_count - instance_count / 100);
+    mailbox.publish();
+  };
+  for (int i = 0; i < 4; ++i)
+    step();
+  BENCHMARK("64MB snapshot, 1% dirty") {
+    step();
+  };
+  BENCHMARK("64MB snapshot, 1% dirty, consumer") {
+    step();
+    bool contiguous = false;
+    return mailbox.acquire(contiguous);
+  };
+}
@@ -0,0 +1,390 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+/// \file gl_bench.cpp
+/// \author FilipeCN (filipedecn@gmail.com)
+/// \date 2026-10-19
+///
+/// \brief
+
+
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include "headless_context.h"
+#include <circe/gl/graphics/clustered_lighting.h>
+#include <circe/gl/io/framebuffer.h>
+#include <circe/gl/io/font_texture.h>
+#include <circe/gl/io/frame_recorder.h>
+#include <circe/gl/io/weighted_blended_oit.h>
+#include <circe/gl/scene/debug_draw.h>
+#include <circe/gl/scene/scene_model.h>
+#include <circe/gl/texture/bricked_volume.h>
+#include <circe/gl/texture/macro_cell_grid.h>
+#include <circe/gl/ui/picker.h>
+#include <circe/gl/ui/region_selector.h>
+#include <circe/scene/shapes.h>
+#include <circe/ui/ui_camera.h>
+#include <filesystem>
+
+using namespace circe;
+
+// OpenGL benchmarks. They run on a headless context, so they can be executed
+// on software implementations:
+//    LIBGL_ALWAYS_SOFTWARE=1 circe_bench "[gl]" -r json -o gl.json
+// Each measured block ends with glFinish, so GPU work is included.
+
+namespace {
+
+const char *draw_vs =
+    "#version 440 core\n"
+    "layout(location = 0) in vec3 position;\n"
+    "uniform mat4 mvp;\n"
+    "void main() {\n"
+    "  gl_Position = mvp * vec4(position, 1.0);\n"
+    "}";
+
+const char *draw_fs =
+    "#version 440 core\n"
+    "layout(location = 0) out vec4 color;\n"
+    "void main() {\n"
+    "  color = vec4(1);\n"
+    "}";
+
+/// Offscreen color target
+struct RenderTarget {
+  explicit RenderTarget(const hermes::size2 &resolution) {
+    fbo.resize(resolution);
+    gl::Texture::Attributes attributes = {
+        .size_in_texels = {resolution.width, resolution.height, 1},
+        .internal_format = GL_RGBA8,
+        .format = GL_RGBA,
+        .type = GL_UNSIGNED_BYTE,
+        .target = GL_TEXTURE_2D,
+    };
+    color.set(attributes);
+    fbo.attachTexture(color, GL_COLOR_ATTACHMENT0);
+    fbo.setOutputBuffers({GL_COLOR_ATTACHMENT0});
+  }
+  gl::Framebuffer fbo;
+  gl::Texture color;
+};
+
+/// Mostly empty volume: a few dense spheres of radius n/16
+std::vector<f32> sparseVolume(u32 n, f32 value) {
+  std::vector<f32> data(static_cast<size_t>(n) * n * n, 0.f);
+  const f32 r = n / 16.f;
+  const hermes::vec3 centers[] = {{0.3f, 0.3f, 0.3f}, {0.7f, 0.5f, 0.4f}, {0.5f, 0.7f, 0.7f}};
+  for (const auto &c : centers)
+    for (u32 z = c.z * n - r; z <= c.z * n + r; ++z)
+      for (u32 y = c.y * n - r; y <= c.y * n + r; ++y)
+        for (u32 x = c.x * n - r; x <= c.x * n + r; ++x)
+          if ((hermes::vec3(x, y, z) - c * static_cast<f32>(n)).length() <= r)
+            data[(static_cast<size_t>(z) * n + y) * n + x] = value;
+  return data;
+}
+
+} // namespace
+
+TEST_CASE("GL buffer upload", "[gl]") {
+  REQUIRE(bench::HeadlessContext::instance().good());
+  for (u32 divisions : {3u, 5u, 7u}) {
+    auto sphere = Shapes::icosphere(divisions, shape_options::normal | shape_options::uv);
+    BENCHMARK("icosphere " + std::to_string(divisions) + " divisions") {
+      gl::SceneModel object(sphere);
+      glFinish();
+      return object.vertexCount();
+    };
+  }
+}
+
+TEST_CASE("GL draw call throughput", "[gl]") {
+  REQUIRE(bench::HeadlessContext::instance().good());
+  RenderTarget target({512, 512});
+  gl::Program program;
+  program.attach(gl::Shader(GL_VERTEX_SHADER, draw_vs));
+  program.attach(gl::Shader(GL_FRAGMENT_SHADER, draw_fs));
+  REQUIRE(program.link());
+  gl::SceneModel object(Shapes::box(hermes::bbox3::unitBox(true)));
+  for (u32 draw_count : {1000u, 10000u}) {
+    BENCHMARK(std::to_string(draw_count) + " draws") {
+      target.fbo.render([&]() {
+        program.use();
+        for (u32 i = 0; i < draw_count; ++i) {
+          auto s = 0.01f + 0.5f * static_cast<f32>(i) / draw_count;
+          program.setUniform("mvp", hermes::Transform::scale(s, s, s));
+          object.draw();
+        }
+      });
+      glFinish();
+    };
+  }
+}
+
+TEST_CASE("GL picking", "[gl]") {
+  REQUIRE(bench::HeadlessContext::instance().good());
+  UserCamera3D camera;
+  camera.resize(512, 512);
+  gl::SceneModel object(Shapes::icosphere(5));
+  gl::Picker picker;
+  picker.setResolution({512, 512});
+  BENCHMARK("object picking") {
+    picker.pick(&camera, {256, 256}, [&](const gl::Program &) { object.draw(); });
+    return picker.picked_index;
+  };
+}
+
+TEST_CASE("GL region selection", "[gl]") {
+  REQUIRE(bench::HeadlessContext::instance().good());
+  UserCamera3D camera;
+  camera.resize(512, 512);
+  gl::SceneModel object(Shapes::icosphere(7));
+  gl::RegionSelector selector;
+  BENCHMARK("rectangle " + std::to_string(object.vertexCount()) + " vertices") {
+    selector.selectVertices(&camera, {512, 512}, object,
+                            gl::RegionSelector::Region::rectangle({128, 128}, {384, 384}));
+    glFinish();
+  };
+  std::vector<hermes::point2> lasso;
+  for (u32 i = 0; i < 64; ++i) {
+    f32 angle = 2.f * hermes::Constants::pi * i / 64.f;
+    lasso.emplace_back(256.f + (100.f + 50.f * (i % 2)) * std::cos(angle),
+                       256.f + (100.f + 50.f * (i % 2)) * std::sin(angle));
+  }
+  BENCHMARK("lasso " + std::to_string(object.elementCount()) + " primitives") {
+    selector.selectPrimitives(&camera, {512, 512}, object, gl::RegionSelector::Region::lasso(lasso));
+    glFinish();
+  };
+}
+
+TEST_CASE("GL text", "[gl]") {
+  REQUIRE(bench::HeadlessContext::instance().good());
+  hermes::Path assets_path(std::string(ASSETS_PATH));
+  gl::FontAtlas atlas;
+  BENCHMARK("font atlas") {
+    atlas.loadFont((assets_path / "arial.ttf").fullName().c_str());
+    glFinish();
+  };
+  std::string text(1000, 'a');
+  for (size_t i = 0; i < text.size(); ++i)
+    text[i] = static_cast<char>(' ' + 1 + i % ('~' - ' ' - 1));
+  hermes::RawMesh mesh;
+  BENCHMARK("layout 1000 glyphs") {
+    atlas.setText(text, mesh);
+    return mesh.positions.size();
+  };
+}
+
+TEST_CASE("GL volume rendering", "[gl][volume]") {
+  REQUIRE(bench::HeadlessContext::instance().good());
+  hermes::Path shaders_path(std::string(SHADERS_PATH));
+  RenderTarget target({512, 512});
+  gl::SceneModel box(Shapes::box(hermes::bbox3::unitBox(true), shape_options::uvw));
+  REQUIRE(box.program.link(shaders_path, "woodcock_volume"));
+  UserCamera3D camera;
+  camera.resize(512, 512);
+  const f32 max_extinction = 100.f;
+  for (u32 n : {256u, 512u}) {
+    gl::Texture density;
+    density.set({
+        .size_in_texels = {n, n, n},
+        .internal_format = GL_R16F,
+        .format = GL_RED,
+        .type = GL_FLOAT,
+        .target = GL_TEXTURE_3D,
+    });
+    density.setTexels(sparseVolume(n, max_extinction).data());
+    gl::MacroCellGrid grid;
+    BENCHMARK("macro cells " + std::to_string(n) + "^3") {
+      grid.build(density, 8);
+      glFinish();
+    };
+    // one frame of delta tracking: global majorant vs macro cell majorants
+    for (int local_majorants : {0, 1}) {
+      BENCHMARK(std::string(local_majorants ? "local" : "global") + " majorant frame " + std::to_string(n) + "^3") {
+        target.fbo.render([&]() {
+          density.bind(GL_TEXTURE0);
+          grid.bind(GL_TEXTURE1);
+          box.program.use();
+          box.program.setUniform("projection", camera.getProjectionTransform());
+          box.program.setUniform("model", camera.getModelTransform());
+          box.program.setUniform("view", camera.getViewTransform());
+          box.program.setUniform("extinction_tex", 0);
+          box.program.setUniform("majorant_tex", 1);
+          box.program.setUniform("use_majorant_grid", local_majorants);
+          box.program.setUniform("albedo", 0.8f);
+          box.program.setUniform("max_iterations", 1);
+          box.program.setUniform("max_interactions", 100);
+          box.program.setUniform("max_extinction", max_extinction);
+          box.program.setUniform("domain_box_lower", hermes::point3(-0.5));
+          box.program.setUniform("domain_box_upper", hermes::point3(0.5));
+          box.program.setUniform("camera.pos", camera.getPosition());
+          box.program.setUniform("camera.up", hermes::normalize(camera.getUpVector()));
+          box.program.setUniform("camera.right", hermes::normalize(camera.getRight()));
+          box.draw();
+        });
+        glFinish();
+      };
+    }
+  }
+}
+
+TEST_CASE("GL volume upload", "[gl][volume]") {
+  REQUIRE(bench::HeadlessContext::instance().good());
+  const u32 n = 512;
+  auto data = sparseVolume(n, 1.f);
+  gl::Texture density;
+  density.set({
+      .size_in_texels = {n, n, n},
+      .internal_format = GL_R32F,
+      .format = GL_RED,
+      .type = GL_FLOAT,
+      .target = GL_TEXTURE_3D,
+  });
+  BENCHMARK("full upload 512^3") {
+    density.setTexels(data.data());
+    glFinish();
+  };
+  gl::TextureUploadRing ring;
+  gl::TexelRegion region{{128, 128, 128}, {64, 64, 64}};
+  BENCHMARK("dirty 64^3 region 512^3") {
+    ring.upload(density, {region}, data.data(), sizeof(f32));
+    glFinish();
+  };
+  for (auto storage : {gl::BrickedVolume::Storage::float16, gl::BrickedVolume::Storage::unorm8}) {
+    gl::BrickedVolume bricked;
+    REQUIRE(bricked.init({n, n, n}, 16, storage, 4096));
+    bricked.update(data.data());
+    std::string name = storage == gl::BrickedVolume::Storage::unorm8 ? "unorm8" : "float16";
+    BENCHMARK("bricked " + name + " dirty 64^3 region 512^3") {
+      bricked.update(data.data(), {region});
+      glFinish();
+    };
+  }
+}
+
+TEST_CASE("GL clustered lighting", "[gl][lighting]") {
+  REQUIRE(bench::HeadlessContext::instance().good());
+  UserCamera3D camera;
+  camera.resize(1280, 720);
+  std::srand(13);
+  for (u32 light_count : {1024u, 4096u, 16384u}) {
+    std::vector<gl::ClusteredLighting::Light> lights(light_count);
+    for (auto &light : lights) {
+      light.position = hermes::point3((std::rand() % 1000) / 100.f - 5.f,
+                                      (std::rand() % 1000) / 100.f - 5.f,
+                                      (std::rand() % 1000) / 100.f - 5.f);
+      light.radius = 0.5f;
+    }
+    gl::ClusteredLighting lighting;
+    lighting.setLights(lights);
+    BENCHMARK("cull " + std::to_string(light_count) + " lights") {
+      lighting.cull(camera, {1280, 720});
+      glFinish();
+    };
+  }
+}
+
+TEST_CASE("GL debug draw", "[gl]") {
+  REQUIRE(bench::HeadlessContext::instance().good());
+  RenderTarget target({512, 512});
+  UserCamera3D camera;
+  camera.resize(512, 512);
+  gl::DebugDraw debug_draw;
+  for (u32 n : {32u, 64u}) {
+    // vector field overlay: one arrow and one point per cell
+    BENCHMARK("vector field " + std::to_string(n) + "^3") {
+      target.fbo.render([&]() {
+        for (u32 k = 0; k < n; ++k)
+          for (u32 j = 0; j < n; ++j)
+            for (u32 i = 0; i < n; ++i) {
+              hermes::point3 p(i / static_cast<f32>(n), j / static_cast<f32>(n), k / static_cast<f32>(n));
+              debug_draw.arrow(p, hermes::vec3(0.5f / n, 0.f, 0.f), Color::Black());
+              debug_draw.point(p, Color::Red());
+            }
+        debug_draw.render(camera);
+      });
+      glFinish();
+    };
+  }
+}
+
+TEST_CASE("GL weighted blended OIT", "[gl]") {
+  REQUIRE(bench::HeadlessContext::instance().good());
+  RenderTarget target({512, 512});
+  // instanced overlapping quads, placed from gl_InstanceID
+  gl::Program program;
+  program.attach(gl::Shader(GL_VERTEX_SHADER,
+                            "#version 440 core\n"
+                            "uniform int count;\n"
+                            "out vec4 quad_color;\n"
+                            "void main() {\n"
+                            "  vec2 corner = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2) - 0.5;\n"
+                            "  float t = float(gl_InstanceID) / float(count);\n"
+                            "  vec2 center = vec2(fract(t * 97.0), fract(t * 57.0)) * 1.6 - 0.8;\n"
+                            "  gl_Position = vec4(center + 0.2 * corner, fract(t * 13.0), 1.0);\n"
+                            "  quad_color = vec4(t, 1.0 - t, 0.5, 0.3);\n"
+                            "}"));
+  program.attach(gl::Shader(GL_FRAGMENT_SHADER,
+                            "#version 440 core\n" + gl::WeightedBlendedOIT::glsl() +
+                                "in vec4 quad_color;\n"
+                                "void main() {\n"
+                                "  oitWrite(quad_color);\n"
+                                "}"));
+  REQUIRE(program.link());
+  gl::WeightedBlendedOIT oit;
+  oit.depth_format = GL_DEPTH_COMPONENT;
+  GLuint vao = 0;
+  glGenVertexArrays(1, &vao);
+  for (u32 count : {10000u, 100000u}) {
+    BENCHMARK(std::to_string(count) + " instances") {
+      target.fbo.render([&]() {
+        oit.render([&]() {
+          program.use();
+          program.setUniform("count", static_cast<int>(count));
+          glBindVertexArray(vao);
+          glDrawArraysInstanced(GL_TRIANGLES, 0, 3, count);
+          glBindVertexArray(0);
+        });
+      });
+      glFinish();
+    };
+  }
+  glDeleteVertexArrays(1, &vao);
+}
+
+TEST_CASE("GL frame capture", "[gl]") {
+  REQUIRE(bench::HeadlessContext::instance().good());
+  RenderTarget target({1920, 1080});
+  BENCHMARK("texels 1920x1080") {
+    return target.color.texels();
+  };
+  // render thread cost only: frames that find the ring full are dropped
+  gl::FrameRecorder recorder;
+  gl::FrameRecorder::Options options;
+  options.path = (std::filesystem::temp_directory_path() / "circe_bench_frame_%05d.png").string();
+  REQUIRE(recorder.start(options));
+  BENCHMARK("recorder capture 1920x1080") {
+    return recorder.capture(target.color);
+  };
+  recorder.stop();
+  CHECK(recorder.stats().failed == 0);
+}
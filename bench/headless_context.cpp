@@ -0,0 +1,118 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+/// \file headless_context.cpp
+/// \author FilipeCN (filipedecn@gmail.com)
+/// \date 2026-10-19
+///
+/// \brief
+
+
+#include "headless_context.h"
+#include <circe/gl/utils/open_gl.h>
+#include <hermes/common/debug.h>
+#ifdef CIRCE_BENCH_EGL
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
+namespace circe::bench {
+
+HeadlessContext &HeadlessContext::instance() {
+  static HeadlessContext context;
+  return context;
+}
+
+HeadlessContext::HeadlessContext() {
+#ifdef CIRCE_BENCH_EGL
+  auto get_platform_display = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+      eglGetProcAddress("eglGetPlatformDisplayEXT"));
+  EGLDisplay display = EGL_NO_DISPLAY;
+  if (get_platform_display)
+    display = get_platform_display(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+  if (display == EGL_NO_DISPLAY)
+    display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+  EGLint major, minor;
+  if (display != EGL_NO_DISPLAY && eglInitialize(display, &major, &minor)
+      && eglBindAPI(EGL_OPENGL_API)) {
+    const EGLint config_attributes[] = {
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_NONE
+    };
+    EGLConfig config;
+    EGLint config_count = 0;
+    eglChooseConfig(display, config_attributes, &config, 1, &config_count);
+    const EGLint context_attributes[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 4,
+        EGL_CONTEXT_MINOR_VERSION, 5,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+    EGLContext context = config_count ?
+                         eglCreateContext(display, config, EGL_NO_CONTEXT, context_attributes) :
+                         EGL_NO_CONTEXT;
+    if (context != EGL_NO_CONTEXT && eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context)
+        && gladLoadGLLoader(reinterpret_cast<GLADloadproc>(eglGetProcAddress))) {
+      display_ = display;
+      context_ = context;
+      good_ = true;
+      return;
+    }
+    if (context != EGL_NO_CONTEXT)
+      eglDestroyContext(display, context);
+    eglTerminate(display);
+  }
+  HERMES_LOG_WARNING("EGL surfaceless context failed, falling back to an invisible window.");
+#endif
+  if (!glfwInit())
+    return;
+  glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+  auto *window = glfwCreateWindow(1, 1, "circe_bench", nullptr, nullptr);
+  if (!window)
+    return;
+  glfwMakeContextCurrent(window);
+  context_ = window;
+  good_ = gladLoadGLLoader(reinterpret_cast<GLADloadproc>(glfwGetProcAddress));
+}
+
+HeadlessContext::~HeadlessContext() {
+#ifdef CIRCE_BENCH_EGL
+  if (display_) {
+    eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglDestroyContext(display_, context_);
+    eglTerminate(display_);
+    return;
+  }
+#endif
+  if (context_) {
+    glfwDestroyWindow(reinterpret_cast<GLFWwindow *>(context_));
+    glfwTerminate();
+  }
+}
+
+bool HeadlessContext::good() const {
+  return good_;
+}
+
+} // namespace circe::bench
@@ -0,0 +1,58 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+/// \file headless_context.h
+/// \author FilipeCN (filipedecn@gmail.com)
+/// \date 2026-10-19
+///
+/// \brief
+
+
+#ifndef CIRCE_BENCH_HEADLESS_CONTEXT_H
+#define CIRCE_BENCH_HEADLESS_CONTEXT_H
+
+namespace circe::bench {
+
+/// OpenGL 4.5 core context without any window.
+/// When EGL is available (CIRCE_BENCH_EGL) the context is created through a
+/// surfaceless display (EGL_MESA_platform_surfaceless), so it runs on
+/// machines without a display server, ex: Mesa llvmpipe in CI:
+///    LIBGL_ALWAYS_SOFTWARE=1 circe_bench "[gl]"
+/// Otherwise, an invisible GLFW window is used.
+/// \note All GL objects must be rendered into framebuffer objects.
+class HeadlessContext {
+public:
+  /// \return the context, created (and made current) on first use
+  static HeadlessContext &instance();
+  ~HeadlessContext();
+  /// \return true if the context is current
+  [[nodiscard]] bool good() const;
+
+private:
+  HeadlessContext();
+  bool good_{false};
+  void *display_{nullptr};
+  void *context_{nullptr};
+};
+
+} // namespace circe::bench
+
+#endif // CIRCE_BENCH_HEADLESS_CONTEXT_H
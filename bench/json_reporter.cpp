@@ -0,0 +1,113 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+/// \file json_reporter.cpp
+/// \author FilipeCN (filipedecn@gmail.com)
+/// \date 2026-10-19
+///
+/// \brief
+
+
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+#include <iomanip>
+
+namespace {
+
+std::string escape(const std::string &s) {
+  std::string r;
+  for (auto c : s) {
+    switch (c) {
+    case '"': r += "\\\"";
+      break;
+    case '\\': r += "\\\\";
+      break;
+    case '\n': r += "\\n";
+      break;
+    case '\t': r += "\\t";
+      break;
+    default: r += c;
+    }
+  }
+  return r;
+}
+
+} // namespace
+
+/// Writes benchmark results as a JSON document, so results can be tracked
+/// across releases:
+///    circe_bench -r json -o circe_bench.json
+/// Each entry holds the mean, bounds and standard deviation of a benchmark
+/// in nanoseconds.
+class JsonReporter : public Catch::StreamingReporterBase<JsonReporter> {
+public:
+  explicit JsonReporter(const Catch::ReporterConfig &config) : StreamingReporterBase(config) {
+    m_reporterPrefs.shouldReportAllAssertions = false;
+  }
+  ~JsonReporter() override = default;
+
+  static std::string getDescription() {
+    return "Reports benchmark results as JSON";
+  }
+
+  void assertionStarting(const Catch::AssertionInfo &) override {}
+
+  bool assertionEnded(const Catch::AssertionStats &) override { return true; }
+
+  void testRunStarting(const Catch::TestRunInfo &info) override {
+    StreamingReporterBase::testRunStarting(info);
+    stream << "{\n  \"run\": \"" << escape(info.name) << "\",\n  \"benchmarks\": [";
+  }
+
+  void testCaseStarting(const Catch::TestCaseInfo &info) override {
+    StreamingReporterBase::testCaseStarting(info);
+    test_case_ = info.name;
+  }
+
+  void benchmarkEnded(const Catch::BenchmarkStats<> &stats) override {
+    stream << (benchmark_count_++ ? ",\n" : "\n") << std::setprecision(10)
+           << "    {\"test_case\": \"" << escape(test_case_) << "\", "
+           << "\"name\": \"" << escape(stats.info.name) << "\", "
+           << "\"samples\": " << stats.info.samples << ", "
+           << "\"iterations\": " << stats.info.iterations << ", "
+           << "\"mean_ns\": " << stats.mean.point.count() << ", "
+           << "\"mean_lower_ns\": " << stats.mean.lower_bound.count() << ", "
+           << "\"mean_upper_ns\": " << stats.mean.upper_bound.count() << ", "
+           << "\"std_dev_ns\": " << stats.standardDeviation.point.count() << "}";
+  }
+
+  void benchmarkFailed(const std::string &error) override {
+    stream << (benchmark_count_++ ? ",\n" : "\n")
+           << "    {\"test_case\": \"" << escape(test_case_) << "\", "
+           << "\"error\": \"" << escape(error) << "\"}";
+  }
+
+  void testRunEnded(const Catch::TestRunStats &stats) override {
+    stream << "\n  ],\n  \"failed_assertions\": " << stats.totals.assertions.failed << "\n}\n";
+    StreamingReporterBase::testRunEnded(stats);
+  }
+
+private:
+  std::string test_case_;
+  size_t benchmark_count_{0};
+};
+
+CATCH_REGISTER_REPORTER("json", JsonReporter)
@@ -0,0 +1,110 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+/// \file vk_bench.cpp
+/// \author FilipeCN (filipedecn@gmail.com)
+/// \date 2026-10-19
+///
+/// \brief
+
+
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <circe/vk/core/instance.h>
+#include <circe/vk/scene/geometry_buffer.h>
+#include <circe/vk/scene/scene_model.h>
+#include <circe/vk/utils/parallel_recorder.h>
+#include <circe/scene/shapes.h>
+
+// Vulkan benchmarks. No surface is created, so they run on software
+// implementations:
+//    VK_ICD_FILENAMES=/usr/share/vulkan/icd.d/lvp_icd.x86_64.json \
+//    circe_bench "[vk]" -r json -o vk.json
+
+namespace {
+
+/// Device shared by all vk benchmarks
+struct HeadlessDevice {
+  HeadlessDevice() : instance("circe_bench") {
+    if (!instance.good())
+      return;
+    physical_device = instance.pickPhysicalDevice(queue_families, VK_NULL_HANDLE);
+    if (!physical_device.good() || !logical_device.init(&physical_device, {}, {}, queue_families))
+      return;
+    family_index = queue_families.family("graphics").family_index.value();
+    queue = queue_families.family("graphics").vk_queues[0];
+  }
+  [[nodiscard]] bool good() const { return queue != VK_NULL_HANDLE; }
+
+  circe::vk::Instance instance;
+  circe::vk::QueueFamilies queue_families;
+  circe::vk::PhysicalDevice physical_device;
+  circe::vk::LogicalDevice logical_device;
+  u32 family_index{0};
+  VkQueue queue{VK_NULL_HANDLE};
+};
+
+HeadlessDevice &device() {
+  static HeadlessDevice device;
+  return device;
+}
+
+} // namespace
+
+TEST_CASE("VK geometry upload", "[vk]") {
+  auto &d = device();
+  REQUIRE(d.good());
+  for (u32 divisions : {3u, 5u, 7u}) {
+    auto sphere = circe::Shapes::icosphere(divisions, circe::shape_options::normal | circe::shape_options::uv);
+    circe::vk::GeometryBuffer geometry;
+    REQUIRE(geometry.init(d.logical_device.ref(), d.queue, d.family_index,
+                          circe::vk::vertexStride(sphere.data()),
+                          sphere.data().size(), sphere.indices().size()));
+    BENCHMARK("icosphere " + std::to_string(divisions) + " divisions") {
+      geometry.clear();
+      circe::vk::Model model;
+      model.loadFromModel(sphere, geometry);
+      return geometry.flush();
+    };
+  }
+}
+
+TEST_CASE("VK draw recording", "[vk]") {
+  auto &d = device();
+  REQUIRE(d.good());
+  circe::vk::RenderPass renderpass;
+  renderpass.addAttachment(VK_FORMAT_R8G8B8A8_UNORM, VK_SAMPLE_COUNT_1_BIT,
+                           VK_ATTACHMENT_LOAD_OP_CLEAR, VK_ATTACHMENT_STORE_OP_STORE,
+                           VK_ATTACHMENT_LOAD_OP_DONT_CARE, VK_ATTACHMENT_STORE_OP_DONT_CARE,
+                           VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+  renderpass.newSubpassDescription().addColorAttachmentRef(0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+  REQUIRE(renderpass.init(d.logical_device.ref()));
+  circe::vk::ParallelCommandRecorder recorder;
+  REQUIRE(recorder.init(d.logical_device.ref(), d.family_index, 0, 1));
+  auto record_chunk = [](circe::vk::CommandBuffer &cb, u32 first, u32 count, u32) {
+    for (u32 i = first; i < first + count; ++i)
+      cb.draw(3, 1, 0, i);
+  };
+  BENCHMARK("100000 draws, " + std::to_string(recorder.threadCount()) + " threads") {
+    return recorder.record(0, renderpass.ref(), 0, nullptr, 100000, 2000, record_chunk);
+  };
+}
@@ -5,11 +5,15 @@
 #include <circe/imgui/TextEditor.h>
 #include <circe/imgui/ImGuizmo.h>
 #include <circe/ui/imgui_profiler.h>
+#include <circe/ui/trace_capture.h>
 #include <circe/ui/imgui_logger.h>
+#include <circe/gl/graphics/clustered_lighting.h>
 #include <circe/gl/graphics/compute_shader.h>
 #include <circe/gl/graphics/ibl.h>
+#include <circe/gl/graphics/post_process_chain.h>
 #include <circe/gl/graphics/shader.h>
 #include <circe/gl/graphics/shader_manager.h>
+#include <circe/gl/graphics/cascaded_shadow_map.h>
 #include <circe/gl/graphics/shadow_map.h>
 #include <circe/ui/gizmo.h>
 #include <circe/ui/imgui_utils.h>
@@ -20,18 +24,26 @@
 #include <circe/gl/io/buffer.h>
 #include <circe/gl/storage/vertex_array_object.h>
 #include <circe/gl/io/display_renderer.h>
+#include <circe/gl/io/dynamic_resolution.h>
 #include <circe/gl/io/font_texture.h>
+#include <circe/gl/io/frame_recorder.h>
 #include <circe/gl/io/framebuffer.h>
 #include <circe/gl/io/graphics_display.h>
 #include <circe/gl/texture/image_texture.h>
 #include <circe/gl/texture/framebuffer_texture.h>
+#include <circe/gl/io/progressive_accumulator.h>
 #include <circe/gl/io/screen_quad.h>
+#include <circe/gl/texture/bricked_volume.h>
+#include <circe/gl/texture/macro_cell_grid.h>
 #include <circe/gl/texture/texture.h>
+#include <circe/gl/texture/texture_upload_ring.h>
 #include <circe/gl/io/viewport_display.h>
+#include <circe/gl/io/weighted_blended_oit.h>
 #include <circe/scene/camera_interface.h>
 #include <circe/scene/light.h>
 #include <circe/scene/material.h>
 #include <circe/scene/shapes.h>
+#include <circe/gl/scene/debug_draw.h>
 #include <circe/gl/scene/instance_set.h>
 #include <circe/gl/scene/mesh_utils.h>
 #include <circe/gl/scene/quad.h>
@@ -54,6 +66,7 @@
 #include <circe/gl/ui/interactive_object_interface.h>
 #include <circe/gl/ui/modifier_cursor.h>
 #include <circe/gl/ui/picker.h>
+#include <circe/gl/ui/region_selector.h>
 #include <circe/gl/ui/scene_app.h>
 #include <circe/gl/ui/text_object.h>
 #include <circe/gl/ui/text_renderer.h>
@@ -63,6 +76,8 @@
 #include <circe/gl/utils/open_gl.h>
 #include <circe/gl/utils/win32_utils.h>
 #include <circe/gl/utils/base_app.h>
+#include <circe/gl/utils/gpu_timer.h>
+#include <circe/gl/utils/scene_snapshot.h>
 #include <circe/io/io.h>
 
 namespace circe {
@@ -26,6 +26,8 @@
 ///\brief
 
 #include <circe/colors/color_palette.h>
+#include <circe/common/job_system.h>
+#include <algorithm>
 
 namespace circe {
 
@@ -73,6 +75,106 @@ f32 matlab_heat[] =
      0.23529f, 0.f, 0.42745f, 0.22745f, 0.f, 0.40784f, 0.21569f};
 
 
+namespace {
+
+/// Number of values mapped at a time. Index and weight computations of a
+/// block are done in a separate loop from the color lookups, which keeps both
+/// loops free of branches.
+constexpr size_t map_block_size = 256;
+
+/// Palette channels in separate arrays, with the last color repeated, so
+/// lower + 1 is always a valid index
+struct PaletteChannels {
+  explicit PaletteChannels(const std::vector<Color> &colors) {
+    size_t n = colors.size();
+    r.resize(n + 1);
+    g.resize(n + 1);
+    b.resize(n + 1);
+    for (size_t i = 0; i <= n; ++i) {
+      const auto &c = colors[std::min(i, n - 1)];
+      r[i] = c.r;
+      g[i] = c.g;
+      b[i] = c.b;
+    }
+  }
+  std::vector<float> r, g, b;
+};
+
+void mapRange(const PaletteChannels &channels, size_t color_count, const float *values, size_t count,
+              Color *output, float offset, float scale, float alpha) {
+  const float last = static_cast<float>(color_count - 1);
+  int lower[map_block_size];
+  float weight[map_block_size];
+  for (size_t first = 0; first < count; first += map_block_size) {
+    size_t n = std::min(map_block_size, count - first);
+    const float *v = values + first;
+    for (size_t i = 0; i < n; ++i) {
+      float t = (v[i] - offset) * scale;
+      // written so NaN maps to 0
+      t = t > 0.f ? t : 0.f;
+      t = t < 1.f ? t : 1.f;
+      float index = t * last;
+      lower[i] = static_cast<int>(index);
+      weight[i] = index - static_cast<float>(lower[i]);
+    }
+    Color *o = output + first;
+    for (size_t i = 0; i < n; ++i) {
+      int k = lower[i];
+      float w = weight[i];
+      o[i].r = channels.r[k] + w * (channels.r[k + 1] - channels.r[k]);
+      o[i].g = channels.g[k] + w * (channels.g[k + 1] - channels.g[k]);
+      o[i].b = channels.b[k] + w * (channels.b[k + 1] - channels.b[k]);
+      o[i].a = alpha;
+    }
+  }
+}
+
+}
+
+void ColorPalette::map(const float *values, size_t count, Color *output,
+                       float min_value, float max_value, float alpha, JobSystem *jobs) const {
+  if (!count || colors.empty())
+    return;
+  PaletteChannels channels(colors);
+  float scale = max_value != min_value ? 1.f / (max_value - min_value) : 0.f;
+  alpha = alpha >= 0.f ? alpha : a;
+  // chunks small enough to balance, large enough to amortize job overhead
+  const size_t grain_size = 1 << 16;
+  if (!jobs || count <= grain_size) {
+    mapRange(channels, colors.size(), values, count, output, min_value, scale, alpha);
+    return;
+  }
+  jobs->parallelFor(static_cast<u32>((count + grain_size - 1) / grain_size), 1,
+                    [&](u32 first_chunk, u32 chunk_count, u32) {
+                      for (u32 chunk = first_chunk; chunk < first_chunk + chunk_count; ++chunk) {
+                        size_t first = chunk * grain_size;
+                        mapRange(channels, colors.size(), values + first,
+                                 std::min(grain_size, count - first), output + first,
+                                 min_value, scale, alpha);
+                      }
+                    });
+}
+
+std::vector<Color> ColorPalette::map(const std::vector<float> &values, float min_value, float max_value,
+                                     float alpha, JobSystem *jobs) const {
+  std::vector<Color> output(values.size());
+  map(values.data(), values.size(), output.data(), min_value, max_value, alpha, jobs);
+  return output;
+}
+
+void ColorPalette::range(const float *values, size_t count, float &min_value, float &max_value) {
+  if (!count) {
+    min_value = 0.f;
+    max_value = 1.f;
+    return;
+  }
+  min_value = max_value = values[0];
+  for (size_t i = 1; i < count; ++i) {
+    min_value = std::min(min_value, values[i]);
+    max_value = std::max(max_value, values[i]);
+  }
+}
+
 ColorPalette ColorPalettes::MatlabHeatMap() {
   return std::move(ColorPalette(matlab_heat, sizeof(matlab_heat) / (sizeof(float) * 3)));
 }
@@ -40,6 +40,8 @@
 
 namespace circe {
 
+class JobSystem;
+
 // *********************************************************************************************************************
 //                                                                                             ProceduralColorPalette
 // *********************************************************************************************************************
@@ -114,7 +116,8 @@ public:
   /// \param alpha
   /// \return
   inline Color operator()(float t, float alpha = -1) const {
-    t = hermes::Numbers::clamp(t, 0.f, 1.f);
+    // written so NaN maps to the first color (as in map())
+    t = t > 0.f ? (t < 1.f ? t : 1.f) : 0.f;
     float ind = hermes::interpolation::lerp(t, 0.f, static_cast<float>(colors.size() - 1));
     float r = std::abs(hermes::Numbers::fract(ind));
     Color c;
@@ -137,6 +140,40 @@ public:
     return c;
   }
   // *******************************************************************************************************************
+  //                                                                                                          METHODS
+  // *******************************************************************************************************************
+  /// \brief Maps a batch of scalars to colors
+  /// \note Values are normalized by (v - min_value) / (max_value - min_value)
+  /// and then mapped exactly as operator() does (NaN maps to the first color
+  /// and, if min_value == max_value, so does every value). The inner loops
+  /// are branchless, so they can be vectorized by the compiler.
+  /// \param values
+  /// \param count number of values
+  /// \param output receives count colors
+  /// \param min_value value mapped to the first color
+  /// \param max_value value mapped to the last color
+  /// \param alpha output alpha (default alpha if negative)
+  /// \param jobs (optional) job system used to map chunks in parallel
+  void map(const float *values, size_t count, Color *output,
+           float min_value = 0.f, float max_value = 1.f, float alpha = -1,
+           JobSystem *jobs = nullptr) const;
+  /// \brief Maps a batch of scalars to colors
+  /// \param values
+  /// \param min_value value mapped to the first color
+  /// \param max_value value mapped to the last color
+  /// \param alpha output alpha (default alpha if negative)
+  /// \param jobs (optional) job system used to map chunks in parallel
+  /// \return one color per value
+  [[nodiscard]] std::vector<Color> map(const std::vector<float> &values,
+                                       float min_value = 0.f, float max_value = 1.f, float alpha = -1,
+                                       JobSystem *jobs = nullptr) const;
+  /// \brief Computes the range of a batch of scalars (for normalization)
+  /// \param values
+  /// \param count
+  /// \param min_value receives the smallest value (0 if count is 0)
+  /// \param max_value receives the largest value (1 if count is 0)
+  static void range(const float *values, size_t count, float &min_value, float &max_value);
+  // *******************************************************************************************************************
   //                                                                                                    PUBLIC FIELDS
   // *******************************************************************************************************************
   float a{1.f};                     //!< default alpha value
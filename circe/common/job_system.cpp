@@ -0,0 +1,131 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file job_system.cpp
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+#include <circe/common/job_system.h>
+#include <algorithm>
+
+namespace circe {
+
+JobSystem::JobSystem(u32 worker_count) {
+  if (!worker_count)
+    worker_count = std::max(1u, std::thread::hardware_concurrency());
+  for (u32 i = 0; i < worker_count; ++i)
+    queues_.emplace_back(std::make_unique<Queue>());
+  for (u32 i = 0; i < worker_count; ++i)
+    workers_.emplace_back([this, i]() { workerLoop(i); });
+}
+
+JobSystem::~JobSystem() {
+  wait();
+  {
+    std::lock_guard<std::mutex> lock(wake_mutex_);
+    stop_ = true;
+  }
+  wake_condition_.notify_all();
+  for (auto &worker : workers_)
+    worker.join();
+}
+
+void JobSystem::submit(Job job) {
+  u32 queue_index = next_queue_++ % queues_.size();
+  pending_++;
+  {
+    std::lock_guard<std::mutex> lock(queues_[queue_index]->mutex);
+    queues_[queue_index]->jobs.emplace_back(std::move(job));
+  }
+  {
+    std::lock_guard<std::mutex> lock(wake_mutex_);
+    queued_++;
+  }
+  wake_condition_.notify_one();
+}
+
+void JobSystem::wait() {
+  std::unique_lock<std::mutex> lock(wake_mutex_);
+  done_condition_.wait(lock, [this]() { return pending_ == 0; });
+}
+
+void JobSystem::parallelFor(u32 count, u32 grain_size,
+                            const std::function<void(u32, u32, u32)> &f) {
+  if (!count)
+    return;
+  grain_size = std::max(1u, grain_size);
+  for (u32 first = 0; first < count; first += grain_size) {
+    u32 n = std::min(grain_size, count - first);
+    submit([&f, first, n](u32 worker_index) { f(first, n, worker_index); });
+  }
+  wait();
+}
+
+u32 JobSystem::workerCount() const {
+  return workers_.size();
+}
+
+bool JobSystem::pop(u32 worker_index, Job &job) {
+  auto &queue = *queues_[worker_index];
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if (queue.jobs.empty())
+    return false;
+  job = std::move(queue.jobs.back());
+  queue.jobs.pop_back();
+  return true;
+}
+
+bool JobSystem::steal(u32 worker_index, Job &job) {
+  for (size_t i = 1; i < queues_.size(); ++i) {
+    auto &queue = *queues_[(worker_index + i) % queues_.size()];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.jobs.empty())
+      continue;
+    job = std::move(queue.jobs.front());
+    queue.jobs.pop_front();
+    return true;
+  }
+  return false;
+}
+
+void JobSystem::workerLoop(u32 worker_index) {
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(wake_mutex_);
+      wake_condition_.wait(lock, [this]() { return stop_ || queued_ > 0; });
+      if (stop_ && queued_ == 0)
+        return;
+    }
+    Job job;
+    if (!pop(worker_index, job) && !steal(worker_index, job))
+      continue;
+    queued_--;
+    job(worker_index);
+    if (--pending_ == 0) {
+      std::lock_guard<std::mutex> lock(wake_mutex_);
+      done_condition_.notify_all();
+    }
+  }
+}
+
+} // namespace circe
@@ -0,0 +1,113 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file job_system.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief Small work-stealing job system
+///
+///\ingroup common
+///\addtogroup common
+/// @{
+
+#ifndef CIRCE_COMMON_JOB_SYSTEM_H
+#define CIRCE_COMMON_JOB_SYSTEM_H
+
+#include <hermes/common/defs.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace circe {
+
+/// Fixed set of worker threads, each one owning a job queue. Workers consume
+/// jobs from the back of their own queue and, when it runs empty, steal jobs
+/// from the front of the other queues.
+/// \note Every job receives the index of the worker executing it, which lets
+/// callers keep per-thread resources (e.g. vulkan command pools) without
+/// further synchronization.
+class JobSystem {
+public:
+  using Job = std::function<void(u32 worker_index)>;
+  // ***********************************************************************
+  //                           CONSTRUCTORS
+  // ***********************************************************************
+  /// \param worker_count number of worker threads (0 = hardware concurrency)
+  explicit JobSystem(u32 worker_count = 0);
+  JobSystem(const JobSystem &other) = delete;
+  JobSystem(JobSystem &&other) = delete;
+  ~JobSystem();
+  // ***********************************************************************
+  //                           OPERATORS
+  // ***********************************************************************
+  JobSystem &operator=(const JobSystem &other) = delete;
+  JobSystem &operator=(JobSystem &&other) = delete;
+  // ***********************************************************************
+  //                           METHODS
+  // ***********************************************************************
+  /// Pushes a job into the next worker queue (round-robin)
+  /// \param job
+  void submit(Job job);
+  /// Blocks until all submitted jobs have finished
+  void wait();
+  /// Splits the range [0, count) into chunks of at most grain_size elements,
+  /// runs each chunk as a job and waits for all of them.
+  /// \param count number of elements
+  /// \param grain_size maximum number of elements per chunk
+  /// \param f receives (first element, element count, worker index)
+  void parallelFor(u32 count, u32 grain_size,
+                   const std::function<void(u32, u32, u32)> &f);
+  // ***********************************************************************
+  //                           FIELDS
+  // ***********************************************************************
+  [[nodiscard]] u32 workerCount() const;
+
+private:
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Job> jobs;
+  };
+  bool pop(u32 worker_index, Job &job);
+  bool steal(u32 worker_index, Job &job);
+  void workerLoop(u32 worker_index);
+
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::vector<std::thread> workers_;
+  std::atomic<u32> next_queue_{0};
+  std::atomic<u64> queued_{0};   //!< jobs waiting in queues
+  std::atomic<u64> pending_{0};  //!< jobs submitted but not finished
+  std::mutex wake_mutex_;
+  std::condition_variable wake_condition_;
+  std::condition_variable done_condition_;
+  bool stop_{false};
+};
+
+} // namespace circe
+
+#endif // CIRCE_COMMON_JOB_SYSTEM_H
+
+/// @}
@@ -0,0 +1,100 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///
+///\file triple_buffer.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief Lock-free single producer / single consumer triple buffer
+///
+///\ingroup common
+///\addtogroup common
+/// @{
+
+#ifndef CIRCE_COMMON_TRIPLE_BUFFER_H
+#define CIRCE_COMMON_TRIPLE_BUFFER_H
+
+#include <hermes/common/defs.h>
+#include <atomic>
+
+namespace circe {
+
+/// Mailbox between one producer thread and one consumer thread that always
+/// hands the consumer the most recent value, without either side ever waiting.
+/// The producer writes into back() and publishes it; the consumer calls
+/// update() and reads front(). Values published while the consumer was busy
+/// are overwritten (only the latest one is kept).
+/// \note Buffers are reused: back() holds whatever was written into it the
+/// last time it was published, not the latest published value.
+/// \tparam T
+template<typename T>
+class TripleBuffer {
+public:
+  // ***********************************************************************
+  //                           CONSTRUCTORS
+  // ***********************************************************************
+  TripleBuffer() = default;
+  TripleBuffer(const TripleBuffer &other) = delete;
+  TripleBuffer &operator=(const TripleBuffer &other) = delete;
+  // ***********************************************************************
+  //                        PRODUCER METHODS
+  // ***********************************************************************
+  /// \return buffer owned by the producer
+  T &back() { return buffers_[back_]; }
+  /// \return last published buffer (the consumer may be reading it too, so it
+  /// must not be modified), nullptr before the first publish
+  const T *lastPublished() const { return published_ < 3 ? &buffers_[published_] : nullptr; }
+  /// Hands back() to the consumer and takes a free buffer in its place
+  void publish() {
+    published_ = back_;
+    back_ = middle_.exchange(back_ | fresh_bit, std::memory_order_acq_rel) & index_mask;
+  }
+  // ***********************************************************************
+  //                        CONSUMER METHODS
+  // ***********************************************************************
+  /// Moves the latest published buffer to front()
+  /// \return true if a new buffer was published since the last call
+  bool update() {
+    if (!(middle_.load(std::memory_order_acquire) & fresh_bit))
+      return false;
+    front_ = middle_.exchange(front_, std::memory_order_acq_rel) & index_mask;
+    return true;
+  }
+  /// \return buffer owned by the consumer
+  const T &front() const { return buffers_[front_]; }
+
+private:
+  static constexpr u32 index_mask = 3;
+  static constexpr u32 fresh_bit = 4;
+
+  T buffers_[3];
+  u32 back_{0};                 //!< producer side
+  u32 published_{3};            //!< producer side (3 = none)
+  std::atomic<u32> middle_{1};  //!< index | fresh_bit
+  u32 front_{2};                //!< consumer side
+};
+
+} // namespace circe
+
+#endif // CIRCE_COMMON_TRIPLE_BUFFER_H
+
+/// @}
@@ -0,0 +1,255 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file cascaded_shadow_map.cpp
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+
+#include <circe/gl/graphics/cascaded_shadow_map.h>
+#include <cmath>
+
+namespace circe::gl {
+
+namespace {
+
+bool sameFit(const CascadedShadowMap::Cascade &a, const CascadedShadowMap::Cascade &b) {
+  return a.radius == b.radius && a.center.x == b.center.x && a.center.y == b.center.y && a.center.z == b.center.z;
+}
+
+}
+
+bool CascadedShadowMap::Cascade::intersects(const hermes::bbox3 &bounds) const {
+  // light clip space xy overlap (depth is clamped, so casters between the
+  // light and the cascade always count)
+  f32 min_x = 2, max_x = -2, min_y = 2, max_y = -2;
+  for (u32 i = 0; i < 8; ++i) {
+    hermes::point3 corner((i & 1) ? bounds.upper.x : bounds.lower.x,
+                          (i & 2) ? bounds.upper.y : bounds.lower.y,
+                          (i & 4) ? bounds.upper.z : bounds.lower.z);
+    auto p = light_transform(corner);
+    min_x = std::min(min_x, p.x);
+    max_x = std::max(max_x, p.x);
+    min_y = std::min(min_y, p.y);
+    max_y = std::max(max_y, p.y);
+  }
+  return !(max_x < -1 || min_x > 1 || max_y < -1 || min_y > 1);
+}
+
+CascadedShadowMap::CascadedShadowMap(u32 cascade_count, const hermes::size2 &size) : size_(size) {
+  cascade_count = std::max(1u, cascade_count);
+  cascades_.resize(cascade_count);
+  static_cascades_.resize(cascade_count);
+  static_valid_.resize(cascade_count, false);
+  dynamic_drawn_.resize(cascade_count, true);
+  // setup shader program
+  Shader vertex_shader(GL_VERTEX_SHADER, "#version 430 core\n"
+                                         "layout (location = 0) in vec3 position;\n"
+                                         "layout (location = 1) uniform mat4 lightSpaceMatrix;\n"
+                                         "layout (location = 2) uniform mat4 model;\n"
+                                         "void main()\n"
+                                         "{ gl_Position = lightSpaceMatrix * model * vec4(position, 1.0); }");
+  Shader fragment_shader(GL_FRAGMENT_SHADER, "#version 430 core\nvoid main(){ }\n");
+  program_.attach(vertex_shader);
+  program_.attach(fragment_shader);
+  if (!program_.link())
+    HERMES_LOG_ERROR("Failed to compile cascaded shadow map shader: {}", program_.err);
+  // setup depth texture arrays
+  Texture::Attributes attributes;
+  attributes.size_in_texels = {size.width, size.height, cascade_count};
+  attributes.target = GL_TEXTURE_2D_ARRAY;
+  attributes.internal_format = GL_DEPTH_COMPONENT32F;
+  attributes.format = GL_DEPTH_COMPONENT;
+  attributes.type = GL_FLOAT;
+  Texture::View parameters(Color::White(), GL_TEXTURE_2D_ARRAY);
+  parameters[GL_TEXTURE_MIN_FILTER] = GL_NEAREST;
+  parameters[GL_TEXTURE_MAG_FILTER] = GL_NEAREST;
+  for (auto *texture : {&depth_map_, &static_depth_map_}) {
+    texture->set(attributes);
+    texture->bind();
+    parameters.apply();
+  }
+  // layers are attached on render, there is no color buffer
+  depth_buffer_.resize(size);
+  depth_buffer_.enable();
+  glDrawBuffer(GL_NONE);
+  glReadBuffer(GL_NONE);
+  circe::gl::Framebuffer::disable();
+  CHECK_GL_ERRORS;
+}
+
+CascadedShadowMap::~CascadedShadowMap() = default;
+
+void CascadedShadowMap::setLight(const Light &light) {
+  light_ = light;
+  invalidateStaticCasters();
+}
+
+void CascadedShadowMap::update(const CameraInterface &camera) {
+  const u32 n = cascades_.size();
+  // split depths: blend of logarithmic and uniform schemes
+  f32 near = camera.getNear();
+  f32 far = std::max(near, std::min(camera.getFar(), max_distance));
+  std::vector<f32> splits(n + 1);
+  for (u32 i = 0; i <= n; ++i) {
+    f32 s = static_cast<f32>(i) / n;
+    f32 log_split = near * std::pow(far / near, s);
+    f32 uniform_split = near + (far - near) * s;
+    splits[i] = split_lambda * log_split + (1 - split_lambda) * uniform_split;
+  }
+  // frustum corner edges in view space, parametrized by view depth
+  auto inv_projection = hermes::inverse(camera.getProjectionTransform());
+  auto inv_view = hermes::inverse(camera.getViewTransform() * camera.getModelTransform());
+  hermes::point3 edge_start[4], edge_end[4];
+  for (u32 i = 0; i < 4; ++i) {
+    f32 x = (i & 1) ? 1.f : -1.f;
+    f32 y = (i & 2) ? 1.f : -1.f;
+    edge_start[i] = inv_projection * hermes::point3(x, y, 0.f);
+    edge_end[i] = inv_projection * hermes::point3(x, y, 1.f);
+  }
+  auto corner = [&](u32 i, f32 depth) -> hermes::point3 {
+    f32 z0 = std::fabs(edge_start[i].z);
+    f32 z1 = std::fabs(edge_end[i].z);
+    f32 t = std::fabs(z1 - z0) > 1e-8f ? (depth - z0) / (z1 - z0) : 0.f;
+    return inv_view(edge_start[i] + (edge_end[i] - edge_start[i]) * t);
+  };
+  // light basis, fixed for a given light direction
+  hermes::vec3 direction = hermes::normalize(light_.direction);
+  hermes::vec3 up = std::fabs(direction.y) > 0.99f ? hermes::vec3(1, 0, 0) : hermes::vec3(0, 1, 0);
+  auto light_rotation = hermes::Transform::lookAt(hermes::point3() + direction, hermes::point3(), up);
+  auto inv_light_rotation = hermes::inverse(light_rotation);
+  for (u32 c = 0; c < n; ++c) {
+    auto &cascade = cascades_[c];
+    cascade.split_near = splits[c];
+    cascade.split_far = splits[c + 1];
+    hermes::point3 corners[8];
+    hermes::vec3 sum;
+    for (u32 i = 0; i < 4; ++i) {
+      corners[i] = corner(i, cascade.split_near);
+      corners[i + 4] = corner(i, cascade.split_far);
+    }
+    for (const auto &p : corners)
+      sum += hermes::vec3(p.x, p.y, p.z);
+    hermes::point3 center = hermes::point3() + sum / 8.f;
+    // the bounding sphere does not change with camera rotation
+    f32 radius = 0;
+    for (const auto &p : corners)
+      radius = std::max(radius, (p - center).length());
+    radius = std::ceil(radius * 16.f) / 16.f;
+    // snap the center to shadow map texels in light space
+    f32 texel = 2 * radius / size_.width;
+    auto center_ls = light_rotation(center);
+    center_ls.x = std::floor(center_ls.x / texel) * texel;
+    center_ls.y = std::floor(center_ls.y / texel) * texel;
+    center_ls.z = std::floor(center_ls.z / texel) * texel;
+    cascade.center = inv_light_rotation(center_ls);
+    cascade.radius = radius;
+    f32 depth = 2 * radius + depth_margin;
+    auto view = hermes::Transform::lookAt(cascade.center + direction * (radius + depth_margin),
+                                          cascade.center, up);
+    cascade.light_transform = hermes::Transform::ortho(-radius, radius, -radius, radius, -depth, depth) * view;
+  }
+}
+
+void CascadedShadowMap::render(const CasterCallback &static_casters, const CasterCallback &dynamic_casters) {
+  glEnable(GL_DEPTH_TEST);
+  // casters closer to the light than the cascade box are flattened onto it
+  glEnable(GL_DEPTH_CLAMP);
+  static_redraw_count_ = 0;
+  for (u32 i = 0; i < cascades_.size(); ++i) {
+    if (!static_casters) {
+      renderLayer(depth_map_, i, true, dynamic_casters);
+      continue;
+    }
+    bool cached = static_valid_[i] && sameFit(static_cascades_[i], cascades_[i]);
+    if (!cached) {
+      renderLayer(static_depth_map_, i, true, static_casters);
+      static_cascades_[i] = cascades_[i];
+      static_valid_[i] = true;
+      static_redraw_count_++;
+    }
+    // the final layer only needs to be touched if something changed
+    if (cached && !dynamic_casters && !dynamic_drawn_[i])
+      continue;
+    glCopyImageSubData(static_depth_map_.textureObjectId(), GL_TEXTURE_2D_ARRAY, 0, 0, 0, i,
+                       depth_map_.textureObjectId(), GL_TEXTURE_2D_ARRAY, 0, 0, 0, i,
+                       size_.width, size_.height, 1);
+    dynamic_drawn_[i] = static_cast<bool>(dynamic_casters);
+    if (dynamic_casters)
+      renderLayer(depth_map_, i, false, dynamic_casters);
+  }
+  glDisable(GL_DEPTH_CLAMP);
+  circe::gl::Framebuffer::disable();
+  CHECK_GL_ERRORS;
+}
+
+void CascadedShadowMap::renderLayer(const Texture &target, u32 layer, bool clear, const CasterCallback &f) {
+  depth_buffer_.enable();
+  glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, target.textureObjectId(), 0, layer);
+  glViewport(0, 0, size_.width, size_.height);
+  if (clear)
+    glClear(GL_DEPTH_BUFFER_BIT);
+  program_.use();
+  program_.setUniform("lightSpaceMatrix", cascades_[layer].light_transform);
+  program_.setUniform("model", hermes::Transform());
+  if (f)
+    f(program_, layer, cascades_[layer]);
+}
+
+void CascadedShadowMap::invalidateStaticCasters() {
+  std::fill(static_valid_.begin(), static_valid_.end(), false);
+}
+
+void CascadedShadowMap::invalidateStaticCasters(u32 cascade_index) {
+  if (cascade_index < static_valid_.size())
+    static_valid_[cascade_index] = false;
+}
+
+void CascadedShadowMap::bind(GLenum texture_unit) const {
+  depth_map_.bind(texture_unit);
+}
+
+void CascadedShadowMap::setUniforms(const Program &program, const std::string &name) const {
+  for (u32 i = 0; i < cascades_.size(); ++i) {
+    program.setUniform(name + "_transforms[" + std::to_string(i) + "]", cascades_[i].light_transform);
+    program.setUniform(name + "_splits[" + std::to_string(i) + "]", cascades_[i].split_far);
+  }
+}
+
+u32 CascadedShadowMap::cascadeCount() const {
+  return cascades_.size();
+}
+
+const std::vector<CascadedShadowMap::Cascade> &CascadedShadowMap::cascades() const {
+  return cascades_;
+}
+
+const Texture &CascadedShadowMap::depthMap() const {
+  return depth_map_;
+}
+
+u32 CascadedShadowMap::staticRedrawCount() const {
+  return static_redraw_count_;
+}
+
+}
@@ -0,0 +1,149 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file cascaded_shadow_map.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+
+#ifndef CIRCE_CIRCE_GL_GRAPHICS_CASCADED_SHADOW_MAP_H
+#define CIRCE_CIRCE_GL_GRAPHICS_CASCADED_SHADOW_MAP_H
+
+#include <circe/scene/light.h>
+#include <circe/scene/camera_interface.h>
+#include <circe/gl/io/framebuffer.h>
+#include <circe/gl/graphics/shader.h>
+#include <circe/gl/texture/texture.h>
+#include <functional>
+
+namespace circe::gl {
+
+/// Directional light shadows split into cascades along the camera view depth.
+/// Each cascade covers a slice [split_near, split_far] of the camera frustum
+/// with its own orthographic light projection, rendered into a layer of a
+/// depth texture array (GL_TEXTURE_2D_ARRAY, sample it with sampler2DArrayShadow
+/// or sampler2DArray).
+/// Cascades are fitted to the bounding sphere of their frustum slice, so
+/// their size does not change as the camera rotates, and their centers are
+/// snapped to shadow map texels, so edges do not shimmer as the camera moves.
+/// Casters are split into static and dynamic sets. The static casters of a
+/// cascade are rendered into a cache layer that is only refreshed when the
+/// light or the cascade fit changes, or when invalidateStaticCasters is called.
+/// Every frame, dynamic casters are drawn on top of a copy of the cached layer.
+/// \code{.cpp}
+///     CascadedShadowMap csm(4, {2048, 2048});
+///     csm.setLight(light);
+///     // every frame
+///     csm.update(camera);
+///     csm.render([&](const Program &program, u32 cascade_index, const auto &cascade) {
+///       for (auto &object : static_objects)
+///         if (cascade.intersects(object.bounds)) {
+///           program.setUniform("model", object.transform);
+///           object.draw();
+///         }
+///     }, draw_dynamic_objects);
+///     csm.bind(GL_TEXTURE1);
+/// \endcode
+class CascadedShadowMap {
+public:
+  struct Cascade {
+    /// \param bounds world space bounding box
+    /// \return true if bounds may cast shadows inside this cascade
+    [[nodiscard]] bool intersects(const hermes::bbox3 &bounds) const;
+
+    hermes::Transform light_transform; //!< world to light clip space
+    f32 split_near{0.f};               //!< view depth where the cascade starts
+    f32 split_far{0.f};                //!< view depth where the cascade ends
+    hermes::point3 center;             //!< (snapped) center of the slice bounding sphere
+    f32 radius{0.f};                   //!< radius of the slice bounding sphere
+  };
+  /// Draws the casters of a cascade
+  /// \param program depth program (uniform "model" holds the object transform)
+  /// \param cascade_index
+  /// \param cascade use it to cull casters outside the cascade
+  using CasterCallback = std::function<void(const Program &program, u32 cascade_index, const Cascade &cascade)>;
+  // ***********************************************************************
+  //                           CONSTRUCTORS
+  // ***********************************************************************
+  /// \param cascade_count number of cascades (layers of the depth texture array)
+  /// \param size resolution of each cascade
+  explicit CascadedShadowMap(u32 cascade_count = 4, const hermes::size2 &size = hermes::size2(2048, 2048));
+  ~CascadedShadowMap();
+  // ***********************************************************************
+  //                           METHODS
+  // ***********************************************************************
+  /// \param light directional light (light.direction points towards the light)
+  void setLight(const circe::Light &light);
+  /// Fits cascades to the camera frustum
+  /// \param camera
+  void update(const CameraInterface &camera);
+  /// Renders all cascades
+  /// \param static_casters (optional) casters that rarely change, cached
+  /// \param dynamic_casters (optional) casters drawn every frame
+  void render(const CasterCallback &static_casters, const CasterCallback &dynamic_casters = nullptr);
+  /// Forces static casters of all cascades to be drawn again on next render
+  void invalidateStaticCasters();
+  /// Forces static casters of a cascade to be drawn again on next render
+  /// \param cascade_index
+  void invalidateStaticCasters(u32 cascade_index);
+  /// Binds depth texture array
+  /// \param texture_unit (ex: GL_TEXTURE0)
+  void bind(GLenum texture_unit) const;
+  /// Sets uniforms <name>_transforms[i] and <name>_splits[i] (far split depths)
+  /// \param program
+  /// \param name uniform prefix
+  void setUniforms(const Program &program, const std::string &name = "cascade") const;
+  // ***********************************************************************
+  //                           PUBLIC FIELDS
+  // ***********************************************************************
+  /// \return
+  [[nodiscard]] u32 cascadeCount() const;
+  /// \return
+  [[nodiscard]] const std::vector<Cascade> &cascades() const;
+  /// \return depth texture array
+  [[nodiscard]] const Texture &depthMap() const;
+  /// \return number of cascades whose static casters were drawn on last render
+  [[nodiscard]] u32 staticRedrawCount() const;
+
+  f32 split_lambda{0.75f};   //!< blend between uniform (0) and logarithmic (1) splits
+  f32 max_distance{100.f};   //!< shadows end at this view depth (clamped to camera far)
+  f32 depth_margin{50.f};    //!< extra depth towards the light to catch off-slice casters
+private:
+  void renderLayer(const Texture &target, u32 layer, bool clear, const CasterCallback &f);
+
+  hermes::size2 size_;
+  Framebuffer depth_buffer_;
+  Texture depth_map_;
+  Texture static_depth_map_;
+  Program program_;
+  Light light_;
+  std::vector<Cascade> cascades_;
+  std::vector<Cascade> static_cascades_; //!< cascade fits of the cached static layers
+  std::vector<bool> static_valid_;
+  std::vector<bool> dynamic_drawn_; //!< the final layer holds dynamic casters
+  u32 static_redraw_count_{0};
+};
+
+}
+
+#endif //CIRCE_CIRCE_GL_GRAPHICS_CASCADED_SHADOW_MAP_H
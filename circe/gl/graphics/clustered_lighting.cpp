@@ -0,0 +1,240 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file clustered_lighting.cpp
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+
+#include <circe/gl/graphics/clustered_lighting.h>
+#include <hermes/common/debug.h>
+#include <algorithm>
+#include <cmath>
+
+namespace circe::gl {
+
+namespace {
+
+const char *cull_cs = "#version 430 core\n"
+                      "layout(local_size_x = 128) in;\n"
+                      "layout(std430, binding = 0) readonly buffer Lights { vec4 lights[]; };\n"
+                      "layout(std430, binding = 1) writeonly buffer Counts { uint counts[]; };\n"
+                      "layout(std430, binding = 2) writeonly buffer Indices { uint indices[]; };\n"
+                      "layout(std430, binding = 3) readonly buffer Bounds { vec4 bounds[]; };\n"
+                      "uniform mat4 view;\n"
+                      "uniform int light_count;\n"
+                      "uniform int cluster_count;\n"
+                      "uniform int max_lights;\n"
+                      "shared vec4 batch[128];\n"
+                      "void main() {\n"
+                      "  int cluster = int(gl_GlobalInvocationID.x);\n"
+                      "  bool active = cluster < cluster_count;\n"
+                      "  vec3 lower = active ? bounds[2 * cluster].xyz : vec3(0.0);\n"
+                      "  vec3 upper = active ? bounds[2 * cluster + 1].xyz : vec3(0.0);\n"
+                      "  int count = 0;\n"
+                      "  for (int first = 0; first < light_count; first += 128) {\n"
+                      // each invocation brings one light of the batch to view space
+                      "    int l = first + int(gl_LocalInvocationIndex);\n"
+                      "    if (l < light_count) {\n"
+                      "      vec4 light = lights[3 * l];\n"
+                      "      batch[gl_LocalInvocationIndex] = vec4((view * vec4(light.xyz, 1.0)).xyz, light.w);\n"
+                      "    }\n"
+                      "    barrier();\n"
+                      "    int n = min(128, light_count - first);\n"
+                      "    if (active)\n"
+                      "      for (int i = 0; i < n && count < max_lights; ++i) {\n"
+                      "        vec3 d = clamp(batch[i].xyz, lower, upper) - batch[i].xyz;\n"
+                      "        if (dot(d, d) <= batch[i].w * batch[i].w)\n"
+                      "          indices[cluster * max_lights + count++] = uint(first + i);\n"
+                      "      }\n"
+                      "    barrier();\n"
+                      "  }\n"
+                      "  if (active)\n"
+                      "    counts[cluster] = uint(count);\n"
+                      "}\n";
+
+}
+
+std::string ClusteredLighting::glsl() {
+  return "layout(std430, binding = 0) readonly buffer ClusterLights { vec4 cluster_lights[]; };\n"
+         "layout(std430, binding = 1) readonly buffer ClusterLightCounts { uint cluster_light_counts[]; };\n"
+         "layout(std430, binding = 2) readonly buffer ClusterLightIndices { uint cluster_light_indices[]; };\n"
+         "uniform ivec3 cluster_grid;\n"
+         "uniform vec2 cluster_tile_size;\n"
+         "uniform vec2 cluster_depth_params;\n"
+         "uniform int cluster_log_depth;\n"
+         "uniform int cluster_max_lights;\n"
+         "int clusterIndex(vec2 frag_coord, float view_depth) {\n"
+         "  ivec2 tile = clamp(ivec2(frag_coord / cluster_tile_size), ivec2(0), cluster_grid.xy - 1);\n"
+         "  float d = cluster_log_depth != 0 ? log(max(view_depth, 1e-6)) : view_depth;\n"
+         "  int slice = clamp(int(d * cluster_depth_params.x + cluster_depth_params.y), 0, cluster_grid.z - 1);\n"
+         "  return (slice * cluster_grid.y + tile.y) * cluster_grid.x + tile.x;\n"
+         "}\n"
+         "int clusterLightCount(int cluster) { return int(cluster_light_counts[cluster]); }\n"
+         "int clusterLight(int cluster, int i) {\n"
+         "  return int(cluster_light_indices[cluster * cluster_max_lights + i]);\n"
+         "}\n"
+         "vec3 clusterLightPosition(int light) { return cluster_lights[3 * light].xyz; }\n"
+         "float clusterLightRadius(int light) { return cluster_lights[3 * light].w; }\n"
+         "vec3 clusterLightColor(int light) { return cluster_lights[3 * light + 1].xyz; }\n"
+         "float clusterLightLinear(int light) { return cluster_lights[3 * light + 1].w; }\n"
+         "float clusterLightQuadratic(int light) { return cluster_lights[3 * light + 2].x; }\n";
+}
+
+ClusteredLighting::ClusteredLighting(u32 tiles_x, u32 tiles_y, u32 depth_slices, u32 max_lights_per_cluster)
+    : tiles_x_(std::max(1u, tiles_x)), tiles_y_(std::max(1u, tiles_y)),
+      depth_slices_(std::max(1u, depth_slices)), max_lights_per_cluster_(std::max(1u, max_lights_per_cluster)) {
+  for (auto *memory : {&lights_, &light_counts_, &light_indices_, &cluster_bounds_}) {
+    memory->setTarget(GL_SHADER_STORAGE_BUFFER);
+    memory->setUsage(GL_DYNAMIC_DRAW);
+  }
+}
+
+ClusteredLighting::~ClusteredLighting() = default;
+
+void ClusteredLighting::setLights(const std::vector<Light> &lights) {
+  light_count_ = lights.size();
+  if (lights.empty())
+    return;
+  std::vector<f32> data;
+  data.reserve(12 * lights.size());
+  for (const auto &light : lights) {
+    data.insert(data.end(), {light.position.x, light.position.y, light.position.z, light.radius,
+                             light.color.x, light.color.y, light.color.z, light.linear,
+                             light.quadratic, 0.f, 0.f, 0.f});
+  }
+  lights_.reserve(data.size() * sizeof(f32));
+  lights_.copy(data.data(), data.size() * sizeof(f32));
+}
+
+void ClusteredLighting::updateBounds(const CameraInterface &camera, const hermes::size2 &viewport_size) {
+  auto projection = camera.getProjectionTransform();
+  if (!bounds_dirty_ && sameTransform(projection, projection_) &&
+      viewport_size.width == viewport_size_.width && viewport_size.height == viewport_size_.height)
+    return;
+  projection_ = projection;
+  viewport_size_ = viewport_size;
+  bounds_dirty_ = false;
+  // screen tiles cover a whole number of pixels
+  tile_size_ = hermes::vec2(std::ceil(static_cast<f32>(viewport_size.width) / tiles_x_),
+                            std::ceil(static_cast<f32>(viewport_size.height) / tiles_y_));
+  f32 near = camera.getNear();
+  f32 far = camera.getFar();
+  log_depth_ = near > 0.f;
+  if (log_depth_) {
+    f32 scale = depth_slices_ / std::log(far / near);
+    depth_params_ = hermes::vec2(scale, -std::log(near) * scale);
+  } else {
+    f32 scale = depth_slices_ / (far - near);
+    depth_params_ = hermes::vec2(scale, -near * scale);
+  }
+  auto slice_depth = [&](u32 k) -> f32 {
+    f32 t = static_cast<f32>(k) / depth_slices_;
+    return log_depth_ ? near * std::pow(far / near, t) : near + (far - near) * t;
+  };
+  // tile corners are unprojected at two depths, the view ray through each
+  // corner works for both perspective and orthographic projections
+  auto inverse_projection = hermes::inverse(projection);
+  auto ndc = [&](f32 pixel, f32 size) { return std::min(1.f, 2.f * pixel / size - 1.f); };
+  std::vector<f32> bounds;
+  bounds.reserve(clusterCount() * 8);
+  for (u32 k = 0; k < depth_slices_; ++k) {
+    f32 depths[2] = {slice_depth(k), slice_depth(k + 1)};
+    for (u32 j = 0; j < tiles_y_; ++j)
+      for (u32 i = 0; i < tiles_x_; ++i) {
+        hermes::point3 lower(1e30f, 1e30f, 1e30f), upper(-1e30f, -1e30f, -1e30f);
+        for (u32 c = 0; c < 4; ++c) {
+          f32 x = ndc((i + (c & 1)) * tile_size_.x, viewport_size.width);
+          f32 y = ndc((j + (c >> 1)) * tile_size_.y, viewport_size.height);
+          auto a = inverse_projection * hermes::point3(x, y, 0.25f);
+          auto b = inverse_projection * hermes::point3(x, y, 0.75f);
+          for (auto depth : depths) {
+            // view space looks down -z
+            f32 t = (-depth - a.z) / (b.z - a.z);
+            hermes::point3 p(a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t, -depth);
+            lower = hermes::point3(std::min(lower.x, p.x), std::min(lower.y, p.y), std::min(lower.z, p.z));
+            upper = hermes::point3(std::max(upper.x, p.x), std::max(upper.y, p.y), std::max(upper.z, p.z));
+          }
+        }
+        bounds.insert(bounds.end(), {lower.x, lower.y, lower.z, 0.f, upper.x, upper.y, upper.z, 0.f});
+      }
+  }
+  cluster_bounds_.reserve(bounds.size() * sizeof(f32));
+  cluster_bounds_.copy(bounds.data(), bounds.size() * sizeof(f32));
+}
+
+bool ClusteredLighting::cull(const CameraInterface &camera, const hermes::size2 &viewport_size) {
+  if (!cull_program_.good()) {
+    cull_program_.attach(Shader(GL_COMPUTE_SHADER, cull_cs));
+    if (!cull_program_.link()) {
+      HERMES_LOG_ERROR("failed to compile clustered lighting cull shader: {}", cull_program_.err);
+      return false;
+    }
+  }
+  updateBounds(camera, viewport_size);
+  light_counts_.reserve(clusterCount() * sizeof(u32));
+  light_indices_.reserve(static_cast<u64>(clusterCount()) * max_lights_per_cluster_ * sizeof(u32));
+  if (!lights_.allocated())
+    lights_.reserve(12 * sizeof(f32));
+  cull_program_.use();
+  cull_program_.setUniform("view", camera.getViewTransform());
+  cull_program_.setUniform("light_count", static_cast<int>(light_count_));
+  cull_program_.setUniform("cluster_count", static_cast<int>(clusterCount()));
+  cull_program_.setUniform("max_lights", static_cast<int>(max_lights_per_cluster_));
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, lights_.id());
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, light_counts_.id());
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, light_indices_.id());
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, cluster_bounds_.id());
+  glDispatchCompute((clusterCount() + 127) / 128, 1, 1);
+  glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+  CHECK_GL_ERRORS;
+  return true;
+}
+
+void ClusteredLighting::bind() const {
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, lights_.id());
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, light_counts_.id());
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, light_indices_.id());
+}
+
+void ClusteredLighting::setUniforms(const Program &program) const {
+  glUniform3i(glGetUniformLocation(program.id(), "cluster_grid"), tiles_x_, tiles_y_, depth_slices_);
+  program.setUniform("cluster_tile_size", tile_size_);
+  program.setUniform("cluster_depth_params", depth_params_);
+  program.setUniform("cluster_log_depth", log_depth_ ? 1 : 0);
+  program.setUniform("cluster_max_lights", static_cast<int>(max_lights_per_cluster_));
+}
+
+u32 ClusteredLighting::lightCount() const {
+  return light_count_;
+}
+
+u32 ClusteredLighting::clusterCount() const {
+  return tiles_x_ * tiles_y_ * depth_slices_;
+}
+
+u32 ClusteredLighting::maxLightsPerCluster() const {
+  return max_lights_per_cluster_;
+}
+
+}
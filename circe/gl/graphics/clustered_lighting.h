@@ -0,0 +1,148 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file clustered_lighting.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+
+#ifndef CIRCE_CIRCE_GL_GRAPHICS_CLUSTERED_LIGHTING_H
+#define CIRCE_CIRCE_GL_GRAPHICS_CLUSTERED_LIGHTING_H
+
+#include <circe/gl/graphics/shader.h>
+#include <circe/gl/storage/device_memory.h>
+#include <circe/scene/camera_interface.h>
+
+namespace circe::gl {
+
+/// Clustered light culling for deferred (or forward) shading of many point
+/// lights.
+/// The view frustum is split into a froxel grid: tiles_x x tiles_y screen
+/// tiles and depth_slices depth slices (exponential in view depth when the
+/// near plane is positive). Cluster bounds are view space AABBs computed from
+/// the camera projection, they are only rebuilt when the projection or the
+/// viewport changes.
+/// A compute pass tests every light sphere against every cluster (lights are
+/// streamed through shared memory in batches) and writes the light list of
+/// each cluster into shader storage buffers. Shaders then find the cluster of
+/// a pixel from its window coordinates and view depth and only loop over the
+/// lights of that cluster.
+/// Storage buffer bindings used by cull and glsl():
+///   - 0: lights (3 vec4 per light)
+///   - 1: light count per cluster
+///   - 2: light indices, max_lights_per_cluster slots per cluster
+///   - 3: cluster bounds (cull pass only)
+/// \code{.cpp}
+///     ClusteredLighting lighting;
+///     lighting.setLights(lights);
+///     // every frame
+///     lighting.cull(camera, viewport_size);
+///     program.use();
+///     lighting.setUniforms(program);
+///     lighting.bind();
+///     // glsl: ClusteredLighting::glsl() declarations
+///     //  int cluster = clusterIndex(gl_FragCoord.xy, view_depth);
+///     //  for (int i = 0; i < clusterLightCount(cluster); ++i) {
+///     //    int light = clusterLight(cluster, i);
+///     //    clusterLightPosition(light) ...
+/// \endcode
+class ClusteredLighting {
+public:
+  /// Point light data
+  struct Light {
+    hermes::point3 position;
+    f32 radius{1.f};         //!< influence radius (world units)
+    hermes::vec3 color{1.f, 1.f, 1.f};
+    f32 linear{0.7f};        //!< linear attenuation factor
+    f32 quadratic{1.8f};     //!< quadratic attenuation factor
+  };
+  // ***********************************************************************
+  //                           STATIC METHODS
+  // ***********************************************************************
+  /// \return glsl declarations (buffers, uniforms and helper functions) used
+  /// to read cluster light lists
+  static std::string glsl();
+  // ***********************************************************************
+  //                           CONSTRUCTORS
+  // ***********************************************************************
+  /// \param tiles_x number of screen tiles along x
+  /// \param tiles_y number of screen tiles along y
+  /// \param depth_slices number of depth slices
+  /// \param max_lights_per_cluster light list capacity of each cluster
+  explicit ClusteredLighting(u32 tiles_x = 16, u32 tiles_y = 9, u32 depth_slices = 24,
+                             u32 max_lights_per_cluster = 128);
+  ~ClusteredLighting();
+  // ***********************************************************************
+  //                           METHODS
+  // ***********************************************************************
+  /// Uploads lights (positions in world space)
+  /// \param lights
+  void setLights(const std::vector<Light> &lights);
+  /// Assigns lights to clusters
+  /// \param camera
+  /// \param viewport_size viewport size in pixels
+  /// \return false if the cull shader could not be compiled
+  bool cull(const CameraInterface &camera, const hermes::size2 &viewport_size);
+  /// Binds light and cluster buffers (bindings 0, 1 and 2)
+  void bind() const;
+  /// Sets the uniforms declared in glsl()
+  /// \param program (must be in use)
+  void setUniforms(const Program &program) const;
+  // ***********************************************************************
+  //                           FIELDS
+  // ***********************************************************************
+  /// \return number of lights
+  [[nodiscard]] u32 lightCount() const;
+  /// \return number of clusters (tiles_x * tiles_y * depth_slices)
+  [[nodiscard]] u32 clusterCount() const;
+  /// \return light list capacity of each cluster
+  [[nodiscard]] u32 maxLightsPerCluster() const;
+
+private:
+  /// Rebuilds cluster bounds if the projection or the viewport changed
+  void updateBounds(const CameraInterface &camera, const hermes::size2 &viewport_size);
+
+  u32 tiles_x_{0};
+  u32 tiles_y_{0};
+  u32 depth_slices_{0};
+  u32 max_lights_per_cluster_{0};
+  u32 light_count_{0};
+  // shading parameters
+  hermes::vec2 tile_size_;
+  hermes::vec2 depth_params_; //!< slice = depth * x + y (log(depth) if log_depth_)
+  bool log_depth_{true};
+  // bounds cache key
+  hermes::Transform projection_;
+  hermes::size2 viewport_size_;
+  bool bounds_dirty_{true};
+
+  Program cull_program_;
+  DeviceMemory lights_;
+  DeviceMemory light_counts_;
+  DeviceMemory light_indices_;
+  DeviceMemory cluster_bounds_;
+};
+
+}
+
+#endif //CIRCE_CIRCE_GL_GRAPHICS_CLUSTERED_LIGHTING_H
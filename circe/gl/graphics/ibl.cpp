@@ -30,9 +30,119 @@
 #include <circe/gl/scene/scene_model.h>
 #include <circe/gl/graphics/shader.h>
 #include <circe/scene/shapes.h>
+#include <hermes/common/debug.h>
+#include <algorithm>
+#include <fstream>
 
 namespace circe::gl {
 
+namespace {
+
+/// GGX importance sampling helpers shared by the compute shaders
+const char *ggx_sampling_glsl =
+    "const float PI = 3.14159265359;\n"
+    "float DistributionGGX(float NdotH, float roughness) {\n"
+    "  float a = roughness * roughness;\n"
+    "  float a2 = a * a;\n"
+    "  float denom = NdotH * NdotH * (a2 - 1.0) + 1.0;\n"
+    "  return a2 / (PI * denom * denom);\n"
+    "}\n"
+    "float RadicalInverse_VdC(uint bits) {\n"
+    "  bits = (bits << 16u) | (bits >> 16u);\n"
+    "  bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);\n"
+    "  bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);\n"
+    "  bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);\n"
+    "  bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);\n"
+    "  return float(bits) * 2.3283064365386963e-10;\n"
+    "}\n"
+    "vec2 Hammersley(uint i, uint N) {\n"
+    "  return vec2(float(i) / float(N), RadicalInverse_VdC(i));\n"
+    "}\n"
+    "vec3 ImportanceSampleGGX(vec2 Xi, vec3 N, float roughness) {\n"
+    "  float a = roughness * roughness;\n"
+    "  float phi = 2.0 * PI * Xi.x;\n"
+    "  float cosTheta = sqrt((1.0 - Xi.y) / (1.0 + (a * a - 1.0) * Xi.y));\n"
+    "  float sinTheta = sqrt(1.0 - cosTheta * cosTheta);\n"
+    "  vec3 H = vec3(cos(phi) * sinTheta, sin(phi) * sinTheta, cosTheta);\n"
+    "  vec3 up = abs(N.z) < 0.999 ? vec3(0.0, 0.0, 1.0) : vec3(1.0, 0.0, 0.0);\n"
+    "  vec3 tangent = normalize(cross(up, N));\n"
+    "  vec3 bitangent = cross(N, tangent);\n"
+    "  return normalize(tangent * H.x + bitangent * H.y + N * H.z);\n"
+    "}\n";
+
+/// Direction of a cubemap texel, uv in [-1,1] (GL face order and orientation)
+const char *cube_direction_glsl =
+    "vec3 cubeDirection(uint face, vec2 uv) {\n"
+    "  switch(face) {\n"
+    "  case 0: return normalize(vec3(1.0, -uv.y, -uv.x));\n"
+    "  case 1: return normalize(vec3(-1.0, -uv.y, uv.x));\n"
+    "  case 2: return normalize(vec3(uv.x, 1.0, uv.y));\n"
+    "  case 3: return normalize(vec3(uv.x, -1.0, -uv.y));\n"
+    "  case 4: return normalize(vec3(uv.x, -uv.y, 1.0));\n"
+    "  default: return normalize(vec3(-uv.x, -uv.y, -1.0));\n"
+    "  }\n"
+    "}\n";
+
+bool linkComputeProgram(Program &program, const std::string &source, const char *name) {
+  program.attach(Shader(GL_COMPUTE_SHADER, source));
+  if (!program.link()) {
+    HERMES_LOG_ERROR("failed to compile {} shader: {}", name, program.err);
+    return false;
+  }
+  return true;
+}
+
+/// Allocates a (mipmapped) texture suitable for image load/store
+Texture storageTexture(GLenum target, GLint internal_format, GLenum format,
+                       const hermes::size2 &resolution, u32 mip_levels) {
+  Texture texture;
+  texture.setTarget(target);
+  texture.setInternalFormat(internal_format);
+  texture.setFormat(format);
+  texture.setType(GL_FLOAT);
+  texture.resize(resolution);
+  texture.bind();
+  Texture::View view(target);
+  if (mip_levels > 1) {
+    view[GL_TEXTURE_MIN_FILTER] = GL_LINEAR_MIPMAP_LINEAR;
+    view[GL_TEXTURE_MAX_LEVEL] = mip_levels - 1;
+  }
+  view.apply();
+  if (mip_levels > 1)
+    texture.generateMipmap();
+  return texture;
+}
+
+u64 hashBytes(const void *data, size_t size, u64 hash = 14695981039346656037ull) {
+  // FNV-1a
+  const auto *bytes = reinterpret_cast<const u8 *>(data);
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= bytes[i];
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+/// IBL cache file layout:
+///   header | sh (9 rgb f32) | prefiltered mips (6 faces per mip, rgba f16) | brdf lut (rg f16)
+struct IBLCacheHeader {
+  char magic[4]{'C', 'I', 'B', 'L'};
+  u32 version{1};
+  u64 key{0};
+  u32 irradiance_resolution{0};
+  u32 prefilter_resolution{0};
+  u32 prefilter_mip_levels{0};
+  u32 brdf_width{0};
+  u32 brdf_height{0};
+};
+
+size_t cubeMipSize(u32 resolution, u32 mip) {
+  size_t n = std::max(1u, resolution >> mip);
+  return n * n * 4 * sizeof(u16);
+}
+
+} // namespace
+
 void renderToCube(Framebuffer &framebuffer,
                   Program &program,
                   const Texture &envmap,
@@ -163,6 +273,7 @@ Texture IBL::preFilteredEnvironmentMap(const Texture &input, const hermes::size2
                    "in vec3 localPos;                                                                               \n"
                    "uniform samplerCube environmentMap;                                                             \n"
                    "uniform float roughness;                                                                        \n"
+                   "uniform float resolution; // resolution of source cubemap (per face)                            \n"
                    "const float PI = 3.14159265359;                                                                 \n"
                    "float DistributionGGX(vec3 N, vec3 H, float roughness) {                                        \n"
                    "    float a = roughness*roughness;                                                              \n"
@@ -220,7 +331,6 @@ Texture IBL::preFilteredEnvironmentMap(const Texture &input, const hermes::size2
                    "            float NdotH = max(dot(N, H), 0.0);                                                  \n"
                    "            float HdotV = max(dot(H, V), 0.0);                                                  \n"
                    "            float pdf = D * NdotH / (4.0 * HdotV) + 0.0001;                                     \n"
-                   "            float resolution = 512.0; // resolution of source cubemap (per face)                \n"
                    "            float saTexel  = 4.0 * PI / (6.0 * resolution * resolution);                        \n"
                    "            float saSample = 1.0 / (float(SAMPLE_COUNT) * pdf + 0.0001);                        \n"
                    "            float mipLevel = roughness == 0.0 ? 0.0 : 0.5 * log2(saSample / saTexel);           \n"
@@ -243,11 +353,12 @@ Texture IBL::preFilteredEnvironmentMap(const Texture &input, const hermes::size2
   glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
   unsigned int max_mip_levels = 5;
   for (unsigned int mip = 0; mip < max_mip_levels; ++mip) {
-    u32 mip_width = 128 * std::pow(0.5, mip);
-    u32 mip_height = 128 * std::pow(0.5, mip);
+    u32 mip_width = resolution.width * std::pow(0.5, mip);
+    u32 mip_height = resolution.height * std::pow(0.5, mip);
     f32 roughness = (float) mip / (float) (max_mip_levels - 1);
     program.use();
     program.setUniform("roughness", roughness);
+    program.setUniform("resolution", static_cast<f32>(input.size().width));
 
     renderToCube(framebuffer, program, input, prefilter_map, mip, {mip_width, mip_height});
   }
@@ -377,4 +488,335 @@ Texture IBL::brdfIntegrationMap(const hermes::size2 &resolution) {
   return brdf_i_map;
 }
 
+std::array<hermes::vec3, 9> IBL::irradianceSH(const Texture &texture) {
+  std::array<hermes::vec3, 9> sh{};
+  // samples per face edge, taken from the mip level closest to this resolution
+  const u32 sample_resolution = 64;
+  const u32 group_size = 16;
+  std::string cs = std::string("#version 430 core\n"
+                               "layout(local_size_x = 16, local_size_y = 16) in;\n"
+                               "layout(binding = 0) uniform samplerCube environmentMap;\n"
+                               "uniform int sample_resolution;\n"
+                               "uniform float source_lod;\n"
+                               "layout(std430, binding = 0) writeonly buffer Partials { vec4 partials[]; };\n"
+                               "shared vec4 s_data[256];\n") + cube_direction_glsl +
+      "float basis(int k, vec3 d) {\n"
+      "  switch(k) {\n"
+      "  case 0: return 0.282095;\n"
+      "  case 1: return 0.488603 * d.y;\n"
+      "  case 2: return 0.488603 * d.z;\n"
+      "  case 3: return 0.488603 * d.x;\n"
+      "  case 4: return 1.092548 * d.x * d.y;\n"
+      "  case 5: return 1.092548 * d.y * d.z;\n"
+      "  case 6: return 0.315392 * (3.0 * d.z * d.z - 1.0);\n"
+      "  case 7: return 1.092548 * d.x * d.z;\n"
+      "  default: return 0.546274 * (d.x * d.x - d.y * d.y);\n"
+      "  }\n"
+      "}\n"
+      "void main() {\n"
+      "  uint face = gl_WorkGroupID.z;\n"
+      "  vec2 uv = (vec2(gl_GlobalInvocationID.xy) + 0.5) / float(sample_resolution) * 2.0 - 1.0;\n"
+      "  vec3 d = cubeDirection(face, uv);\n"
+      "  // solid angle of the sample\n"
+      "  float w = 4.0 / (float(sample_resolution * sample_resolution) * pow(1.0 + dot(uv, uv), 1.5));\n"
+      "  vec3 radiance = textureLod(environmentMap, d, source_lod).rgb;\n"
+      "  uint group = (gl_WorkGroupID.z * gl_NumWorkGroups.y + gl_WorkGroupID.y) * gl_NumWorkGroups.x\n"
+      "               + gl_WorkGroupID.x;\n"
+      "  for (int k = 0; k < 9; ++k) {\n"
+      "    s_data[gl_LocalInvocationIndex] = vec4(radiance * basis(k, d) * w, w);\n"
+      "    barrier();\n"
+      "    for (uint stride = 128u; stride > 0u; stride >>= 1u) {\n"
+      "      if (gl_LocalInvocationIndex < stride)\n"
+      "        s_data[gl_LocalInvocationIndex] += s_data[gl_LocalInvocationIndex + stride];\n"
+      "      barrier();\n"
+      "    }\n"
+      "    if (gl_LocalInvocationIndex == 0u)\n"
+      "      partials[group * 9u + uint(k)] = s_data[0];\n"
+      "    barrier();\n"
+      "  }\n"
+      "}";
+  Program program;
+  if (!linkComputeProgram(program, cs, "IBL::irradianceSH"))
+    return sh;
+  u32 group_count = sample_resolution / group_size;
+  u32 partial_count = group_count * group_count * 6 * 9;
+  GLuint ssbo = 0;
+  glGenBuffers(1, &ssbo);
+  glBindBuffer(GL_SHADER_STORAGE_BUFFER, ssbo);
+  glBufferData(GL_SHADER_STORAGE_BUFFER, partial_count * sizeof(hermes::vec4), nullptr, GL_STREAM_READ);
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, ssbo);
+  texture.bind(GL_TEXTURE0);
+  program.use();
+  program.setUniform("environmentMap", 0);
+  program.setUniform("sample_resolution", static_cast<int>(sample_resolution));
+  program.setUniform("source_lod", std::max(0.f, std::log2(static_cast<f32>(texture.size().width) /
+      sample_resolution)));
+  glDispatchCompute(group_count, group_count, 6);
+  glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+  std::vector<hermes::vec4> partials(partial_count);
+  glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, partial_count * sizeof(hermes::vec4), partials.data());
+  glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+  glDeleteBuffers(1, &ssbo);
+  CHECK_GL_ERRORS;
+  // sum partials (in double to keep precision for large sample counts)
+  f64 coefficients[9][4] = {};
+  for (u32 i = 0; i < partial_count; ++i)
+    for (int c = 0; c < 4; ++c)
+      coefficients[i % 9][c] += partials[i][c];
+  // normalize by the total solid angle and convolve with the clamped cosine,
+  // scaled by 1/pi as the irradiance map
+  const f64 band_factor[3] = {1.0, 2.0 / 3.0, 1.0 / 4.0};
+  const f64 total_weight = coefficients[0][3];
+  const f64 pi = 3.14159265358979323846;
+  for (int k = 0; k < 9; ++k) {
+    f64 factor = (total_weight > 0 ? 4 * pi / total_weight : 0) *
+        band_factor[k == 0 ? 0 : (k < 4 ? 1 : 2)];
+    sh[k] = hermes::vec3(coefficients[k][0] * factor, coefficients[k][1] * factor, coefficients[k][2] * factor);
+  }
+  return sh;
+}
+
+Texture IBL::irradianceMapFromSH(const std::array<hermes::vec3, 9> &sh, const hermes::size2 &resolution) {
+  std::string cs = std::string("#version 430 core\n"
+                               "layout(local_size_x = 8, local_size_y = 8) in;\n"
+                               "layout(binding = 0, rgba16f) uniform writeonly imageCube irradianceMap;\n"
+                               "uniform vec3 sh[9];\n"
+                               "uniform vec2 resolution;\n") + cube_direction_glsl +
+      "void main() {\n"
+      "  if (any(greaterThanEqual(gl_GlobalInvocationID.xy, uvec2(resolution))))\n"
+      "    return;\n"
+      "  vec2 uv = (vec2(gl_GlobalInvocationID.xy) + 0.5) / vec2(resolution) * 2.0 - 1.0;\n"
+      "  vec3 d = cubeDirection(gl_GlobalInvocationID.z, uv);\n"
+      "  vec3 e = sh[0] * 0.282095\n"
+      "         + sh[1] * 0.488603 * d.y + sh[2] * 0.488603 * d.z + sh[3] * 0.488603 * d.x\n"
+      "         + sh[4] * 1.092548 * d.x * d.y + sh[5] * 1.092548 * d.y * d.z\n"
+      "         + sh[6] * 0.315392 * (3.0 * d.z * d.z - 1.0) + sh[7] * 1.092548 * d.x * d.z\n"
+      "         + sh[8] * 0.546274 * (d.x * d.x - d.y * d.y);\n"
+      "  imageStore(irradianceMap, ivec3(gl_GlobalInvocationID), vec4(max(e, vec3(0.0)), 1.0));\n"
+      "}";
+  Program program;
+  if (!linkComputeProgram(program, cs, "IBL::irradianceMapFromSH"))
+    return {};
+  auto imap = storageTexture(GL_TEXTURE_CUBE_MAP, GL_RGBA16F, GL_RGBA, resolution, 1);
+  program.use();
+  for (u32 k = 0; k < 9; ++k)
+    program.setUniform("sh[" + std::to_string(k) + "]", sh[k]);
+  program.setUniform("resolution", hermes::vec2(resolution.width, resolution.height));
+  glBindImageTexture(0, imap.textureObjectId(), 0, GL_TRUE, 0, GL_WRITE_ONLY, GL_RGBA16F);
+  glDispatchCompute((resolution.width + 7) / 8, (resolution.height + 7) / 8, 6);
+  glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT | GL_TEXTURE_UPDATE_BARRIER_BIT);
+  CHECK_GL_ERRORS;
+  return imap;
+}
+
+Texture IBL::computePreFilteredEnvironmentMap(const Texture &texture, const hermes::size2 &resolution,
+                                              u32 mip_levels) {
+  std::string cs = std::string("#version 430 core\n"
+                               "layout(local_size_x = 8, local_size_y = 8) in;\n"
+                               "layout(binding = 0) uniform samplerCube environmentMap;\n"
+                               "layout(binding = 0, rgba16f) uniform writeonly imageCube prefilterMap;\n"
+                               "uniform float roughness;\n"
+                               "uniform float resolution; // resolution of source cubemap (per face)\n"
+                               "uniform vec2 mip_resolution;\n")
+      + ggx_sampling_glsl + cube_direction_glsl +
+      "void main() {\n"
+      "  if (any(greaterThanEqual(gl_GlobalInvocationID.xy, uvec2(mip_resolution))))\n"
+      "    return;\n"
+      "  vec2 uv = (vec2(gl_GlobalInvocationID.xy) + 0.5) / vec2(mip_resolution) * 2.0 - 1.0;\n"
+      "  vec3 N = cubeDirection(gl_GlobalInvocationID.z, uv);\n"
+      "  vec3 V = N;\n"
+      "  const uint SAMPLE_COUNT = 1024u;\n"
+      "  float totalWeight = 0.0;\n"
+      "  vec3 prefilteredColor = vec3(0.0);\n"
+      "  float saTexel = 4.0 * PI / (6.0 * resolution * resolution);\n"
+      "  for (uint i = 0u; i < SAMPLE_COUNT; ++i) {\n"
+      "    vec3 H = ImportanceSampleGGX(Hammersley(i, SAMPLE_COUNT), N, roughness);\n"
+      "    vec3 L = normalize(2.0 * dot(V, H) * H - V);\n"
+      "    float NdotL = max(dot(N, L), 0.0);\n"
+      "    if (NdotL > 0.0) {\n"
+      "      float NdotH = max(dot(N, H), 0.0);\n"
+      "      float HdotV = max(dot(H, V), 0.0);\n"
+      "      float pdf = DistributionGGX(NdotH, roughness) * NdotH / (4.0 * HdotV) + 0.0001;\n"
+      "      float saSample = 1.0 / (float(SAMPLE_COUNT) * pdf + 0.0001);\n"
+      "      float mipLevel = roughness == 0.0 ? 0.0 : 0.5 * log2(saSample / saTexel);\n"
+      "      prefilteredColor += textureLod(environmentMap, L, mipLevel).rgb * NdotL;\n"
+      "      totalWeight += NdotL;\n"
+      "    }\n"
+      "  }\n"
+      "  imageStore(prefilterMap, ivec3(gl_GlobalInvocationID), vec4(prefilteredColor / totalWeight, 1.0));\n"
+      "}";
+  Program program;
+  if (!linkComputeProgram(program, cs, "IBL::computePreFilteredEnvironmentMap"))
+    return {};
+  mip_levels = std::max(1u, mip_levels);
+  auto prefilter_map = storageTexture(GL_TEXTURE_CUBE_MAP, GL_RGBA16F, GL_RGBA, resolution, mip_levels);
+  glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
+  texture.bind(GL_TEXTURE0);
+  program.use();
+  program.setUniform("environmentMap", 0);
+  program.setUniform("resolution", static_cast<f32>(texture.size().width));
+  for (u32 mip = 0; mip < mip_levels; ++mip) {
+    u32 mip_width = std::max(1u, resolution.width >> mip);
+    u32 mip_height = std::max(1u, resolution.height >> mip);
+    program.setUniform("roughness", mip_levels > 1 ? (f32) mip / (f32) (mip_levels - 1) : 0.f);
+    program.setUniform("mip_resolution", hermes::vec2(mip_width, mip_height));
+    glBindImageTexture(0, prefilter_map.textureObjectId(), mip, GL_TRUE, 0, GL_WRITE_ONLY, GL_RGBA16F);
+    glDispatchCompute((mip_width + 7) / 8, (mip_height + 7) / 8, 6);
+  }
+  glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT | GL_TEXTURE_UPDATE_BARRIER_BIT);
+  CHECK_GL_ERRORS;
+  return prefilter_map;
+}
+
+Texture IBL::computeBrdfIntegrationMap(const hermes::size2 &resolution) {
+  std::string cs = std::string("#version 430 core\n"
+                               "layout(local_size_x = 8, local_size_y = 8) in;\n"
+                               "layout(binding = 0, rg16f) uniform writeonly image2D brdfMap;\n"
+                               "uniform vec2 resolution;\n") + ggx_sampling_glsl +
+      "float GeometrySchlickGGX(float NdotV, float roughness) {\n"
+      "  float k = (roughness * roughness) / 2.0;\n"
+      "  return NdotV / (NdotV * (1.0 - k) + k);\n"
+      "}\n"
+      "void main() {\n"
+      "  if (any(greaterThanEqual(gl_GlobalInvocationID.xy, uvec2(resolution))))\n"
+      "    return;\n"
+      "  vec2 t = (vec2(gl_GlobalInvocationID.xy) + 0.5) / vec2(resolution);\n"
+      "  float NdotV = t.x;\n"
+      "  float roughness = t.y;\n"
+      "  vec3 V = vec3(sqrt(1.0 - NdotV * NdotV), 0.0, NdotV);\n"
+      "  vec3 N = vec3(0.0, 0.0, 1.0);\n"
+      "  float A = 0.0;\n"
+      "  float B = 0.0;\n"
+      "  const uint SAMPLE_COUNT = 1024u;\n"
+      "  for (uint i = 0u; i < SAMPLE_COUNT; ++i) {\n"
+      "    vec3 H = ImportanceSampleGGX(Hammersley(i, SAMPLE_COUNT), N, roughness);\n"
+      "    vec3 L = normalize(2.0 * dot(V, H) * H - V);\n"
+      "    float NdotL = max(L.z, 0.0);\n"
+      "    float NdotH = max(H.z, 0.0);\n"
+      "    float VdotH = max(dot(V, H), 0.0);\n"
+      "    if (NdotL > 0.0) {\n"
+      "      float G = GeometrySchlickGGX(NdotV, roughness) * GeometrySchlickGGX(NdotL, roughness);\n"
+      "      float G_Vis = (G * VdotH) / (NdotH * NdotV);\n"
+      "      float Fc = pow(1.0 - VdotH, 5.0);\n"
+      "      A += (1.0 - Fc) * G_Vis;\n"
+      "      B += Fc * G_Vis;\n"
+      "    }\n"
+      "  }\n"
+      "  imageStore(brdfMap, ivec2(gl_GlobalInvocationID.xy), vec4(A, B, 0.0, 0.0) / float(SAMPLE_COUNT));\n"
+      "}";
+  Program program;
+  if (!linkComputeProgram(program, cs, "IBL::computeBrdfIntegrationMap"))
+    return {};
+  auto brdf_map = storageTexture(GL_TEXTURE_2D, GL_RG16F, GL_RG, resolution, 1);
+  program.use();
+  program.setUniform("resolution", hermes::vec2(resolution.width, resolution.height));
+  glBindImageTexture(0, brdf_map.textureObjectId(), 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_RG16F);
+  glDispatchCompute((resolution.width + 7) / 8, (resolution.height + 7) / 8, 1);
+  glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT | GL_TEXTURE_UPDATE_BARRIER_BIT);
+  CHECK_GL_ERRORS;
+  return brdf_map;
+}
+
+IBL IBL::fromFile(const hermes::Path &path) {
+  return fromFile(path, Options());
+}
+
+IBL IBL::fromFile(const hermes::Path &path, const Options &options, const hermes::Path &cache_path) {
+  IBL ibl;
+  auto source = hermes::FileSystem::readBinaryFile(path.fullName().c_str());
+  if (source.empty()) {
+    HERMES_LOG_WARNING("could not read environment file {}", path.fullName());
+    return ibl;
+  }
+  ibl.environment_map = Texture::fromFile(path, options.input_options, circe::texture_options::cubemap);
+  // textureLod based filtering needs the full mip chain of the source
+  ibl.environment_map.bind();
+  Texture::View view(GL_TEXTURE_CUBE_MAP);
+  view[GL_TEXTURE_MIN_FILTER] = GL_LINEAR_MIPMAP_LINEAR;
+  view.apply();
+  ibl.environment_map.generateMipmap();
+  // cache key: source content + everything that changes the output
+  IBLCacheHeader header;
+  header.irradiance_resolution = options.irradiance_resolution.width;
+  header.prefilter_resolution = options.prefilter_resolution.width;
+  header.prefilter_mip_levels = std::max(1u, options.prefilter_mip_levels);
+  header.brdf_width = options.brdf_resolution.width;
+  header.brdf_height = options.brdf_resolution.height;
+  u64 key = hashBytes(source.data(), source.size());
+  auto input_options = static_cast<u32>(options.input_options);
+  key = hashBytes(&input_options, sizeof(u32), key);
+  key = hashBytes(&header.irradiance_resolution, sizeof(u32) * 5, key);
+  header.key = key;
+  std::string cache_file = cache_path.fullName().empty() ? path.fullName() + ".ibl" : cache_path.fullName();
+  const size_t brdf_size = header.brdf_width * header.brdf_height * 2 * sizeof(u16);
+  // try cache
+  std::ifstream in(cache_file, std::ios::binary);
+  if (in.good()) {
+    IBLCacheHeader cached;
+    in.read(reinterpret_cast<char *>(&cached), sizeof(IBLCacheHeader));
+    if (in.good() && std::equal(cached.magic, cached.magic + 4, header.magic) &&
+        cached.version == header.version && cached.key == header.key) {
+      in.read(reinterpret_cast<char *>(ibl.irradiance_sh.data()), sizeof(hermes::vec3) * 9);
+      ibl.prefiltered_map = storageTexture(GL_TEXTURE_CUBE_MAP, GL_RGBA16F, GL_RGBA,
+                                           options.prefilter_resolution, header.prefilter_mip_levels);
+      std::vector<u8> texels;
+      for (u32 mip = 0; mip < header.prefilter_mip_levels; ++mip) {
+        u32 n = std::max(1u, header.prefilter_resolution >> mip);
+        texels.resize(cubeMipSize(header.prefilter_resolution, mip));
+        for (u32 face = 0; face < 6; ++face) {
+          in.read(reinterpret_cast<char *>(texels.data()), texels.size());
+          glTexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, mip, 0, 0, n, n,
+                          GL_RGBA, GL_HALF_FLOAT, texels.data());
+        }
+      }
+      ibl.brdf_map = storageTexture(GL_TEXTURE_2D, GL_RG16F, GL_RG, options.brdf_resolution, 1);
+      texels.resize(brdf_size);
+      in.read(reinterpret_cast<char *>(texels.data()), texels.size());
+      glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, header.brdf_width, header.brdf_height,
+                      GL_RG, GL_HALF_FLOAT, texels.data());
+      CHECK_GL_ERRORS;
+      if (in.good()) {
+        ibl.irradiance_map = irradianceMapFromSH(ibl.irradiance_sh, options.irradiance_resolution);
+        ibl.loaded_from_cache = true;
+        return ibl;
+      }
+      HERMES_LOG_WARNING("corrupted IBL cache file {}", cache_file);
+    }
+  }
+  in.close();
+  // generate
+  ibl.irradiance_sh = irradianceSH(ibl.environment_map);
+  ibl.irradiance_map = irradianceMapFromSH(ibl.irradiance_sh, options.irradiance_resolution);
+  ibl.prefiltered_map = computePreFilteredEnvironmentMap(ibl.environment_map, options.prefilter_resolution,
+                                                         header.prefilter_mip_levels);
+  ibl.brdf_map = computeBrdfIntegrationMap(options.brdf_resolution);
+  // store cache
+  std::ofstream out(cache_file, std::ios::binary);
+  if (!out.good()) {
+    HERMES_LOG_WARNING("could not write IBL cache file {}", cache_file);
+    return ibl;
+  }
+  out.write(reinterpret_cast<const char *>(&header), sizeof(IBLCacheHeader));
+  out.write(reinterpret_cast<const char *>(ibl.irradiance_sh.data()), sizeof(hermes::vec3) * 9);
+  std::vector<u8> texels;
+  ibl.prefiltered_map.bind();
+  for (u32 mip = 0; mip < header.prefilter_mip_levels; ++mip) {
+    texels.resize(cubeMipSize(header.prefilter_resolution, mip));
+    for (u32 face = 0; face < 6; ++face) {
+      glGetTexImage(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, mip, GL_RGBA, GL_HALF_FLOAT, texels.data());
+      out.write(reinterpret_cast<const char *>(texels.data()), texels.size());
+    }
+  }
+  ibl.brdf_map.bind();
+  texels.resize(brdf_size);
+  glGetTexImage(GL_TEXTURE_2D, 0, GL_RG, GL_HALF_FLOAT, texels.data());
+  out.write(reinterpret_cast<const char *>(texels.data()), texels.size());
+  CHECK_GL_ERRORS;
+  return ibl;
+}
+
+IBL::IBL() = default;
+
+IBL::~IBL() = default;
+
 }
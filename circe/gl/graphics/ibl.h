@@ -29,11 +29,30 @@
 #define CIRCE_CIRCE_GL_GRAPHICS_IBL_H
 
 #include <circe/gl/texture/texture.h>
+#include <array>
 
 namespace circe::gl {
 
+/// Image based lighting maps of an environment.
+/// IBL::fromFile builds all maps with compute shaders and stores them in a
+/// cache file, keyed by the hash of the source image and the options used.
+/// Later runs just upload the cached texels:
+/// \code{.cpp}
+///     auto ibl = IBL::fromFile(hermes::Path(std::string(ASSETS_PATH)) / "env.hdr");
+///     ibl.irradiance_map.bind(GL_TEXTURE0);
+///     ibl.prefiltered_map.bind(GL_TEXTURE1);
+///     ibl.brdf_map.bind(GL_TEXTURE2);
+/// \endcode
 class IBL {
 public:
+  /// Precomputation parameters (part of the cache key)
+  struct Options {
+    circe::texture_options input_options{circe::texture_options::hdr | circe::texture_options::equirectangular};
+    hermes::size2 irradiance_resolution{32, 32};
+    hermes::size2 prefilter_resolution{128, 128};
+    u32 prefilter_mip_levels{5};
+    hermes::size2 brdf_resolution{512, 512};
+  };
   // ***********************************************************************
   //                           STATIC METHODS
   // ***********************************************************************
@@ -51,10 +70,61 @@ public:
   /// \param resolution
   /// \return
   static Texture brdfIntegrationMap(const hermes::size2 &resolution);
-  ///
-  /// \param path
+  /// Projects the irradiance of an environment cubemap onto the first 9
+  /// spherical harmonics (compute shader)
+  /// \note Coefficients follow the irradianceMap convention (irradiance / pi)
+  /// \param texture environment cubemap
+  /// \return rgb coefficients
+  static std::array<hermes::vec3, 9> irradianceSH(const Texture &texture);
+  /// Evaluates irradiance spherical harmonics into a GL_RGBA16F cubemap
+  /// (compute shader)
+  /// \param sh
+  /// \param resolution
+  /// \return
+  static Texture irradianceMapFromSH(const std::array<hermes::vec3, 9> &sh, const hermes::size2 &resolution);
+  /// Compute shader version of preFilteredEnvironmentMap
+  /// \note The source resolution is taken from texture, which should have mipmaps
+  /// \param texture environment cubemap
+  /// \param resolution resolution of mip level 0
+  /// \param mip_levels one roughness value per level, from 0 to 1
+  /// \return GL_RGBA16F cubemap
+  static Texture computePreFilteredEnvironmentMap(const Texture &texture, const hermes::size2 &resolution,
+                                                  u32 mip_levels);
+  /// Compute shader version of brdfIntegrationMap
+  /// \param resolution
+  /// \return GL_RG16F texture
+  static Texture computeBrdfIntegrationMap(const hermes::size2 &resolution);
+  /// Loads an environment image and builds (or loads from cache) its maps
+  /// using default options
+  /// \param path environment image
   /// \return
   static IBL fromFile(const hermes::Path &path);
+  /// Loads an environment image and builds (or loads from cache) its maps
+  /// \param path environment image
+  /// \param options
+  /// \param cache_path (optional) cache file, defaults to <path>.ibl
+  /// \return
+  static IBL fromFile(const hermes::Path &path, const Options &options,
+                      const hermes::Path &cache_path = hermes::Path());
+  // ***********************************************************************
+  //                           CONSTRUCTORS
+  // ***********************************************************************
+  IBL();
+  IBL(IBL &&other) noexcept = default;
+  ~IBL();
+  // ***********************************************************************
+  //                           OPERATORS
+  // ***********************************************************************
+  IBL &operator=(IBL &&other) noexcept = default;
+  // ***********************************************************************
+  //                           PUBLIC FIELDS
+  // ***********************************************************************
+  Texture environment_map;                     //!< source cubemap
+  Texture irradiance_map;                      //!< diffuse irradiance cubemap
+  Texture prefiltered_map;                     //!< specular pre-filtered cubemap (one roughness per mip)
+  Texture brdf_map;                            //!< split-sum BRDF lookup table
+  std::array<hermes::vec3, 9> irradiance_sh{}; //!< irradiance spherical harmonics
+  bool loaded_from_cache{false};
 };
 
 }
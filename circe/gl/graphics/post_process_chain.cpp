@@ -0,0 +1,321 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file post_process_chain.cpp
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+#include <circe/gl/graphics/post_process_chain.h>
+#include <hermes/common/debug.h>
+#include <algorithm>
+
+namespace circe::gl {
+
+namespace {
+
+const char *fxaa_body =
+    "  const float FXAA_REDUCE_MIN = 1.0 / 128.0;\n"
+    "  const float FXAA_REDUCE_MUL = 1.0 / 8.0;\n"
+    "  const float FXAA_SPAN_MAX = 8.0;\n"
+    "  vec3 rgbNW = tileFetch(ivec2(-1, -1)).rgb;\n"
+    "  vec3 rgbNE = tileFetch(ivec2(1, -1)).rgb;\n"
+    "  vec3 rgbSW = tileFetch(ivec2(-1, 1)).rgb;\n"
+    "  vec3 rgbSE = tileFetch(ivec2(1, 1)).rgb;\n"
+    "  vec4 texColor = tileFetch(ivec2(0));\n"
+    "  vec3 rgbM = texColor.rgb;\n"
+    "  vec3 luma = vec3(0.299, 0.587, 0.114);\n"
+    "  float lumaNW = dot(rgbNW, luma);\n"
+    "  float lumaNE = dot(rgbNE, luma);\n"
+    "  float lumaSW = dot(rgbSW, luma);\n"
+    "  float lumaSE = dot(rgbSE, luma);\n"
+    "  float lumaM = dot(rgbM, luma);\n"
+    "  float lumaMin = min(lumaM, min(min(lumaNW, lumaNE), min(lumaSW, lumaSE)));\n"
+    "  float lumaMax = max(lumaM, max(max(lumaNW, lumaNE), max(lumaSW, lumaSE)));\n"
+    "  vec2 dir;\n"
+    "  dir.x = -((lumaNW + lumaNE) - (lumaSW + lumaSE));\n"
+    "  dir.y = ((lumaNW + lumaSW) - (lumaNE + lumaSE));\n"
+    "  float dirReduce = max((lumaNW + lumaNE + lumaSW + lumaSE) * (0.25 * FXAA_REDUCE_MUL), FXAA_REDUCE_MIN);\n"
+    "  float rcpDirMin = 1.0 / (min(abs(dir.x), abs(dir.y)) + dirReduce);\n"
+    // offsets in texels
+    "  dir = clamp(dir * rcpDirMin, vec2(-FXAA_SPAN_MAX), vec2(FXAA_SPAN_MAX));\n"
+    "  vec3 rgbA = 0.5 * (tileSample(dir * (1.0 / 3.0 - 0.5)).rgb + tileSample(dir * (2.0 / 3.0 - 0.5)).rgb);\n"
+    "  vec3 rgbB = rgbA * 0.5 + 0.25 * (tileSample(dir * -0.5).rgb + tileSample(dir * 0.5).rgb);\n"
+    "  float lumaB = dot(rgbB, luma);\n"
+    "  if ((lumaB < lumaMin) || (lumaB > lumaMax))\n"
+    "    return vec4(rgbA, texColor.a);\n"
+    "  return vec4(rgbB, texColor.a);\n";
+
+std::string imageFormat(GLint internal_format) {
+  switch (internal_format) {
+  case GL_RGBA8: return "rgba8";
+  case GL_RGBA16F: return "rgba16f";
+  case GL_RGBA32F: return "rgba32f";
+  default: return "";
+  }
+}
+
+}
+
+PostProcessChain::Stage PostProcessChain::gammaCorrection() {
+  Stage stage;
+  stage.name = "gammaCorrection";
+  stage.declarations = "uniform float gamma = 2.0;";
+  stage.body = "  return vec4(pow(color.rgb, vec3(1.0 / gamma)), color.a);";
+  return stage;
+}
+
+PostProcessChain::Stage PostProcessChain::toneMapping() {
+  Stage stage;
+  stage.name = "toneMapping";
+  stage.declarations = "uniform float exposure = 1.0;";
+  stage.body = "  vec3 c = color.rgb * exposure;\n"
+               "  return vec4(c / (1.0 + c), color.a);";
+  return stage;
+}
+
+PostProcessChain::Stage PostProcessChain::fxaa() {
+  Stage stage;
+  stage.name = "fxaa";
+  stage.type = Stage::Type::neighborhood;
+  stage.body = fxaa_body;
+  // span max + bilinear footprint
+  stage.radius = 9;
+  return stage;
+}
+
+PostProcessChain::PostProcessChain() = default;
+
+PostProcessChain::~PostProcessChain() {
+  if (sampler_)
+    glDeleteSamplers(1, &sampler_);
+}
+
+void PostProcessChain::add(const Stage &stage) {
+  stages_.emplace_back(stage);
+  dirty_ = true;
+}
+
+void PostProcessChain::clear() {
+  stages_.clear();
+  passes_.clear();
+  dirty_ = true;
+}
+
+void PostProcessChain::setParameter(const std::string &name, f32 value) {
+  parameters_[name] = value;
+}
+
+void PostProcessChain::build() {
+  passes_.clear();
+  Pass pass;
+  bool has_stages = false;
+  for (const auto &stage : stages_) {
+    if (stage.type == Stage::Type::per_pixel) {
+      if (pass.neighborhood)
+        pass.epilogue.emplace_back(&stage);
+      else
+        pass.prologue.emplace_back(&stage);
+    } else {
+      if (pass.neighborhood) {
+        passes_.emplace_back(std::move(pass));
+        pass = Pass();
+      }
+      pass.neighborhood = &stage;
+      pass.resolution_scale = std::clamp(stage.resolution_scale, 0.01f, 1.f);
+    }
+    has_stages = true;
+  }
+  if (has_stages)
+    passes_.emplace_back(std::move(pass));
+  // the last pass writes the output at full resolution
+  if (!passes_.empty() && passes_.back().resolution_scale < 1.f)
+    passes_.emplace_back();
+  dirty_ = false;
+}
+
+bool PostProcessChain::compile(Pass &pass, GLint output_format) {
+  auto format = imageFormat(output_format);
+  if (format.empty()) {
+    HERMES_LOG_ERROR("post process chain: unsupported output format {}", output_format);
+    return false;
+  }
+  std::string source = "#version 430 core\n"
+                       "layout(local_size_x = 16, local_size_y = 16) in;\n"
+                       "layout(binding = 0) uniform sampler2D pass_input;\n"
+                       "layout(binding = 0, " + format + ") writeonly uniform image2D pass_output;\n"
+                                                         "uniform vec2 output_size;\n";
+  auto pixel_function = [](const Stage *stage) {
+    return stage->declarations + "\nvec4 " + stage->name + "(vec4 color, vec2 uv) {\n" + stage->body + "\n}\n";
+  };
+  for (const auto *stage : pass.prologue)
+    source += pixel_function(stage);
+  // per pixel stages before the neighborhood stage are fused into the input load
+  source += "vec4 loadInput(ivec2 p) {\n"
+            "  vec2 uv = (vec2(p) + 0.5) / output_size;\n"
+            "  vec4 color = textureLod(pass_input, uv, 0.0);\n";
+  for (const auto *stage : pass.prologue)
+    source += "  color = " + stage->name + "(color, uv);\n";
+  source += "  return color;\n}\n";
+  if (pass.neighborhood) {
+    source += "#define TILE_RADIUS " + std::to_string(pass.neighborhood->radius) + "\n"
+              "#define TILE_SIZE (16 + 2 * TILE_RADIUS)\n"
+              "shared vec4 tile[TILE_SIZE * TILE_SIZE];\n"
+              "vec4 tileFetch(ivec2 offset) {\n"
+              "  ivec2 p = clamp(ivec2(gl_LocalInvocationID.xy) + TILE_RADIUS + offset, ivec2(0), ivec2(TILE_SIZE - 1));\n"
+              "  return tile[p.y * TILE_SIZE + p.x];\n"
+              "}\n"
+              "vec4 tileSample(vec2 offset) {\n"
+              "  vec2 f = floor(offset);\n"
+              "  vec2 w = offset - f;\n"
+              "  ivec2 o = ivec2(f);\n"
+              "  return mix(mix(tileFetch(o), tileFetch(o + ivec2(1, 0)), w.x),\n"
+              "             mix(tileFetch(o + ivec2(0, 1)), tileFetch(o + ivec2(1, 1)), w.x), w.y);\n"
+              "}\n";
+    source += pass.neighborhood->declarations + "\nvec4 " + pass.neighborhood->name + "(vec2 uv, vec2 texel) {\n"
+        + pass.neighborhood->body + "\n}\n";
+  }
+  for (const auto *stage : pass.epilogue)
+    source += pixel_function(stage);
+  source += "void main() {\n"
+            "  ivec2 p = ivec2(gl_GlobalInvocationID.xy);\n"
+            "  vec2 uv = (vec2(p) + 0.5) / output_size;\n";
+  if (pass.neighborhood)
+    source += "  ivec2 origin = ivec2(gl_WorkGroupID.xy) * 16 - TILE_RADIUS;\n"
+              "  for (int i = int(gl_LocalInvocationIndex); i < TILE_SIZE * TILE_SIZE; i += 256)\n"
+              "    tile[i] = loadInput(origin + ivec2(i % TILE_SIZE, i / TILE_SIZE));\n"
+              "  barrier();\n"
+              "  if (any(greaterThanEqual(p, ivec2(output_size))))\n"
+              "    return;\n"
+              "  vec4 color = " + pass.neighborhood->name + "(uv, 1.0 / output_size);\n";
+  else
+    source += "  if (any(greaterThanEqual(p, ivec2(output_size))))\n"
+              "    return;\n"
+              "  vec4 color = loadInput(p);\n";
+  for (const auto *stage : pass.epilogue)
+    source += "  color = " + stage->name + "(color, uv);\n";
+  source += "  imageStore(pass_output, p, color);\n"
+            "}\n";
+  pass.program = std::make_unique<Program>();
+  pass.program->attach(Shader(GL_COMPUTE_SHADER, source));
+  if (!pass.program->link()) {
+    HERMES_LOG_ERROR("post process chain: failed to compile pass: {}", pass.program->err);
+    pass.program.reset();
+    return false;
+  }
+  pass.output_format = output_format;
+  return true;
+}
+
+bool PostProcessChain::run(const Texture &input, const Texture &output) {
+  if (dirty_)
+    build();
+  if (passes_.empty())
+    return true;
+  if (!sampler_) {
+    glGenSamplers(1, &sampler_);
+    glSamplerParameteri(sampler_, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glSamplerParameteri(sampler_, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glSamplerParameteri(sampler_, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glSamplerParameteri(sampler_, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+  }
+  auto full_size = output.size();
+  const Texture *source = &input;
+  bool success = true;
+  for (size_t i = 0; i < passes_.size(); ++i) {
+    auto &pass = passes_[i];
+    const bool last = i + 1 == passes_.size();
+    const Texture *destination = &output;
+    if (!last)
+      destination = acquire(hermes::size2(std::max(1u, static_cast<u32>(full_size.width * pass.resolution_scale)),
+                                          std::max(1u, static_cast<u32>(full_size.height * pass.resolution_scale))));
+    GLint format = destination->internalFormat();
+    if ((!pass.program || pass.output_format != format) && !compile(pass, format)) {
+      success = false;
+      break;
+    }
+    auto size = destination->size();
+    pass.program->use();
+    pass.program->setUniform("output_size", hermes::vec2(size.width, size.height));
+    for (const auto &parameter : parameters_)
+      if (pass.program->hasUniform(parameter.first))
+        pass.program->setUniform(parameter.first, parameter.second);
+    source->bind(GL_TEXTURE0);
+    glBindSampler(0, sampler_);
+    glBindImageTexture(0, destination->textureObjectId(), 0, GL_FALSE, 0, GL_WRITE_ONLY, format);
+    glDispatchCompute((size.width + 15) / 16, (size.height + 15) / 16, 1);
+    glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT |
+        GL_FRAMEBUFFER_BARRIER_BIT);
+    // the source is not read anymore, other passes can reuse it
+    if (source != &input)
+      release(source);
+    source = destination;
+  }
+  if (source != &input && source != &output)
+    release(source);
+  glBindSampler(0, 0);
+  CHECK_GL_ERRORS;
+  return success;
+}
+
+Texture *PostProcessChain::acquire(const hermes::size2 &size) {
+  for (auto &target : targets_) {
+    auto target_size = target->texture.size();
+    if (!target->in_use && target_size.width == size.width && target_size.height == size.height) {
+      target->in_use = true;
+      return &target->texture;
+    }
+  }
+  auto target = std::make_unique<Target>();
+  target->texture.setTarget(GL_TEXTURE_2D);
+  target->texture.setInternalFormat(GL_RGBA16F);
+  target->texture.setFormat(GL_RGBA);
+  target->texture.setType(GL_FLOAT);
+  target->texture.resize(size);
+  target->texture.bind();
+  Texture::View(GL_TEXTURE_2D).apply();
+  target->in_use = true;
+  targets_.emplace_back(std::move(target));
+  return &targets_.back()->texture;
+}
+
+void PostProcessChain::release(const Texture *texture) {
+  for (auto &target : targets_)
+    if (&target->texture == texture)
+      target->in_use = false;
+}
+
+bool PostProcessChain::empty() const {
+  return stages_.empty();
+}
+
+size_t PostProcessChain::passCount() {
+  if (dirty_)
+    build();
+  return passes_.size();
+}
+
+size_t PostProcessChain::targetCount() const {
+  return targets_.size();
+}
+
+}
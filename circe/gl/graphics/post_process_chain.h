@@ -0,0 +1,150 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file post_process_chain.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+#ifndef CIRCE_CIRCE_GL_GRAPHICS_POST_PROCESS_CHAIN_H
+#define CIRCE_CIRCE_GL_GRAPHICS_POST_PROCESS_CHAIN_H
+
+#include <circe/gl/graphics/shader.h>
+#include <circe/gl/texture/texture.h>
+#include <map>
+#include <memory>
+
+namespace circe::gl {
+
+/// Post-processing graph that runs a list of effects with as few full screen
+/// passes as possible.
+/// Effects are stages of two kinds:
+///   - per pixel: glsl body of vec4 <name>(vec4 color, vec2 uv), only
+///   reads its input pixel;
+///   - neighborhood: glsl body of vec4 <name>(vec2 uv, vec2 texel), reads
+///   the input through tileFetch(ivec2 offset) / tileSample(vec2 offset)
+///   (offsets in texels, |offset| <= radius).
+/// Stages are compiled into compute passes (16x16 work groups), one per
+/// neighborhood stage. The per pixel stages before it are fused into the
+/// load of its shared memory tile, the ones after it are fused into its
+/// store. So any number of per pixel effects cost a single pass, and each
+/// neighborhood effect reads the image once.
+/// Neighborhood stages may run at a fraction of the output resolution
+/// (ex: 0.5 for a half resolution blur), the next pass upsamples with
+/// bilinear filtering. Intermediate images are RGBA16F textures taken from a
+/// pool, a target is given back to the pool as soon as the pass that reads
+/// it finishes, so targets are aliased across passes.
+/// Stage uniforms are declared in Stage::declarations and set through
+/// setParameter.
+/// \code{.cpp}
+///     PostProcessChain chain;
+///     chain.add(PostProcessChain::fxaa());
+///     chain.add(PostProcessChain::gammaCorrection());
+///     chain.setParameter("gamma", 2.2f);
+///     chain.run(scene_texture, display_texture);
+/// \endcode
+class PostProcessChain {
+public:
+  /// Effect description
+  struct Stage {
+    enum class Type {
+      per_pixel,
+      neighborhood
+    };
+    std::string name;         //!< glsl function name (must be unique in the chain)
+    Type type{Type::per_pixel};
+    std::string body;         //!< glsl function body
+    std::string declarations; //!< glsl uniforms and helpers used by body
+    u32 radius{0};            //!< neighborhood: max texel offset read
+    f32 resolution_scale{1.f}; //!< neighborhood: output resolution scale
+  };
+  // ***********************************************************************
+  //                           STATIC METHODS
+  // ***********************************************************************
+  /// \return per pixel color^(1 / gamma), parameter "gamma" (default 2.0)
+  static Stage gammaCorrection();
+  /// \return per pixel Reinhard tone mapping, parameter "exposure" (default 1.0)
+  static Stage toneMapping();
+  /// \return Fast Approximate Anti-Aliasing (neighborhood)
+  static Stage fxaa();
+  // ***********************************************************************
+  //                           CONSTRUCTORS
+  // ***********************************************************************
+  PostProcessChain();
+  ~PostProcessChain();
+  // ***********************************************************************
+  //                           METHODS
+  // ***********************************************************************
+  /// Appends a stage
+  /// \param stage
+  void add(const Stage &stage);
+  /// Removes all stages
+  void clear();
+  /// \param name uniform name declared by a stage
+  /// \param value
+  void setParameter(const std::string &name, f32 value);
+  /// Applies all stages
+  /// \param input texture (any size)
+  /// \param output GL_TEXTURE_2D with GL_RGBA8, GL_RGBA16F or GL_RGBA32F
+  /// internal format
+  /// \return false if a pass could not be compiled
+  bool run(const Texture &input, const Texture &output);
+  // ***********************************************************************
+  //                           FIELDS
+  // ***********************************************************************
+  /// \return true if there are no stages
+  [[nodiscard]] bool empty() const;
+  /// \return number of passes executed by run
+  [[nodiscard]] size_t passCount();
+  /// \return number of intermediate textures allocated so far
+  [[nodiscard]] size_t targetCount() const;
+
+private:
+  struct Pass {
+    std::vector<const Stage *> prologue;
+    const Stage *neighborhood{nullptr};
+    std::vector<const Stage *> epilogue;
+    f32 resolution_scale{1.f};
+    GLint output_format{0};
+    std::unique_ptr<Program> program;
+  };
+  struct Target {
+    Texture texture;
+    bool in_use{false};
+  };
+  /// Splits stages into passes
+  void build();
+  bool compile(Pass &pass, GLint output_format);
+  Texture *acquire(const hermes::size2 &size);
+  void release(const Texture *texture);
+
+  std::vector<Stage> stages_;
+  std::vector<Pass> passes_;
+  std::map<std::string, f32> parameters_;
+  std::vector<std::unique_ptr<Target>> targets_;
+  GLuint sampler_{0};
+  bool dirty_{true};
+};
+
+}
+
+#endif //CIRCE_CIRCE_GL_GRAPHICS_POST_PROCESS_CHAIN_H
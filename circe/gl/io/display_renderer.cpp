@@ -42,10 +42,13 @@ DisplayRenderer::DisplayRenderer(size_t w, size_t h) : curBuffer_(0) {
 
 void DisplayRenderer::addEffect(PostEffect *e) { effects_.emplace_back(e); }
 
+PostProcessChain &DisplayRenderer::postProcess() { return post_process_; }
+
 void DisplayRenderer::process(const std::function<void()> &f) {
   resize(framebuffer_textures_->size().width, framebuffer_textures_->size().height);
   // render image to the first framebuffer
   framebuffers_[curBuffer_].render(f);
+  applyPostProcess();
 //  buffers_[curBuffer_]->render(f);
 //  for (auto &effect : effects_) {
 //    effect->apply(*buffers_[curBuffer_].get(),
@@ -54,6 +57,34 @@ void DisplayRenderer::process(const std::function<void()> &f) {
 //  }
 }
 
+void DisplayRenderer::processProgressive(const CameraInterface &camera, const std::function<void(u32)> &f) {
+  resize(framebuffer_textures_->size().width, framebuffer_textures_->size().height);
+  // the float target is only allocated by viewports that use it
+  if (!accumulator_)
+    accumulator_ = std::make_unique<ProgressiveAccumulator>(
+        hermes::size2(framebuffer_textures_->size().width, framebuffer_textures_->size().height));
+  accumulator_->accumulate(camera, f);
+  // resolve the running mean into the current frame
+  framebuffers_[curBuffer_].render([&]() { accumulator_->render(); });
+  applyPostProcess();
+}
+
+void DisplayRenderer::applyPostProcess() {
+  if (post_process_.empty())
+    return;
+  if (post_process_.run(framebuffer_textures_[curBuffer_], framebuffer_textures_[1 - curBuffer_]))
+    curBuffer_ = 1 - curBuffer_;
+}
+
+void DisplayRenderer::resetAccumulation() {
+  if (accumulator_)
+    accumulator_->reset();
+}
+
+u32 DisplayRenderer::accumulatedSamples() const {
+  return accumulator_ ? accumulator_->sampleCount() : 0;
+}
+
 void DisplayRenderer::render() {
   resize(framebuffer_textures_->size().width, framebuffer_textures_->size().height);
   // render to display
@@ -65,12 +96,20 @@ void DisplayRenderer::render() {
 }
 
 void DisplayRenderer::resize(size_t w, size_t h) {
+  auto size = framebuffer_textures_[0].size();
+  if (size.width != w || size.height != h)
+    needsResize_ = true;
   if (needsResize_) {
     for (size_t i = 0; i < 2; i++) {
       framebuffer_textures_[i].resize(hermes::size2(w, h));
+      // complete textures so they can be sampled by the post process chain
+      framebuffer_textures_[i].bind();
+      Texture::View(GL_TEXTURE_2D).apply();
       framebuffers_[i].resize(hermes::size2(w, h));
       framebuffers_[i].attachTexture(framebuffer_textures_[i]);
     }
+    if (accumulator_)
+      accumulator_->resize(hermes::size2(w, h));
   }
   needsResize_ = false;
 }
@@ -82,4 +121,8 @@ void DisplayRenderer::currentPixels(std::vector<unsigned char> &data,
   height = framebuffer_textures_[0].size().height;
 }
 
+const Texture &DisplayRenderer::currentTexture() const {
+  return framebuffer_textures_[curBuffer_];
+}
+
 } // circe namespace
@@ -28,6 +28,8 @@
 
 #include "screen_quad.h"
 #include <circe/gl/graphics/post_effect.h>
+#include <circe/gl/graphics/post_process_chain.h>
+#include <circe/gl/io/progressive_accumulator.h>
 #include <circe/gl/texture/framebuffer_texture.h>
 #include <circe/gl/scene/quad.h>
 
@@ -38,23 +40,44 @@ namespace circe::gl {
 class DisplayRenderer {
 public:
   DisplayRenderer(size_t w, size_t h);
+  /// \note Deprecated: legacy effects are not applied, use postProcess()
   /// \param e post effect.
   void addEffect(PostEffect *e);
+  /// Effects applied to the frame after process/processProgressive
+  /// \return post process chain
+  PostProcessChain &postProcess();
   /// \param f render callback of the original frame
   void process(const std::function<void()> &f);
+  /// Progressive mode: accumulates one more sample of f into a float target
+  /// and uses the running mean as the current frame. Accumulation restarts
+  /// when the camera changes or resetAccumulation() is called.
+  /// \param camera
+  /// \param f render callback of one sample, receives the sample index
+  void processProgressive(const CameraInterface &camera, const std::function<void(u32)> &f);
+  /// Discards accumulated samples (ex: when scene data changes)
+  void resetAccumulation();
+  /// \return number of samples accumulated in progressive mode
+  [[nodiscard]] u32 accumulatedSamples() const;
   ///
   void render();
   /// \param w width in pixels
   /// \param h height in pixels
   void resize(size_t w, size_t h);
-  ///
+  /// Reads back the current frame.
+  /// \note Stalls until the GPU finishes the frame, use a FrameRecorder with
+  /// currentTexture() to capture frames every frame.
   /// \param data
   /// \param width
   /// \param height
   void currentPixels(std::vector<unsigned char> &data, size_t &width,
                      size_t &height) const;
+  /// \return texture holding the current frame (after post effects)
+  [[nodiscard]] const Texture &currentTexture() const;
 
 private:
+  /// runs the post process chain from the current buffer to the other one
+  void applyPostProcess();
+
   ScreenQuad screen;
   bool needsResize_;
   size_t curBuffer_;
@@ -62,6 +85,9 @@ private:
 
   Texture framebuffer_textures_[2];
   Framebuffer framebuffers_[2];
+  /// created by the first processProgressive call
+  std::unique_ptr<ProgressiveAccumulator> accumulator_;
+  PostProcessChain post_process_;
 };
 
 } // circe namespace
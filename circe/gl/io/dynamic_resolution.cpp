@@ -0,0 +1,192 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file dynamic_resolution.cpp
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+
+#include <circe/gl/io/dynamic_resolution.h>
+#include <hermes/common/debug.h>
+#include <algorithm>
+#include <cmath>
+
+namespace circe::gl {
+
+namespace {
+
+const char *upscale_vs = "#version 440 core\n"
+                         "out vec2 uv;\n"
+                         "void main() {\n"
+                         "  uv = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);\n"
+                         "  gl_Position = vec4(uv * 2.0 - 1.0, 0.0, 1.0);\n"
+                         "}\n";
+
+const char *upscale_fs = "#version 440 core\n"
+                         "layout(binding = 0) uniform sampler2D source;\n"
+                         "uniform vec2 uv_scale;\n"
+                         "uniform float sharpness;\n"
+                         "in vec2 uv;\n"
+                         "layout(location = 0) out vec4 color;\n"
+                         "void main() {\n"
+                         "  vec2 texel = 1.0 / vec2(textureSize(source, 0));\n"
+                         // stay inside the rendered region
+                         "  vec2 lower = 0.5 * texel;\n"
+                         "  vec2 upper = uv_scale - 0.5 * texel;\n"
+                         "  vec2 p = clamp(uv * uv_scale, lower, upper);\n"
+                         "  vec4 c = texture(source, p);\n"
+                         "  vec3 blur = 0.25 * (texture(source, clamp(p + vec2(texel.x, 0.0), lower, upper)).rgb +\n"
+                         "                      texture(source, clamp(p - vec2(texel.x, 0.0), lower, upper)).rgb +\n"
+                         "                      texture(source, clamp(p + vec2(0.0, texel.y), lower, upper)).rgb +\n"
+                         "                      texture(source, clamp(p - vec2(0.0, texel.y), lower, upper)).rgb);\n"
+                         "  color = vec4(max(c.rgb + sharpness * (c.rgb - blur), vec3(0.0)), c.a);\n"
+                         "}\n";
+
+}
+
+DynamicResolution::DynamicResolution(f32 target_ms) : target_ms(target_ms) {
+  color_.setTarget(GL_TEXTURE_2D);
+  color_.setInternalFormat(GL_RGBA8);
+  color_.setFormat(GL_RGBA);
+  color_.setType(GL_UNSIGNED_BYTE);
+}
+
+DynamicResolution::~DynamicResolution() {
+  if (queries_[0][0])
+    glDeleteQueries(2 * query_ring_size, &queries_[0][0]);
+  if (vao_)
+    glDeleteVertexArrays(1, &vao_);
+}
+
+void DynamicResolution::resize(const hermes::size2 &resolution) {
+  if (resolution.width == full_resolution_.width && resolution.height == full_resolution_.height)
+    return;
+  full_resolution_ = resolution;
+  color_.resize(resolution);
+  color_.bind();
+  Texture::View(GL_TEXTURE_2D).apply();
+  framebuffer_.resize(resolution);
+  framebuffer_.attachTexture(color_);
+}
+
+void DynamicResolution::updateScale() {
+  u32 slot = frame_ % query_ring_size;
+  if (!query_issued_[slot])
+    return;
+  query_issued_[slot] = false;
+  GLint available = 0;
+  glGetQueryObjectiv(queries_[slot][1], GL_QUERY_RESULT_AVAILABLE, &available);
+  // the slot is reused anyway, this measurement is lost
+  if (!available)
+    return;
+  GLuint64 begin = 0, end = 0;
+  glGetQueryObjectui64v(queries_[slot][0], GL_QUERY_RESULT, &begin);
+  glGetQueryObjectui64v(queries_[slot][1], GL_QUERY_RESULT, &end);
+  gpu_time_ms_ = static_cast<f32>(end - begin) * 1e-6f;
+  if (gpu_time_ms_ <= 0.f)
+    return;
+  // cost is proportional to the number of pixels, keep 5% of headroom
+  f32 desired = query_scale_[slot] * std::sqrt(0.95f * target_ms / gpu_time_ms_);
+  desired = std::clamp(desired, min_scale, max_scale);
+  // drop fast, recover slowly
+  f32 gain = desired < scale_ ? 0.5f : 0.1f;
+  if (std::abs(desired - scale_) > 0.01f)
+    scale_ = std::clamp(scale_ + gain * (desired - scale_), min_scale, max_scale);
+}
+
+void DynamicResolution::render(const hermes::index2 &position, const hermes::size2 &resolution,
+                               const Color &clear_color, const std::function<void()> &f) {
+  if (!resolution.width || !resolution.height)
+    return;
+  if (!upscale_program_.good()) {
+    upscale_program_.attach(Shader(GL_VERTEX_SHADER, upscale_vs));
+    upscale_program_.attach(Shader(GL_FRAGMENT_SHADER, upscale_fs));
+    if (!upscale_program_.link())
+      HERMES_LOG_ERROR("failed to compile dynamic resolution upscale shader: {}", upscale_program_.err);
+    glGenVertexArrays(1, &vao_);
+    glGenQueries(2 * query_ring_size, &queries_[0][0]);
+  }
+  resize(resolution);
+  updateScale();
+  render_resolution_ = hermes::size2(std::max(1u, static_cast<u32>(resolution.width * scale_ + 0.5f)),
+                                     std::max(1u, static_cast<u32>(resolution.height * scale_ + 0.5f)));
+  u32 slot = frame_++ % query_ring_size;
+  GLboolean scissor_test = glIsEnabled(GL_SCISSOR_TEST);
+  // scene at the current scale
+  glQueryCounter(queries_[slot][0], GL_TIMESTAMP);
+  framebuffer_.enable();
+  glViewport(0, 0, render_resolution_.width, render_resolution_.height);
+  glScissor(0, 0, render_resolution_.width, render_resolution_.height);
+  glEnable(GL_SCISSOR_TEST);
+  glClearColor(clear_color.r, clear_color.g, clear_color.b, clear_color.a);
+  glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+  if (f)
+    f();
+  Framebuffer::disable();
+  glQueryCounter(queries_[slot][1], GL_TIMESTAMP);
+  query_issued_[slot] = true;
+  query_scale_[slot] = scale_;
+  // upscale into the viewport
+  glViewport(position.i, position.j, resolution.width, resolution.height);
+  glScissor(position.i, position.j, resolution.width, resolution.height);
+  GLboolean depth_test = glIsEnabled(GL_DEPTH_TEST);
+  GLboolean blend = glIsEnabled(GL_BLEND);
+  glDisable(GL_DEPTH_TEST);
+  glDisable(GL_BLEND);
+  upscale_program_.use();
+  upscale_program_.setUniform("uv_scale", hermes::vec2(
+      static_cast<f32>(render_resolution_.width) / resolution.width,
+      static_cast<f32>(render_resolution_.height) / resolution.height));
+  upscale_program_.setUniform("sharpness", scale_ < 1.f ? sharpness : 0.f);
+  color_.bind(GL_TEXTURE0);
+  glBindVertexArray(vao_);
+  glDrawArrays(GL_TRIANGLES, 0, 3);
+  glBindVertexArray(0);
+  if (depth_test)
+    glEnable(GL_DEPTH_TEST);
+  if (blend)
+    glEnable(GL_BLEND);
+  if (!scissor_test)
+    glDisable(GL_SCISSOR_TEST);
+  CHECK_GL_ERRORS;
+}
+
+void DynamicResolution::reset() {
+  scale_ = max_scale;
+  for (auto &issued : query_issued_)
+    issued = false;
+}
+
+f32 DynamicResolution::scale() const {
+  return scale_;
+}
+
+f32 DynamicResolution::gpuTime() const {
+  return gpu_time_ms_;
+}
+
+hermes::size2 DynamicResolution::renderResolution() const {
+  return render_resolution_;
+}
+
+}
@@ -0,0 +1,114 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file dynamic_resolution.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+
+#ifndef CIRCE_CIRCE_GL_IO_DYNAMIC_RESOLUTION_H
+#define CIRCE_CIRCE_GL_IO_DYNAMIC_RESOLUTION_H
+
+#include <circe/gl/io/framebuffer.h>
+#include <circe/gl/graphics/shader.h>
+#include <circe/gl/texture/texture.h>
+
+namespace circe::gl {
+
+/// Renders a viewport at a reduced resolution to hold a GPU time budget.
+/// The scene is rendered into the lower left region of an internal
+/// framebuffer (allocated once at full resolution, so scale changes never
+/// reallocate), then upscaled into the viewport with bilinear filtering
+/// followed by a sharpening pass.
+/// The GPU time of the scene is measured with timestamp queries that are read
+/// a few frames later (never stalls). A controller moves the scale towards
+/// the value that would hit the budget: it drops fast when over budget and
+/// recovers slowly (up to max_scale) when there is room.
+/// \code{.cpp}
+///     DynamicResolution dynamic_resolution(16.f);
+///     dynamic_resolution.render(viewport_position, viewport_size, clear_color, [&]() {
+///       scene.render();
+///     });
+///     ImGui::Text("%.2f %.2f ms", dynamic_resolution.scale(), dynamic_resolution.gpuTime());
+/// \endcode
+class DynamicResolution {
+public:
+  // ***********************************************************************
+  //                           CONSTRUCTORS
+  // ***********************************************************************
+  /// \param target_ms GPU time budget in milliseconds
+  explicit DynamicResolution(f32 target_ms = 16.f);
+  ~DynamicResolution();
+  DynamicResolution(const DynamicResolution &) = delete;
+  DynamicResolution &operator=(const DynamicResolution &) = delete;
+  // ***********************************************************************
+  //                           METHODS
+  // ***********************************************************************
+  /// Renders f at the current scale and upscales it into a region of the
+  /// currently bound draw framebuffer
+  /// \param position viewport position in pixels
+  /// \param resolution viewport size in pixels
+  /// \param clear_color
+  /// \param f render callback
+  void render(const hermes::index2 &position, const hermes::size2 &resolution, const Color &clear_color,
+              const std::function<void()> &f);
+  /// Goes back to max_scale and drops pending measurements
+  void reset();
+  // ***********************************************************************
+  //                           FIELDS
+  // ***********************************************************************
+  /// \return current resolution scale (per axis)
+  [[nodiscard]] f32 scale() const;
+  /// \return last measured GPU time of the scene in milliseconds
+  [[nodiscard]] f32 gpuTime() const;
+  /// \return size of the region the scene is currently rendered into
+  [[nodiscard]] hermes::size2 renderResolution() const;
+
+  f32 target_ms{16.f};   //!< GPU time budget
+  f32 min_scale{0.5f};   //!< lower scale bound
+  f32 max_scale{1.f};    //!< upper scale bound
+  f32 sharpness{0.25f};  //!< upscale sharpening strength in [0,1]
+
+private:
+  static constexpr u32 query_ring_size = 4;
+  /// Reads finished measurements and updates the scale
+  void updateScale();
+  void resize(const hermes::size2 &resolution);
+
+  f32 scale_{1.f};
+  f32 gpu_time_ms_{0.f};
+  hermes::size2 full_resolution_;
+  hermes::size2 render_resolution_;
+  Framebuffer framebuffer_;
+  Texture color_;
+  Program upscale_program_;
+  GLuint vao_{0};
+  GLuint queries_[query_ring_size][2]{};
+  bool query_issued_[query_ring_size]{};
+  f32 query_scale_[query_ring_size]{}; //!< scale used by each measured frame
+  u32 frame_{0};
+};
+
+}
+
+#endif //CIRCE_CIRCE_GL_IO_DYNAMIC_RESOLUTION_H
@@ -0,0 +1,368 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file frame_recorder.cpp
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+
+#include <circe/gl/io/frame_recorder.h>
+#include <hermes/common/debug.h>
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstring>
+// private copy of stb_image_write, so applications may implement it too
+#define STB_IMAGE_WRITE_STATIC
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+
+#ifdef _WIN32
+#define CIRCE_POPEN _popen
+#define CIRCE_PCLOSE _pclose
+#else
+#define CIRCE_POPEN popen
+#define CIRCE_PCLOSE pclose
+#endif
+
+namespace circe::gl {
+
+FrameRecorder::FrameRecorder() = default;
+
+FrameRecorder::~FrameRecorder() {
+  stop();
+  destroySlots();
+}
+
+bool FrameRecorder::start(const Options &options) {
+  stop();
+  if (options.path.empty()) {
+    HERMES_LOG_ERROR("frame recorder: missing output path.");
+    return false;
+  }
+  if (options.output != Output::ffmpeg && !parseFilePattern(options.path)) {
+    HERMES_LOG_ERROR("frame recorder: the path must contain exactly one frame number conversion (%d, %Nd or %0Nd).");
+    return false;
+  }
+  options_ = options;
+  stats_ = {};
+  next_frame_ = next_write_ = 0;
+  video_size_ = {};
+  ready_frames_.clear();
+  pixel_type_ = options_.output == Output::hdr ? GL_FLOAT : GL_UNSIGNED_BYTE;
+  pixel_size_ = options_.output == Output::hdr ? 4 * sizeof(f32) : 4;
+  u32 ring_size = std::max(1u, options_.ring_size);
+  if (slots_.size() != ring_size) {
+    destroySlots();
+    for (u32 i = 0; i < ring_size; ++i)
+      slots_.emplace_back(std::make_unique<Slot>());
+  }
+  // ffmpeg does the encoding, a single thread feeds its pipe (opened with the
+  // first frame, when the video size is known)
+  encoders_ = std::make_unique<JobSystem>(options_.output == Output::ffmpeg ? 1 : options_.encoder_threads);
+  recording_ = true;
+  return true;
+}
+
+void FrameRecorder::stop() {
+  if (!recording_)
+    return;
+  // flush frames still being copied
+  std::vector<Slot *> copying;
+  for (auto &slot : slots_)
+    if (slot->state == SlotState::copying)
+      copying.emplace_back(slot.get());
+  std::sort(copying.begin(), copying.end(), [](const Slot *a, const Slot *b) { return a->frame < b->frame; });
+  for (auto *slot : copying) {
+    waitSync(slot->fence);
+    submit(*slot);
+  }
+  encoders_.reset();
+  if (pipe_) {
+    CIRCE_PCLOSE(pipe_);
+    pipe_ = nullptr;
+  }
+  recording_ = false;
+}
+
+bool FrameRecorder::capture(const Texture &texture) {
+  auto size = texture.size();
+  auto *slot = acquireSlot({size.width, size.height});
+  if (!slot)
+    return false;
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, slot->pbo);
+  glGetTextureImage(texture.textureObjectId(), 0, GL_RGBA, pixel_type_, slot->capacity, nullptr);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  slot->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  CHECK_GL_ERRORS;
+  return true;
+}
+
+bool FrameRecorder::captureFramebuffer(const hermes::size2 &size, GLuint framebuffer_id) {
+  auto *slot = acquireSlot(size);
+  if (!slot)
+    return false;
+  GLint read_framebuffer = 0;
+  glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &read_framebuffer);
+  glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer_id);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, slot->pbo);
+  glReadPixels(0, 0, size.width, size.height, GL_RGBA, pixel_type_, nullptr);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  glBindFramebuffer(GL_READ_FRAMEBUFFER, read_framebuffer);
+  slot->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  CHECK_GL_ERRORS;
+  return true;
+}
+
+void FrameRecorder::poll() {
+  // copies finish in order, stop at the first one still running
+  std::vector<Slot *> copying;
+  for (auto &slot : slots_)
+    if (slot->state == SlotState::copying)
+      copying.emplace_back(slot.get());
+  std::sort(copying.begin(), copying.end(), [](const Slot *a, const Slot *b) { return a->frame < b->frame; });
+  for (auto *slot : copying) {
+    if (!waitSync(slot->fence, false))
+      break;
+    submit(*slot);
+  }
+}
+
+bool FrameRecorder::isRecording() const {
+  return recording_;
+}
+
+FrameRecorder::Stats FrameRecorder::stats() const {
+  std::lock_guard<std::mutex> lock(stats_mutex_);
+  auto stats = stats_;
+  stats.in_flight = 0;
+  for (const auto &slot : slots_)
+    if (slot->state != SlotState::free)
+      stats.in_flight++;
+  return stats;
+}
+
+FrameRecorder::Slot *FrameRecorder::acquireSlot(const hermes::size2 &size) {
+  if (!recording_ || !size.total())
+    return nullptr;
+  poll();
+  auto drop = [&]() -> Slot * {
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    stats_.dropped++;
+    return nullptr;
+  };
+  // video frames can't change size
+  if (options_.output == Output::ffmpeg) {
+    if (!video_size_.total())
+      video_size_ = size;
+    else if (video_size_.width != size.width || video_size_.height != size.height) {
+      HERMES_LOG_WARNING("frame recorder: frame size differs from the video size, dropping frame.");
+      return drop();
+    }
+  }
+  Slot *slot = nullptr;
+  for (auto &s : slots_)
+    if (s->state == SlotState::free) {
+      slot = s.get();
+      break;
+    }
+  if (!slot && options_.full_policy == FullPolicy::wait) {
+    // block on the oldest frame
+    slot = std::min_element(slots_.begin(), slots_.end(), [](const auto &a, const auto &b) {
+      return a->frame < b->frame;
+    })->get();
+    if (slot->state == SlotState::copying) {
+      waitSync(slot->fence);
+      submit(*slot);
+    }
+    std::unique_lock<std::mutex> lock(stats_mutex_);
+    released_.wait(lock, [&]() { return slot->state == SlotState::free; });
+  }
+  if (!slot)
+    return drop();
+  u64 bytes = static_cast<u64>(size.width) * size.height * pixel_size_;
+  if (slot->capacity < bytes) {
+    if (slot->pbo) {
+      glBindBuffer(GL_PIXEL_PACK_BUFFER, slot->pbo);
+      glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+      glDeleteBuffers(1, &slot->pbo);
+    }
+    // persistent coherent mapping: encoders read the memory once the fence is
+    // signaled, no map/unmap per frame
+    GLbitfield flags = GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glGenBuffers(1, &slot->pbo);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot->pbo);
+    glBufferStorage(GL_PIXEL_PACK_BUFFER, bytes, nullptr, flags | GL_CLIENT_STORAGE_BIT);
+    slot->data = reinterpret_cast<const u8 *>(glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, bytes, flags));
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    CHECK_GL_ERRORS;
+    slot->capacity = slot->data ? bytes : 0;
+    if (!slot->data) {
+      HERMES_LOG_ERROR("frame recorder: failed to map pixel pack buffer.");
+      return drop();
+    }
+  }
+  slot->size = size;
+  slot->frame = next_frame_++;
+  slot->state = SlotState::copying;
+  {
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    stats_.captured++;
+  }
+  return slot;
+}
+
+void FrameRecorder::submit(Slot &slot) {
+  glDeleteSync(slot.fence);
+  slot.fence = nullptr;
+  slot.state = SlotState::encoding;
+  encoders_->submit([this, &slot](u32) { encode(slot); });
+}
+
+void FrameRecorder::encode(Slot &slot) {
+  auto writeAndRelease = [&](Slot &s) {
+    auto start = std::chrono::steady_clock::now();
+    bool success = write(s);
+    release(s, success, std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - start).count());
+  };
+  if (options_.output != Output::ffmpeg) {
+    writeAndRelease(slot);
+    return;
+  }
+  // jobs may run out of order, whoever holds the next frame writes all
+  // consecutive frames available
+  std::lock_guard<std::mutex> lock(write_mutex_);
+  ready_frames_[slot.frame] = &slot;
+  for (auto it = ready_frames_.find(next_write_); it != ready_frames_.end();
+       it = ready_frames_.find(next_write_)) {
+    Slot *next = it->second;
+    ready_frames_.erase(it);
+    writeAndRelease(*next);
+    next_write_++;
+  }
+}
+
+bool FrameRecorder::write(const Slot &slot) {
+  int w = static_cast<int>(slot.size.width);
+  int h = static_cast<int>(slot.size.height);
+  if (options_.output == Output::ffmpeg) {
+    if (!pipe_) {
+      // raw frames come bottom-up
+      std::string command = options_.ffmpeg_path + " -y -loglevel error -f rawvideo -pix_fmt rgba -s "
+          + std::to_string(w) + "x" + std::to_string(h) + " -r " + std::to_string(options_.fps)
+          + " -i - -vf vflip " + options_.ffmpeg_arguments + " \"" + options_.path + "\"";
+#ifdef _WIN32
+      pipe_ = CIRCE_POPEN(command.c_str(), "wb");
+#else
+      pipe_ = CIRCE_POPEN(command.c_str(), "w");
+#endif
+      if (!pipe_) {
+        HERMES_LOG_ERROR("frame recorder: failed to start {}", command);
+        return false;
+      }
+    }
+    u64 bytes = static_cast<u64>(w) * h * pixel_size_;
+    return std::fwrite(slot.data, 1, bytes, pipe_) == bytes;
+  }
+  // GL rows go bottom-up, image files go top-down
+  u64 row_size = static_cast<u64>(w) * pixel_size_;
+  std::vector<u8> pixels(row_size * h);
+  for (int row = 0; row < h; ++row)
+    std::memcpy(pixels.data() + row * row_size, slot.data + (h - 1 - row) * row_size, row_size);
+  auto path = filename(slot.frame);
+  if (options_.output == Output::hdr)
+    return stbi_write_hdr(path.c_str(), w, h, 4, reinterpret_cast<const f32 *>(pixels.data()));
+  return stbi_write_png(path.c_str(), w, h, 4, pixels.data(), w * 4);
+}
+
+bool FrameRecorder::parseFilePattern(const std::string &pattern) {
+  filename_prefix_.clear();
+  filename_suffix_.clear();
+  frame_width_ = 0;
+  frame_fill_ = ' ';
+  bool found = false;
+  for (size_t i = 0; i < pattern.size(); ++i) {
+    auto &text = found ? filename_suffix_ : filename_prefix_;
+    if (pattern[i] != '%') {
+      text += pattern[i];
+      continue;
+    }
+    if (++i < pattern.size() && pattern[i] == '%') {
+      text += '%';
+      continue;
+    }
+    // %[0][width]d
+    if (found)
+      return false;
+    char fill = ' ';
+    if (i < pattern.size() && pattern[i] == '0') {
+      fill = '0';
+      ++i;
+    }
+    u32 width = 0;
+    for (; i < pattern.size() && std::isdigit(static_cast<unsigned char>(pattern[i])); ++i)
+      width = std::min(width * 10 + (pattern[i] - '0'), 32u);
+    if (i >= pattern.size() || pattern[i] != 'd')
+      return false;
+    frame_fill_ = fill;
+    frame_width_ = width;
+    found = true;
+  }
+  return found;
+}
+
+std::string FrameRecorder::filename(u64 frame) const {
+  auto number = std::to_string(frame);
+  if (number.size() < frame_width_)
+    number.insert(0, frame_width_ - number.size(), frame_fill_);
+  return filename_prefix_ + number + filename_suffix_;
+}
+
+void FrameRecorder::release(Slot &slot, bool success, f64 ms) {
+  {
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    if (success) {
+      stats_.encode_ms = stats_.encoded ? stats_.encode_ms + 0.05 * (ms - stats_.encode_ms) : ms;
+      stats_.encoded++;
+    } else
+      stats_.failed++;
+    slot.state = SlotState::free;
+  }
+  released_.notify_all();
+}
+
+void FrameRecorder::destroySlots() {
+  for (auto &slot : slots_) {
+    if (slot->fence)
+      glDeleteSync(slot->fence);
+    if (slot->pbo) {
+      glBindBuffer(GL_PIXEL_PACK_BUFFER, slot->pbo);
+      glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+      glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+      glDeleteBuffers(1, &slot->pbo);
+    }
+  }
+  slots_.clear();
+}
+
+}
@@ -0,0 +1,188 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file frame_recorder.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+
+#ifndef CIRCE_CIRCE_GL_IO_FRAME_RECORDER_H
+#define CIRCE_CIRCE_GL_IO_FRAME_RECORDER_H
+
+#include <circe/common/job_system.h>
+#include <circe/gl/texture/texture.h>
+#include <cstdio>
+#include <map>
+#include <mutex>
+
+namespace circe::gl {
+
+/// Records rendered frames without stalling the render thread.
+/// Each capture copies a texture (or a framebuffer) into one buffer of a ring
+/// of persistently mapped pixel pack buffers and inserts a fence after the
+/// copy. poll() hands the buffers whose fences were signaled to a pool of
+/// encoder threads, which read the mapped memory directly and either write
+/// an image file per frame (png or hdr) or pipe raw frames into a local
+/// ffmpeg process. A ring buffer stays busy until its frame is encoded, so
+/// the ring size bounds the memory used by the recording: when all buffers
+/// are busy the new frame is dropped (or, if requested, the render thread
+/// waits for the oldest frame).
+/// \code{.cpp}
+///     FrameRecorder recorder;
+///     FrameRecorder::Options options;
+///     options.path = "frames/frame_%05d.png";
+///     recorder.start(options);
+///     // every frame, after rendering
+///     recorder.capture(display_renderer.currentTexture());
+///     // on exit (flushes pending frames)
+///     recorder.stop();
+/// \endcode
+/// \note All methods must be called from the thread owning the GL context.
+class FrameRecorder {
+public:
+  /// Destination of the recorded frames
+  enum class Output {
+    png,   //!< one 8-bit RGBA png file per frame
+    hdr,   //!< one float RGB radiance (.hdr) file per frame
+    ffmpeg //!< raw RGBA frames piped into an ffmpeg process
+  };
+  /// What to do when all ring buffers are busy
+  enum class FullPolicy {
+    drop, //!< discard the new frame
+    wait  //!< block until the oldest frame is encoded
+  };
+  struct Options {
+    Output output{Output::png};
+    /// png/hdr: file name pattern with exactly one frame number conversion,
+    /// %d, %Nd or %0Nd (ex: "frames/frame_%05d.png"), and %% for a literal %
+    /// ffmpeg: output video file
+    std::string path{"frame_%05d.png"};
+    /// number of pixel pack buffers (frames in flight)
+    u32 ring_size{4};
+    /// number of encoder threads (0 = hardware concurrency)
+    u32 encoder_threads{0};
+    FullPolicy full_policy{FullPolicy::drop};
+    /// ffmpeg: input frame rate
+    u32 fps{60};
+    /// ffmpeg: output options (codec, quality, ...)
+    std::string ffmpeg_arguments{"-c:v libx264 -preset fast -crf 18 -pix_fmt yuv420p"};
+    /// ffmpeg: executable
+    std::string ffmpeg_path{"ffmpeg"};
+  };
+  struct Stats {
+    u64 captured{0};      //!< frames copied into the ring
+    u64 encoded{0};       //!< frames written to their destination
+    u64 dropped{0};       //!< frames discarded (ring full or size mismatch)
+    u64 failed{0};        //!< frames that could not be written
+    u32 in_flight{0};     //!< frames being copied or encoded
+    f64 encode_ms{0};     //!< rolling average of the encoding time of a frame
+  };
+  // ***********************************************************************
+  //                           CONSTRUCTORS
+  // ***********************************************************************
+  FrameRecorder();
+  FrameRecorder(const FrameRecorder &other) = delete;
+  ~FrameRecorder();
+  // ***********************************************************************
+  //                           OPERATORS
+  // ***********************************************************************
+  FrameRecorder &operator=(const FrameRecorder &other) = delete;
+  // ***********************************************************************
+  //                           METHODS
+  // ***********************************************************************
+  /// Starts a new recording (stops the current one)
+  /// \param options
+  /// \return false if the options are invalid
+  bool start(const Options &options);
+  /// Waits for all pending frames to be encoded and closes the output
+  void stop();
+  /// Copies the first mip level of a 2D texture into the ring
+  /// \param texture
+  /// \return false if the frame was dropped
+  bool capture(const Texture &texture);
+  /// Copies a region of a framebuffer into the ring
+  /// \param size region size (in pixels), starting at the lower-left corner
+  /// \param framebuffer_id framebuffer object (0 = default framebuffer)
+  /// \return false if the frame was dropped
+  bool captureFramebuffer(const hermes::size2 &size, GLuint framebuffer_id = 0);
+  /// Hands the frames whose copies have finished to the encoder threads.
+  /// \note capture() already calls it, call it on frames without captures to
+  /// keep the encoders busy.
+  void poll();
+  // ***********************************************************************
+  //                            FIELDS
+  // ***********************************************************************
+  /// \return true between start() and stop()
+  [[nodiscard]] bool isRecording() const;
+  /// \return counters of the current (or last) recording
+  [[nodiscard]] Stats stats() const;
+
+private:
+  enum class SlotState : u8 { free, copying, encoding };
+  struct Slot {
+    GLuint pbo{0};
+    const u8 *data{nullptr}; //!< persistent read mapping of pbo
+    u64 capacity{0};         //!< pbo size in bytes
+    GLsync fence{nullptr};
+    std::atomic<SlotState> state{SlotState::free};
+    u64 frame{0};            //!< sequence number of the captured frame
+    hermes::size2 size;
+  };
+
+  Slot *acquireSlot(const hermes::size2 &size);
+  void submit(Slot &slot);
+  void encode(Slot &slot);
+  bool parseFilePattern(const std::string &pattern);
+  [[nodiscard]] std::string filename(u64 frame) const;
+  bool write(const Slot &slot);
+  void release(Slot &slot, bool success, f64 ms);
+  void destroySlots();
+
+  Options options_;
+  bool recording_{false};
+  std::vector<std::unique_ptr<Slot>> slots_;
+  std::unique_ptr<JobSystem> encoders_;
+  GLenum pixel_type_{GL_UNSIGNED_BYTE};
+  u32 pixel_size_{4};
+  u64 next_frame_{0};
+  // file name = prefix + frame number (padded to frame_width_) + suffix
+  std::string filename_prefix_;
+  std::string filename_suffix_;
+  u32 frame_width_{0};
+  char frame_fill_{' '};
+  hermes::size2 video_size_;
+  FILE *pipe_{nullptr};
+  // ffmpeg frames are written in capture order by whichever encoder thread
+  // holds the next frame
+  std::mutex write_mutex_;
+  std::map<u64, Slot *> ready_frames_;
+  u64 next_write_{0};
+  // counters and release notification
+  mutable std::mutex stats_mutex_;
+  std::condition_variable released_;
+  Stats stats_;
+};
+
+}
+
+#endif //CIRCE_CIRCE_GL_IO_FRAME_RECORDER_H
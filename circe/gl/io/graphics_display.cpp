@@ -85,12 +85,30 @@ bool GraphicsDisplay::init() {
   glfwSetCursorPosCallback(window, pos_callback);
   glfwSetScrollCallback(window, scroll_callback);
   glfwSetWindowSizeCallback(window, resize_callback);
+  glfwSetWindowRefreshCallback(window, refresh_callback);
   initialize();
   return true;
 }
 
 int GraphicsDisplay::start() {
+  double last_frame_time = -1;
   while (!glfwWindowShouldClose(this->window)) {
+    // frame rate cap: keep handling events until the next frame is due
+    double elapsed = glfwGetTime() - last_frame_time;
+    if (max_fps > 0 && last_frame_time >= 0 && elapsed < 1.0 / max_fps) {
+      glfwWaitEventsTimeout(1.0 / max_fps - elapsed);
+      continue;
+    }
+    // on demand: sleep until an event or a redraw request arrives
+    if (on_demand_rendering && !redraw_requests_ && invalidationCallback && invalidationCallback())
+      requestRedraw();
+    if (on_demand_rendering && !redraw_requests_) {
+      glfwWaitEventsTimeout(idle_timeout);
+      continue;
+    }
+    u32 requests = redraw_requests_;
+    while (requests && !redraw_requests_.compare_exchange_weak(requests, requests - 1));
+    last_frame_time = glfwGetTime();
     glfwGetFramebufferSize(window, &this->width, &this->height);
     glViewport(0, 0, this->width, this->height);
     if (this->renderCallback) {
@@ -104,6 +122,13 @@ int GraphicsDisplay::start() {
   return 0;
 }
 
+void GraphicsDisplay::requestRedraw(u32 frame_count) {
+  u32 requests = redraw_requests_;
+  while (requests < frame_count && !redraw_requests_.compare_exchange_weak(requests, frame_count));
+  if (window && on_demand_rendering)
+    glfwPostEmptyEvent();
+}
+
 bool GraphicsDisplay::isRunning() {
   return !glfwWindowShouldClose(this->window);
 }
@@ -192,6 +217,7 @@ void GraphicsDisplay::charFunc(unsigned int codepoint) {
 void GraphicsDisplay::char_callback(GLFWwindow *window,
                                     unsigned int codepoint) {
   HERMES_UNUSED_VARIABLE(window);
+  instance_.requestRedraw(instance_.frames_per_event);
   if (instance_.keyCallback)
     instance_.charCallback(codepoint);
   else
@@ -215,6 +241,7 @@ void GraphicsDisplay::dropFunc(int count, const char **filenames) {
 void GraphicsDisplay::drop_callback(GLFWwindow *window, int count,
                                     const char **filenames) {
   HERMES_UNUSED_VARIABLE(window);
+  instance_.requestRedraw(instance_.frames_per_event);
   if (instance_.keyCallback)
     instance_.dropCallback(count, filenames);
   else
@@ -233,6 +260,7 @@ void GraphicsDisplay::registerKeyFunc(
 void GraphicsDisplay::key_callback(GLFWwindow *window, int key, int scancode,
                                    int action, int mods) {
   HERMES_UNUSED_VARIABLE(window);
+  instance_.requestRedraw(instance_.frames_per_event);
   if (instance_.keyCallback)
     instance_.keyCallback(key, scancode, action, mods);
   else
@@ -260,6 +288,7 @@ void GraphicsDisplay::registerButtonFunc(
 void GraphicsDisplay::button_callback(GLFWwindow *window, int button,
                                       int action, int mods) {
   HERMES_UNUSED_VARIABLE(window);
+  instance_.requestRedraw(instance_.frames_per_event);
   if (instance_.buttonCallback)
     instance_.buttonCallback(button, action, mods);
   else
@@ -284,6 +313,7 @@ void GraphicsDisplay::registerMouseFunc(
 
 void GraphicsDisplay::pos_callback(GLFWwindow *window, double x, double y) {
   HERMES_UNUSED_VARIABLE(window);
+  instance_.requestRedraw(instance_.frames_per_event);
   if (instance_.mouseCallback)
     instance_.mouseCallback(x, y);
   else
@@ -307,6 +337,7 @@ void GraphicsDisplay::registerScrollFunc(
 
 void GraphicsDisplay::scroll_callback(GLFWwindow *window, double x, double y) {
   HERMES_UNUSED_VARIABLE(window);
+  instance_.requestRedraw(instance_.frames_per_event);
   if (instance_.scrollCallback)
     instance_.scrollCallback(x, y);
   else
@@ -328,6 +359,7 @@ void GraphicsDisplay::registerResizeFunc(
 
 void GraphicsDisplay::resize_callback(GLFWwindow *window, int w, int h) {
   HERMES_UNUSED_VARIABLE(window);
+  instance_.requestRedraw(instance_.frames_per_event);
   instance_.resizeFunc(w, h);
   if (instance_.resizeCallback) {
     instance_.getWindowSize(w, h);
@@ -343,6 +375,12 @@ void GraphicsDisplay::resizeFunc(int w, int h) {
   glfwGetFramebufferSize(window, &this->width, &this->height);
 }
 
+void GraphicsDisplay::refresh_callback(GLFWwindow *window) {
+  HERMES_UNUSED_VARIABLE(window);
+  // window contents were damaged (exposed, restored, ...)
+  instance_.requestRedraw();
+}
+
 GLFWwindow *GraphicsDisplay::getGLFWwindow() { return window; }
 
 } // namespace circe
@@ -28,6 +28,7 @@
 #include <circe/scene/camera_interface.h>
 #include <circe/gl/utils/open_gl.h>
 
+#include <atomic>
 #include <functional>
 #include <memory>
 
@@ -92,6 +93,12 @@ public:
    * \returns **true** if application is running
    */
   bool isRunning();
+  /* redraw
+   * \param frame_count **[in]** minimum number of frames to render
+   * Asks the main loop to render (needed by on demand rendering only). It can
+   * be called from any thread, a waiting main loop is woken up.
+   */
+  void requestRedraw(u32 frame_count = 1);
   // IO
   void registerCharFunc(const std::function<void(unsigned int)> &f);
   void registerDropFunc(const std::function<void(int, const char **)> &f);
@@ -128,6 +135,21 @@ public:
   std::function<void(double, double)> mouseCallback;
   std::function<void(double, double)> scrollCallback;
   std::function<void(int, int)> resizeCallback;
+  /// on demand: polled before sleeping, returns true if something changed
+  /// since the last frame (ex: a camera moved by code)
+  std::function<bool()> invalidationCallback;
+
+  // RENDER LOOP
+  /// renders only after input events, resizes and requestRedraw() calls,
+  /// otherwise the main loop sleeps in glfwWaitEventsTimeout
+  bool on_demand_rendering{false};
+  /// on demand: maximum time (in seconds) the main loop sleeps at once
+  double idle_timeout{0.5};
+  /// on demand: frames rendered after an input event (lets ImGui update its
+  /// hover and focus states)
+  u32 frames_per_event{3};
+  /// frame rate cap (0 = uncapped)
+  double max_fps{0};
 
 private:
   static GraphicsDisplay instance_;
@@ -141,6 +163,7 @@ private:
   GLFWwindow *window;
   const char *title;
   int width, height;
+  std::atomic<u32> redraw_requests_{1};
 
   std::vector<std::function<void()>> renderCallbacks;
   std::vector<std::function<void(unsigned int)>> charCallbacks;
@@ -172,6 +195,7 @@ private:
   static void pos_callback(GLFWwindow *window, double x, double y);
   static void scroll_callback(GLFWwindow *window, double x, double y);
   static void resize_callback(GLFWwindow *window, int w, int h);
+  static void refresh_callback(GLFWwindow *window);
 };
 
 /* create
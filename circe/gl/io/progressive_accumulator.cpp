@@ -0,0 +1,118 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file progressive_accumulator.cpp
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+#include <circe/gl/io/progressive_accumulator.h>
+
+namespace circe::gl {
+
+ProgressiveAccumulator::ProgressiveAccumulator() {
+  accumulation_.setTarget(GL_TEXTURE_2D);
+  accumulation_.setInternalFormat(GL_RGBA32F);
+  accumulation_.setFormat(GL_RGBA);
+  accumulation_.setType(GL_FLOAT);
+}
+
+ProgressiveAccumulator::ProgressiveAccumulator(const hermes::size2 &resolution) : ProgressiveAccumulator() {
+  resize(resolution);
+}
+
+ProgressiveAccumulator::~ProgressiveAccumulator() = default;
+
+void ProgressiveAccumulator::resize(const hermes::size2 &resolution) {
+  accumulation_.resize(resolution);
+  accumulation_.bind();
+  Texture::View view(GL_TEXTURE_2D);
+  view.apply();
+  framebuffer_.resize(resolution);
+  framebuffer_.attachTexture(accumulation_);
+  reset();
+}
+
+bool ProgressiveAccumulator::accumulate(const CameraInterface &camera, const std::function<void(u32)> &f) {
+  auto camera_transform = camera.getTransform();
+  if (!sameTransform(camera_transform, last_camera_transform_)) {
+    last_camera_transform_ = camera_transform;
+    reset();
+  }
+  if (converged())
+    return false;
+  // first sample overwrites the target, next ones are blended as a running mean
+  framebuffer_.clear_color = Color(0, 0, 0, 0);
+  framebuffer_.clear_bitfield_mask = sample_count_ ? GL_DEPTH_BUFFER_BIT :
+                                     GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT;
+  // the caller may be rendering into a viewport of another framebuffer
+  GLint viewport[4], draw_framebuffer = 0;
+  glGetIntegerv(GL_VIEWPORT, viewport);
+  glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &draw_framebuffer);
+  GLboolean blend_enabled = glIsEnabled(GL_BLEND);
+  GLint blend_src_rgb = 0, blend_dst_rgb = 0, blend_src_alpha = 0, blend_dst_alpha = 0;
+  glGetIntegerv(GL_BLEND_SRC_RGB, &blend_src_rgb);
+  glGetIntegerv(GL_BLEND_DST_RGB, &blend_dst_rgb);
+  glGetIntegerv(GL_BLEND_SRC_ALPHA, &blend_src_alpha);
+  glGetIntegerv(GL_BLEND_DST_ALPHA, &blend_dst_alpha);
+  GLfloat blend_color[4];
+  glGetFloatv(GL_BLEND_COLOR, blend_color);
+  glEnable(GL_BLEND);
+  glBlendColor(0.f, 0.f, 0.f, 1.f / static_cast<f32>(sample_count_ + 1));
+  glBlendFunc(GL_CONSTANT_ALPHA, GL_ONE_MINUS_CONSTANT_ALPHA);
+  framebuffer_.render([&]() { f(sample_count_); });
+  glBlendFuncSeparate(blend_src_rgb, blend_dst_rgb, blend_src_alpha, blend_dst_alpha);
+  glBlendColor(blend_color[0], blend_color[1], blend_color[2], blend_color[3]);
+  if (!blend_enabled)
+    glDisable(GL_BLEND);
+  glBindFramebuffer(GL_DRAW_FRAMEBUFFER, draw_framebuffer);
+  glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+  sample_count_++;
+  CHECK_GL_ERRORS;
+  return true;
+}
+
+void ProgressiveAccumulator::reset() {
+  sample_count_ = 0;
+}
+
+void ProgressiveAccumulator::render() {
+  accumulation_.bind(GL_TEXTURE0);
+  screen_.shader->begin();
+  screen_.shader->setUniform("tex", 0);
+  screen_.shader->end();
+  screen_.render();
+}
+
+const Texture &ProgressiveAccumulator::texture() const {
+  return accumulation_;
+}
+
+u32 ProgressiveAccumulator::sampleCount() const {
+  return sample_count_;
+}
+
+bool ProgressiveAccumulator::converged() const {
+  return max_samples && sample_count_ >= max_samples;
+}
+
+}
@@ -0,0 +1,106 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file progressive_accumulator.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+#ifndef CIRCE_CIRCE_GL_IO_PROGRESSIVE_ACCUMULATOR_H
+#define CIRCE_CIRCE_GL_IO_PROGRESSIVE_ACCUMULATOR_H
+
+#include <circe/gl/io/framebuffer.h>
+#include <circe/gl/io/screen_quad.h>
+#include <circe/gl/texture/texture.h>
+#include <circe/scene/camera_interface.h>
+#include <functional>
+
+namespace circe::gl {
+
+/// Progressive accumulation of stochastic renderings (path tracing, delta
+/// tracking, ...).
+/// Each call to accumulate renders one new sample per pixel and blends it
+/// into a RGBA32F target as a running mean: accum += (sample - accum) / n.
+/// The blend is done by fixed function blending (GL_CONSTANT_ALPHA), so the
+/// sample is rendered straight into the accumulation target.
+/// Accumulation restarts automatically whenever the camera transform changes
+/// and can be restarted manually (ex: when the volume data changes) with
+/// reset(). Interactive frames are noisy and converge while the view is idle.
+/// \code{.cpp}
+///     ProgressiveAccumulator accumulator({800, 800});
+///     // every frame
+///     if (volume_changed)
+///       accumulator.reset();
+///     accumulator.accumulate(camera, [&](u32 sample_index) {
+///       program.setUniform("sample_index", static_cast<int>(sample_index));
+///       box.draw();
+///     });
+///     accumulator.render();
+/// \endcode
+/// \note The sample callback must not change the blending state.
+class ProgressiveAccumulator {
+public:
+  // ***********************************************************************
+  //                           CONSTRUCTORS
+  // ***********************************************************************
+  ProgressiveAccumulator();
+  /// \param resolution accumulation target size in pixels
+  explicit ProgressiveAccumulator(const hermes::size2 &resolution);
+  ~ProgressiveAccumulator();
+  // ***********************************************************************
+  //                           METHODS
+  // ***********************************************************************
+  /// Resizes the accumulation target (restarts accumulation)
+  /// \param resolution in pixels
+  void resize(const hermes::size2 &resolution);
+  /// Renders and accumulates one more sample
+  /// \param camera accumulation restarts when its transform changes
+  /// \param f renders one sample per pixel, receives the sample index
+  /// \return false if max_samples were already accumulated (nothing rendered)
+  bool accumulate(const CameraInterface &camera, const std::function<void(u32)> &f);
+  /// Discards all accumulated samples
+  void reset();
+  /// Draws the accumulated image into the current framebuffer
+  void render();
+  // ***********************************************************************
+  //                           FIELDS
+  // ***********************************************************************
+  /// \return accumulated image (RGBA32F)
+  [[nodiscard]] const Texture &texture() const;
+  /// \return number of accumulated samples per pixel
+  [[nodiscard]] u32 sampleCount() const;
+  /// \return true if max_samples were accumulated
+  [[nodiscard]] bool converged() const;
+
+  u32 max_samples{0}; //!< accumulation stops at this count (0 = never stops)
+
+private:
+  Texture accumulation_;
+  Framebuffer framebuffer_;
+  ScreenQuad screen_;
+  hermes::Transform last_camera_transform_;
+  u32 sample_count_{0};
+};
+
+}
+
+#endif //CIRCE_CIRCE_GL_IO_PROGRESSIVE_ACCUMULATOR_H
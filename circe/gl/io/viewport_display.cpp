@@ -14,30 +14,44 @@ ViewportDisplay::ViewportDisplay(int x, int y, int width, int height, circe::vie
   else
     setCamera(UICamera::fromPerspective());
   input_enabled_ = !CIRCE_MASK_BIT(options, circe::viewport_options::no_input);
+  if (CIRCE_MASK_BIT(options, circe::viewport_options::cached))
+    enableRenderCache();
 }
 
 void ViewportDisplay::render(const std::function<void(CameraInterface *)> &f) {
   if (prepareRenderCallback)
     prepareRenderCallback(*this);
+  if (render_cache_ && !dynamic_resolution) {
+    renderCached(f);
+    return;
+  }
+  redrawn_ = true;
+  rendered_camera_transform_ = camera_.getTransform();
   glEnable(GL_BLEND);
   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
   glEnable(GL_DEPTH_TEST);
-  // TODO fix process
-//  renderer->process([&]() {
-//    if (f)
-//      f(camera.get());
-//    if (renderCallback)
-//      renderCallback(camera.get());
-//  });
-  //  glDisable(GL_DEPTH_TEST);
+  if (!renderer->postProcess().empty()) {
+    renderPostProcessed(f);
+    return;
+  }
   GraphicsDisplay &gd = GraphicsDisplay::instance();
   glViewport(position_.i, position_.j, resolution_.width, resolution_.height);
   glScissor(position_.i, position_.j, resolution_.width, resolution_.height);
   glEnable(GL_SCISSOR_TEST);
+  if (dynamic_resolution) {
+    // the scene goes through the scaled target
+    dynamic_resolution->render(position_, resolution_, clear_screen_color, [&]() {
+      if (renderCallback)
+        renderCallback(&camera_);
+      else if (f)
+        f(&camera_);
+    });
+    glDisable(GL_SCISSOR_TEST);
+    if (renderEndCallback)
+      renderEndCallback();
+    return;
+  }
   circe::gl::GraphicsDisplay::clearScreen(clear_screen_color);
-//  glEnable(GL_DEPTH_TEST);
-// TODO fix post-process
-//  renderer->render();
   if (renderCallback)
 //    renderCallback(camera.get());
     renderCallback(&camera_);
@@ -49,17 +63,88 @@ void ViewportDisplay::render(const std::function<void(CameraInterface *)> &f) {
     renderEndCallback();
 }
 
+void ViewportDisplay::renderPostProcessed(const std::function<void(CameraInterface *)> &f) {
+  // the scene is rendered into the renderer targets, where the chain runs
+  glDisable(GL_SCISSOR_TEST);
+  renderer->resize(resolution_.width, resolution_.height);
+  renderer->process([&]() {
+    circe::gl::GraphicsDisplay::clearScreen(clear_screen_color);
+    if (renderCallback)
+      renderCallback(&camera_);
+    else if (f)
+      f(&camera_);
+  });
+  // composite: the processed frame is drawn into the viewport region
+  glViewport(position_.i, position_.j, resolution_.width, resolution_.height);
+  glScissor(position_.i, position_.j, resolution_.width, resolution_.height);
+  glEnable(GL_SCISSOR_TEST);
+  glDisable(GL_DEPTH_TEST);
+  glDisable(GL_BLEND);
+  renderer->render();
+  glEnable(GL_BLEND);
+  glEnable(GL_DEPTH_TEST);
+  glDisable(GL_SCISSOR_TEST);
+  if (renderEndCallback)
+    renderEndCallback();
+}
+
+void ViewportDisplay::renderCached(const std::function<void(CameraInterface *)> &f) {
+  auto &cache = *render_cache_;
+  if (cache.resolution.width != resolution_.width || cache.resolution.height != resolution_.height) {
+    cache.resolution = resolution_;
+    cache.color.resize(resolution_);
+    cache.color.bind();
+    Texture::View(GL_TEXTURE_2D).apply();
+    cache.framebuffer.resize(resolution_);
+    cache.framebuffer.attachTexture(cache.color);
+    cache.dirty = true;
+  }
+  redrawn_ = cache.dirty || cameraChanged();
+  glDisable(GL_SCISSOR_TEST);
+  if (redrawn_) {
+    rendered_camera_transform_ = camera_.getTransform();
+    cache.framebuffer.clear_color = clear_screen_color;
+    cache.framebuffer.render([&]() {
+      glEnable(GL_BLEND);
+      glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+      glEnable(GL_DEPTH_TEST);
+      if (renderCallback)
+        renderCallback(&camera_);
+      else if (f)
+        f(&camera_);
+    });
+    cache.dirty = false;
+  }
+  // composite: the cached image is copied into the viewport region
+  cache.framebuffer.enable();
+  glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+  glViewport(position_.i, position_.j, resolution_.width, resolution_.height);
+  glScissor(position_.i, position_.j, resolution_.width, resolution_.height);
+  glEnable(GL_SCISSOR_TEST);
+  glBlitFramebuffer(0, 0, resolution_.width, resolution_.height,
+                    position_.i, position_.j, position_.i + resolution_.width, position_.j + resolution_.height,
+                    GL_COLOR_BUFFER_BIT, GL_NEAREST);
+  Framebuffer::disable();
+  glDisable(GL_SCISSOR_TEST);
+  if (renderEndCallback)
+    renderEndCallback();
+}
+
 void ViewportDisplay::mouse(double x, double y) {
   if (!input_enabled_)
     return;
   if (mouseCallback)
     mouseCallback(x, y);
+  if (render_cache_ && hasMouseFocus())
+    render_cache_->dirty = true;
   camera_.mouseMove(getMouseNPos());
 }
 
 void ViewportDisplay::scroll(double dx, double dy) {
   if (!input_enabled_)
     return;
+  if (render_cache_ && hasMouseFocus())
+    render_cache_->dirty = true;
   camera_.mouseScroll(getMouseNPos(), hermes::vec2(dx, dy));
 }
 
@@ -68,6 +153,8 @@ void ViewportDisplay::button(int b, int a, int m) {
     return;
   if (buttonCallback)
     buttonCallback(b, a, m);
+  if (render_cache_ && hasMouseFocus())
+    render_cache_->dirty = true;
   camera_.mouseButton(a, b, getMouseNPos());
 }
 
@@ -76,6 +163,8 @@ void ViewportDisplay::key(int k, int scancode, int action, int modifiers) const
     return;
   if (keyCallback)
     keyCallback(k, scancode, action, modifiers);
+  if (render_cache_ && hasMouseFocus())
+    render_cache_->dirty = true;
 }
 
 hermes::point2 ViewportDisplay::getMouseNPos() const {
@@ -126,12 +215,14 @@ hermes::index2 ViewportDisplay::project(const hermes::point3 &p) const {
 void ViewportDisplay::setCamera(const UICamera &viewport_camera) {
   camera_ = viewport_camera;
   camera_.resize(resolution_.width, resolution_.height);
+  GraphicsDisplay::instance().requestRedraw();
 }
 
 void ViewportDisplay::resize(int w, int h) {
   camera_.resize(w, h);
   resolution_.width = w;
   resolution_.height = h;
+  GraphicsDisplay::instance().requestRedraw();
 }
 
 const hermes::size2 &ViewportDisplay::size() const {
@@ -155,6 +246,50 @@ const UICamera &ViewportDisplay::camera() const {
   return camera_;
 }
 
+void ViewportDisplay::enableDynamicResolution(f32 target_ms) {
+  if (!dynamic_resolution)
+    dynamic_resolution = std::make_shared<DynamicResolution>(target_ms);
+  dynamic_resolution->target_ms = target_ms;
+}
+
+void ViewportDisplay::disableDynamicResolution() {
+  dynamic_resolution.reset();
+}
+
+f32 ViewportDisplay::resolutionScale() const {
+  return dynamic_resolution ? dynamic_resolution->scale() : 1.f;
+}
+
+void ViewportDisplay::enableRenderCache() {
+  if (!render_cache_) {
+    render_cache_ = std::make_shared<RenderCache>();
+    render_cache_->color.setTarget(GL_TEXTURE_2D);
+    render_cache_->color.setInternalFormat(GL_RGBA8);
+    render_cache_->color.setFormat(GL_RGBA);
+    render_cache_->color.setType(GL_UNSIGNED_BYTE);
+  }
+  invalidate();
+}
+
+void ViewportDisplay::disableRenderCache() {
+  render_cache_.reset();
+  GraphicsDisplay::instance().requestRedraw();
+}
+
+void ViewportDisplay::invalidate() {
+  if (render_cache_)
+    render_cache_->dirty = true;
+  GraphicsDisplay::instance().requestRedraw();
+}
+
+bool ViewportDisplay::redrawn() const {
+  return redrawn_;
+}
+
+bool ViewportDisplay::cameraChanged() const {
+  return !sameTransform(camera_.getTransform(), rendered_camera_transform_);
+}
+
 void ViewportDisplay::disableInput() {
   input_enabled_ = false;
 }
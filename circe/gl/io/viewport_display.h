@@ -27,6 +27,7 @@
 
 #include <circe/ui/options.h>
 #include <circe/gl/io/display_renderer.h>
+#include <circe/gl/io/dynamic_resolution.h>
 #include <circe/ui/ui_camera.h>
 #include <circe/colors/color.h>
 
@@ -97,6 +98,31 @@ public:
   [[nodiscard]] hermes::index2 getMousePos() const;
   /// \return true if mouse is inside viewport region
   [[nodiscard]] bool hasMouseFocus() const;
+  //                                                                                               dynamic resolution
+  /// \brief Renders the viewport at a scale that holds a GPU time budget
+  /// \param target_ms GPU time budget in milliseconds
+  void enableDynamicResolution(f32 target_ms = 16.f);
+  /// \brief Goes back to rendering at full resolution
+  void disableDynamicResolution();
+  /// \return current resolution scale (1 when dynamic resolution is disabled)
+  [[nodiscard]] f32 resolutionScale() const;
+  //                                                                                                    invalidation
+  /// \return true if the camera moved since the last render
+  [[nodiscard]] bool cameraChanged() const;
+  //                                                                                                     render cache
+  /// \brief Renders the viewport into its own offscreen target, which is only
+  /// redrawn when the viewport changes (camera moves, resizes, input with
+  /// mouse focus or invalidate()). Unchanged frames just blit the target.
+  /// \note Ignored while dynamic resolution is enabled
+  void enableRenderCache();
+  /// \brief Renders directly into the window again
+  void disableRenderCache();
+  /// \brief Forces the next render to redraw the viewport (cached viewports
+  /// need it whenever their content changes)
+  void invalidate();
+  /// \return true if the last render() redrew the viewport (false when the
+  /// cached image was reused)
+  [[nodiscard]] bool redrawn() const;
   //                                                                                                           update
   void render(const std::function<void(CameraInterface *)> &f = nullptr);
   void mouse(double x, double y);
@@ -120,13 +146,33 @@ public:
   // viewport
   circe::Color clear_screen_color{circe::Color::White()};
 
+  /// scene frames go through it when its post process chain is not empty
+  /// \note The chain is not applied while the render cache or dynamic
+  /// resolution is enabled
   std::shared_ptr<DisplayRenderer> renderer;
+  /// dynamic resolution controller (null when disabled), exposes timings
+  std::shared_ptr<DynamicResolution> dynamic_resolution;
 
 private:
+  /// Offscreen copy of the viewport
+  struct RenderCache {
+    Framebuffer framebuffer;
+    Texture color;
+    hermes::size2 resolution;
+    bool dirty{true};
+  };
+
+  void renderPostProcessed(const std::function<void(CameraInterface *)> &f);
+  void renderCached(const std::function<void(CameraInterface *)> &f);
+
   UICamera camera_;
+  hermes::Transform rendered_camera_transform_;
   hermes::size2 resolution_;
   hermes::index2 position_;
   bool input_enabled_{true};
+  bool redrawn_{true};
+  // shared, viewports are copied around by App
+  std::shared_ptr<RenderCache> render_cache_;
 };
 
 } // namespace circe
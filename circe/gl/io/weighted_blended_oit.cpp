@@ -0,0 +1,224 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file weighted_blended_oit.cpp
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+
+#include <circe/gl/io/weighted_blended_oit.h>
+#include <hermes/common/debug.h>
+#include <algorithm>
+
+namespace circe::gl {
+
+namespace {
+
+const char *composite_vs = "#version 440 core\n"
+                           "void main() {\n"
+                           "  vec2 p = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);\n"
+                           "  gl_Position = vec4(p * 2.0 - 1.0, 0.0, 1.0);\n"
+                           "}\n";
+
+const char *composite_fs = "#version 440 core\n"
+                           "layout(binding = 0) uniform sampler2D accumulation;\n"
+                           "layout(binding = 1) uniform sampler2D revealage;\n"
+                           "uniform ivec2 origin;\n"
+                           "layout(location = 0) out vec4 color;\n"
+                           "void main() {\n"
+                           "  ivec2 p = ivec2(gl_FragCoord.xy) - origin;\n"
+                           "  float r = texelFetch(revealage, p, 0).r;\n"
+                           // no transparent fragment here
+                           "  if (r >= 1.0)\n"
+                           "    discard;\n"
+                           "  vec4 a = texelFetch(accumulation, p, 0);\n"
+                           // large weights may overflow half floats
+                           "  if (isinf(max(max(abs(a.r), abs(a.g)), abs(a.b))))\n"
+                           "    a.rgb = vec3(a.a);\n"
+                           // blended with (1 - alpha) * src + alpha * dst
+                           "  color = vec4(a.rgb / max(a.a, 1e-5), r);\n"
+                           "}\n";
+
+}
+
+std::string WeightedBlendedOIT::glsl() {
+  return "layout(location = 0) out vec4 oit_accumulation;\n"
+         "layout(location = 1) out float oit_revealage;\n"
+         "void oitWriteWeighted(vec4 color, float w) {\n"
+         "  float a = clamp(color.a, 0.0, 1.0);\n"
+         "  oit_accumulation = vec4(color.rgb * a, a) * (a * w);\n"
+         "  oit_revealage = a;\n"
+         "}\n"
+         // view_depth: distance along the view direction (eq. 9 of the paper)
+         "void oitWrite(vec4 color, float view_depth) {\n"
+         "  float z = abs(view_depth);\n"
+         "  oitWriteWeighted(color, clamp(10.0 / (1e-5 + pow(z / 5.0, 2.0) + pow(z / 200.0, 6.0)), 1e-2, 3e3));\n"
+         "}\n"
+         // window depth version (eq. 10 of the paper)
+         "void oitWrite(vec4 color) {\n"
+         "  oitWriteWeighted(color, clamp(3e3 * pow(1.0 - gl_FragCoord.z, 3.0), 1e-2, 3e3));\n"
+         "}\n";
+}
+
+WeightedBlendedOIT::WeightedBlendedOIT() {
+  accumulation_.setTarget(GL_TEXTURE_2D);
+  accumulation_.setInternalFormat(GL_RGBA16F);
+  accumulation_.setFormat(GL_RGBA);
+  accumulation_.setType(GL_FLOAT);
+  revealage_.setTarget(GL_TEXTURE_2D);
+  revealage_.setInternalFormat(GL_R16F);
+  revealage_.setFormat(GL_RED);
+  revealage_.setType(GL_FLOAT);
+}
+
+WeightedBlendedOIT::~WeightedBlendedOIT() {
+  if (vao_)
+    glDeleteVertexArrays(1, &vao_);
+}
+
+void WeightedBlendedOIT::resize(const hermes::size2 &resolution) {
+  if (resolution.width == resolution_.width && resolution.height == resolution_.height &&
+      allocated_depth_format_ == depth_format)
+    return;
+  resolution_ = resolution;
+  allocated_depth_format_ = depth_format;
+  for (auto *texture : {&accumulation_, &revealage_}) {
+    texture->resize(resolution);
+    texture->bind();
+    Texture::View(GL_TEXTURE_2D).apply();
+  }
+  framebuffer_.setRenderBufferStorageInternalFormat(depth_format);
+  framebuffer_.resize(resolution);
+  framebuffer_.attachTexture(accumulation_, GL_COLOR_ATTACHMENT0);
+  framebuffer_.attachTexture(revealage_, GL_COLOR_ATTACHMENT1);
+  framebuffer_.setOutputBuffers({GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1});
+}
+
+void WeightedBlendedOIT::render(const std::function<void()> &f) {
+  accumulate(f);
+  composite();
+}
+
+void WeightedBlendedOIT::accumulate(const std::function<void()> &f) {
+  glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &target_framebuffer_);
+  glGetIntegerv(GL_VIEWPORT, target_viewport_);
+  if (target_viewport_[2] <= 0 || target_viewport_[3] <= 0)
+    return;
+  resize(hermes::size2(target_viewport_[2], target_viewport_[3]));
+  // blits and clears are clipped by the scissor box of the viewport
+  GLboolean scissor_test = glIsEnabled(GL_SCISSOR_TEST);
+  glDisable(GL_SCISSOR_TEST);
+  framebuffer_.enable();
+  glViewport(0, 0, resolution_.width, resolution_.height);
+  if (copy_depth) {
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, target_framebuffer_);
+    glBlitFramebuffer(target_viewport_[0], target_viewport_[1],
+                      target_viewport_[0] + target_viewport_[2], target_viewport_[1] + target_viewport_[3],
+                      0, 0, resolution_.width, resolution_.height, GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+    framebuffer_.enable();
+  } else {
+    glClear(GL_DEPTH_BUFFER_BIT);
+  }
+  const GLfloat zero[4] = {0.f, 0.f, 0.f, 0.f};
+  const GLfloat one[4] = {1.f, 1.f, 1.f, 1.f};
+  glClearBufferfv(GL_COLOR, 0, zero);
+  glClearBufferfv(GL_COLOR, 1, one);
+  // save the state we touch
+  GLboolean depth_test = glIsEnabled(GL_DEPTH_TEST);
+  GLboolean depth_mask = GL_TRUE;
+  glGetBooleanv(GL_DEPTH_WRITEMASK, &depth_mask);
+  GLboolean blend = glIsEnabled(GL_BLEND);
+  GLint blend_src_rgb, blend_dst_rgb, blend_src_alpha, blend_dst_alpha;
+  glGetIntegerv(GL_BLEND_SRC_RGB, &blend_src_rgb);
+  glGetIntegerv(GL_BLEND_DST_RGB, &blend_dst_rgb);
+  glGetIntegerv(GL_BLEND_SRC_ALPHA, &blend_src_alpha);
+  glGetIntegerv(GL_BLEND_DST_ALPHA, &blend_dst_alpha);
+  // accumulation is additive, revealage is multiplicative
+  glEnable(GL_DEPTH_TEST);
+  glDepthMask(GL_FALSE);
+  glEnable(GL_BLEND);
+  glBlendEquation(GL_FUNC_ADD);
+  glBlendFunci(0, GL_ONE, GL_ONE);
+  glBlendFunci(1, GL_ZERO, GL_ONE_MINUS_SRC_COLOR);
+  if (f)
+    f();
+  glDepthMask(depth_mask);
+  if (!depth_test)
+    glDisable(GL_DEPTH_TEST);
+  if (!blend)
+    glDisable(GL_BLEND);
+  glBlendFuncSeparate(blend_src_rgb, blend_dst_rgb, blend_src_alpha, blend_dst_alpha);
+  glBindFramebuffer(GL_FRAMEBUFFER, target_framebuffer_);
+  glViewport(target_viewport_[0], target_viewport_[1], target_viewport_[2], target_viewport_[3]);
+  if (scissor_test)
+    glEnable(GL_SCISSOR_TEST);
+  CHECK_GL_ERRORS;
+}
+
+void WeightedBlendedOIT::composite() {
+  if (!resolution_.width || !resolution_.height)
+    return;
+  if (!composite_program_.good()) {
+    composite_program_.attach(Shader(GL_VERTEX_SHADER, composite_vs));
+    composite_program_.attach(Shader(GL_FRAGMENT_SHADER, composite_fs));
+    if (!composite_program_.link())
+      HERMES_LOG_ERROR("failed to compile oit composite shader: {}", composite_program_.err);
+    glGenVertexArrays(1, &vao_);
+  }
+  glBindFramebuffer(GL_FRAMEBUFFER, target_framebuffer_);
+  glViewport(target_viewport_[0], target_viewport_[1], target_viewport_[2], target_viewport_[3]);
+  GLboolean depth_test = glIsEnabled(GL_DEPTH_TEST);
+  GLboolean blend = glIsEnabled(GL_BLEND);
+  GLint blend_src_rgb, blend_dst_rgb, blend_src_alpha, blend_dst_alpha;
+  glGetIntegerv(GL_BLEND_SRC_RGB, &blend_src_rgb);
+  glGetIntegerv(GL_BLEND_DST_RGB, &blend_dst_rgb);
+  glGetIntegerv(GL_BLEND_SRC_ALPHA, &blend_src_alpha);
+  glGetIntegerv(GL_BLEND_DST_ALPHA, &blend_dst_alpha);
+  glDisable(GL_DEPTH_TEST);
+  glEnable(GL_BLEND);
+  glBlendEquation(GL_FUNC_ADD);
+  glBlendFunc(GL_ONE_MINUS_SRC_ALPHA, GL_SRC_ALPHA);
+  composite_program_.use();
+  glUniform2i(glGetUniformLocation(composite_program_.id(), "origin"), target_viewport_[0], target_viewport_[1]);
+  accumulation_.bind(GL_TEXTURE0);
+  revealage_.bind(GL_TEXTURE1);
+  glBindVertexArray(vao_);
+  glDrawArrays(GL_TRIANGLES, 0, 3);
+  glBindVertexArray(0);
+  glBlendFuncSeparate(blend_src_rgb, blend_dst_rgb, blend_src_alpha, blend_dst_alpha);
+  if (depth_test)
+    glEnable(GL_DEPTH_TEST);
+  if (!blend)
+    glDisable(GL_BLEND);
+  CHECK_GL_ERRORS;
+}
+
+const Texture &WeightedBlendedOIT::accumulationTexture() const {
+  return accumulation_;
+}
+
+const Texture &WeightedBlendedOIT::revealageTexture() const {
+  return revealage_;
+}
+
+}
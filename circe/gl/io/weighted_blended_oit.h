@@ -0,0 +1,121 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file weighted_blended_oit.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+
+#ifndef CIRCE_CIRCE_GL_IO_WEIGHTED_BLENDED_OIT_H
+#define CIRCE_CIRCE_GL_IO_WEIGHTED_BLENDED_OIT_H
+
+#include <circe/gl/io/framebuffer.h>
+#include <circe/gl/graphics/shader.h>
+#include <circe/gl/texture/texture.h>
+
+namespace circe::gl {
+
+/// Order independent transparency with weighted blended accumulation
+/// (McGuire and Bavoil, 2013).
+/// Transparent fragments are blended, in any order, into two targets:
+///   - accumulation (RGBA16F): sum of weighted premultiplied colors and alphas;
+///   - revealage (R16F): product of (1 - alpha).
+/// Weights decrease with depth, so nearer surfaces dominate the average. A
+/// full screen pass then composites the average color over the opaque image.
+/// Transparent geometry needs no sorting and can go in a single instanced
+/// draw.
+/// The depth of the target framebuffer is copied into the pass, so opaque
+/// surfaces occlude transparent ones (depth writes are off while
+/// accumulating). The pass covers the viewport that is current when
+/// accumulate() is called.
+/// Transparent fragment shaders declare their outputs through glsl() and
+/// write with oitWrite(color, view_depth) (or oitWrite(color)):
+/// \code{.cpp}
+///     // fragment shader: #version line + WeightedBlendedOIT::glsl() + ...
+///     //   void main() { oitWrite(vec4(color.rgb, 0.4), view_depth); }
+///     WeightedBlendedOIT oit;
+///     // after opaque geometry, inside the viewport render callback
+///     oit.render([&]() { instance_set.draw(camera, transform); });
+/// \endcode
+/// \note The depth copy is a glBlitFramebuffer, which requires depth_format to
+/// match the depth format of the target framebuffer (GL_DEPTH24_STENCIL8 is
+/// the usual format of the default framebuffer).
+class WeightedBlendedOIT {
+public:
+  // ***********************************************************************
+  //                          STATIC METHODS
+  // ***********************************************************************
+  /// Fragment shader outputs and oitWrite functions, insert it right after the
+  /// #version line of transparent fragment shaders
+  /// \return glsl code
+  static std::string glsl();
+  // ***********************************************************************
+  //                           CONSTRUCTORS
+  // ***********************************************************************
+  WeightedBlendedOIT();
+  ~WeightedBlendedOIT();
+  WeightedBlendedOIT(const WeightedBlendedOIT &) = delete;
+  WeightedBlendedOIT &operator=(const WeightedBlendedOIT &) = delete;
+  // ***********************************************************************
+  //                           METHODS
+  // ***********************************************************************
+  /// Accumulates the transparent geometry drawn by f and composites it
+  /// \param f render callback
+  void render(const std::function<void()> &f);
+  /// Accumulates the transparent geometry drawn by f over the current viewport
+  /// of the currently bound draw framebuffer
+  /// \param f render callback
+  void accumulate(const std::function<void()> &f);
+  /// Blends the accumulated transparency over the framebuffer and viewport of
+  /// the last accumulate()
+  void composite();
+  // ***********************************************************************
+  //                           FIELDS
+  // ***********************************************************************
+  /// \return accumulation target
+  [[nodiscard]] const Texture &accumulationTexture() const;
+  /// \return revealage target
+  [[nodiscard]] const Texture &revealageTexture() const;
+  // ***********************************************************************
+  //                           PUBLIC FIELDS
+  // ***********************************************************************
+  GLenum depth_format{GL_DEPTH24_STENCIL8}; //!< internal format of the depth copy
+  bool copy_depth{true}; //!< false: transparent geometry is not occluded
+
+private:
+  void resize(const hermes::size2 &resolution);
+
+  Framebuffer framebuffer_;
+  Texture accumulation_;
+  Texture revealage_;
+  Program composite_program_;
+  GLuint vao_{0};
+  hermes::size2 resolution_;
+  GLenum allocated_depth_format_{0};
+  GLint target_framebuffer_{0};
+  GLint target_viewport_[4]{0, 0, 0, 0};
+};
+
+}
+
+#endif //CIRCE_CIRCE_GL_IO_WEIGHTED_BLENDED_OIT_H
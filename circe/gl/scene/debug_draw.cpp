@@ -0,0 +1,306 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file debug_draw.cpp
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+
+#include <circe/gl/scene/debug_draw.h>
+#include <hermes/common/debug.h>
+#include <hermes/numeric/numeric.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+
+namespace circe::gl {
+
+namespace {
+
+const char *debug_draw_vs = "#version 440 core\n"
+                            "layout(location = 0) in vec3 position;\n"
+                            "layout(location = 1) in vec4 color;\n"
+                            "uniform mat4 mvp;\n"
+                            "out vec4 vertex_color;\n"
+                            "void main() {\n"
+                            "  gl_Position = mvp * vec4(position, 1.0);\n"
+                            "  vertex_color = color;\n"
+                            "}\n";
+
+const char *debug_draw_fs = "#version 440 core\n"
+                            "in vec4 vertex_color;\n"
+                            "layout(location = 0) out vec4 frag_color;\n"
+                            "void main() {\n"
+                            "  frag_color = vertex_color;\n"
+                            "}\n";
+
+u32 packColor(const Color &color) {
+  auto channel = [](f32 c) -> u32 {
+    return static_cast<u32>(std::clamp(c, 0.f, 1.f) * 255.f + 0.5f);
+  };
+  return channel(color.r) | (channel(color.g) << 8) | (channel(color.b) << 16) | (channel(color.a) << 24);
+}
+
+/// \return unit vector orthogonal to v
+hermes::vec3 orthogonal(const hermes::vec3 &v) {
+  hermes::vec3 w = std::abs(v.x) < 0.9f * v.length() ? hermes::vec3(1, 0, 0) : hermes::vec3(0, 1, 0);
+  return hermes::normalize(hermes::cross(v, w));
+}
+
+void waitFence(GLsync &fence) {
+  if (!fence)
+    return;
+  waitSync(fence);
+  glDeleteSync(fence);
+  fence = nullptr;
+}
+
+}
+
+DebugDraw::DebugDraw(u32 frame_count) {
+  fences_.resize(std::max(1u, frame_count), nullptr);
+}
+
+DebugDraw::~DebugDraw() {
+  for (auto &fence : fences_)
+    if (fence)
+      glDeleteSync(fence);
+  if (vbo_)
+    glDeleteBuffers(1, &vbo_);
+  if (vao_)
+    glDeleteVertexArrays(1, &vao_);
+}
+
+std::vector<DebugDraw::Vertex> &DebugDraw::batch(Layer layer, Primitive primitive) {
+  return batches_[static_cast<u32>(layer)][primitive];
+}
+
+void DebugDraw::line(const hermes::point3 &a, const hermes::point3 &b, const Color &color, Layer layer) {
+  auto c = packColor(color);
+  auto &vertices = batch(layer, lines);
+  vertices.push_back({a.x, a.y, a.z, c});
+  vertices.push_back({b.x, b.y, b.z, c});
+}
+
+void DebugDraw::point(const hermes::point3 &p, const Color &color, Layer layer) {
+  batch(layer, points).push_back({p.x, p.y, p.z, packColor(color)});
+}
+
+void DebugDraw::triangle(const hermes::point3 &a, const hermes::point3 &b, const hermes::point3 &c,
+                         const Color &color, Layer layer) {
+  auto packed = packColor(color);
+  auto &vertices = batch(layer, triangles);
+  vertices.push_back({a.x, a.y, a.z, packed});
+  vertices.push_back({b.x, b.y, b.z, packed});
+  vertices.push_back({c.x, c.y, c.z, packed});
+}
+
+void DebugDraw::box(const hermes::bbox3 &bounds, const Color &color, Layer layer) {
+  box(bounds, hermes::Transform(), color, layer);
+}
+
+void DebugDraw::box(const hermes::bbox3 &bounds, const hermes::Transform &transform, const Color &color,
+                    Layer layer) {
+  hermes::point3 corners[8];
+  for (u32 i = 0; i < 8; ++i)
+    corners[i] = transform * hermes::point3((i & 1) ? bounds.upper.x : bounds.lower.x,
+                                            (i & 2) ? bounds.upper.y : bounds.lower.y,
+                                            (i & 4) ? bounds.upper.z : bounds.lower.z);
+  // corners that differ in a single bit share an edge
+  for (u32 i = 0; i < 8; ++i)
+    for (u32 bit = 1; bit < 8; bit <<= 1)
+      if (!(i & bit))
+        line(corners[i], corners[i | bit], color, layer);
+}
+
+void DebugDraw::arrow(const hermes::point3 &origin, const hermes::vec3 &v, const Color &color, f32 head_size,
+                      Layer layer) {
+  auto tip = origin + v;
+  line(origin, tip, color, layer);
+  if (v.length() == 0.f)
+    return;
+  auto head = head_size * v;
+  auto side = (0.5f * head.length()) * orthogonal(v);
+  line(tip, tip - head + side, color, layer);
+  line(tip, tip - head - side, color, layer);
+}
+
+void DebugDraw::grid(const hermes::point3 &origin, const hermes::vec3 &u, const hermes::vec3 &v, u32 u_count,
+                     u32 v_count, const Color &color, Layer layer) {
+  auto u_extent = static_cast<f32>(u_count) * u;
+  auto v_extent = static_cast<f32>(v_count) * v;
+  for (u32 i = 0; i <= u_count; ++i) {
+    auto p = origin + static_cast<f32>(i) * u;
+    line(p, p + v_extent, color, layer);
+  }
+  for (u32 j = 0; j <= v_count; ++j) {
+    auto p = origin + static_cast<f32>(j) * v;
+    line(p, p + u_extent, color, layer);
+  }
+}
+
+void DebugDraw::circle(const hermes::point3 &center, const hermes::vec3 &normal, f32 radius, const Color &color,
+                       u32 segments, Layer layer) {
+  segments = std::max(3u, segments);
+  auto a = orthogonal(normal);
+  auto b = hermes::normalize(hermes::cross(normal, a));
+  auto at = [&](u32 i) {
+    f32 angle = hermes::Constants::two_pi * i / segments;
+    return center + radius * (std::cos(angle) * a + std::sin(angle) * b);
+  };
+  for (u32 i = 0; i < segments; ++i)
+    line(at(i), at(i + 1), color, layer);
+}
+
+void DebugDraw::frustum(const CameraInterface &camera, const Color &color, Layer layer) {
+  // corner rays are unprojected at two depths, so it works for any projection
+  auto inverse_projection = hermes::inverse(camera.getProjectionTransform());
+  auto inverse_view = hermes::inverse(camera.getViewTransform());
+  f32 depths[2] = {camera.getNear(), camera.getFar()};
+  hermes::point3 corners[8];
+  for (u32 i = 0; i < 4; ++i) {
+    f32 x = (i & 1) ? 1.f : -1.f;
+    f32 y = (i & 2) ? 1.f : -1.f;
+    auto a = inverse_projection * hermes::point3(x, y, 0.25f);
+    auto b = inverse_projection * hermes::point3(x, y, 0.75f);
+    for (u32 d = 0; d < 2; ++d) {
+      f32 t = (-depths[d] - a.z) / (b.z - a.z);
+      corners[d * 4 + i] = inverse_view * hermes::point3(a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t, -depths[d]);
+    }
+  }
+  for (u32 i = 0; i < 8; ++i)
+    for (u32 bit = 1; bit < 8; bit <<= 1)
+      if (!(i & bit))
+        line(corners[i], corners[i | bit], color, layer);
+}
+
+void DebugDraw::reserve(u64 vertex_count) {
+  if (vertex_count <= frame_capacity_)
+    return;
+  for (auto &fence : fences_)
+    waitFence(fence);
+  if (vbo_)
+    glDeleteBuffers(1, &vbo_);
+  if (!vao_)
+    glGenVertexArrays(1, &vao_);
+  frame_capacity_ = std::max<u64>({vertex_count, 2 * frame_capacity_, 1u << 16});
+  GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+  u64 size = frame_capacity_ * fences_.size() * sizeof(Vertex);
+  glGenBuffers(1, &vbo_);
+  glBindVertexArray(vao_);
+  glBindBuffer(GL_ARRAY_BUFFER, vbo_);
+  glBufferStorage(GL_ARRAY_BUFFER, size, nullptr, flags);
+  mapped_ = reinterpret_cast<Vertex *>(glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags));
+  glEnableVertexAttribArray(0);
+  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<void *>(0));
+  glEnableVertexAttribArray(1);
+  glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex),
+                        reinterpret_cast<void *>(offsetof(Vertex, color)));
+  glBindVertexArray(0);
+  CHECK_GL_ERRORS;
+}
+
+void DebugDraw::render(const CameraInterface &camera) {
+  u64 vertex_count = vertexCount();
+  if (!vertex_count)
+    return;
+  if (!program_.good()) {
+    program_.attach(Shader(GL_VERTEX_SHADER, debug_draw_vs));
+    program_.attach(Shader(GL_FRAGMENT_SHADER, debug_draw_fs));
+    if (!program_.link()) {
+      HERMES_LOG_ERROR("failed to compile debug draw shader: {}", program_.err);
+      clear();
+      return;
+    }
+  }
+  reserve(vertex_count);
+  if (!mapped_) {
+    clear();
+    return;
+  }
+  // write this frame into the next region, once the GPU is done with it
+  frame_ = (frame_ + 1) % fences_.size();
+  waitFence(fences_[frame_]);
+  const u64 base = frame_ * frame_capacity_;
+  u64 first[2][primitive_count];
+  u64 offset = base;
+  for (u32 layer = 0; layer < 2; ++layer)
+    for (u32 primitive = 0; primitive < primitive_count; ++primitive) {
+      const auto &vertices = batches_[layer][primitive];
+      first[layer][primitive] = offset;
+      if (!vertices.empty())
+        std::memcpy(mapped_ + offset, vertices.data(), vertices.size() * sizeof(Vertex));
+      offset += vertices.size();
+    }
+  GLboolean depth_test = glIsEnabled(GL_DEPTH_TEST);
+  GLboolean blend = glIsEnabled(GL_BLEND);
+  GLint blend_src_rgb, blend_dst_rgb, blend_src_alpha, blend_dst_alpha;
+  glGetIntegerv(GL_BLEND_SRC_RGB, &blend_src_rgb);
+  glGetIntegerv(GL_BLEND_DST_RGB, &blend_dst_rgb);
+  glGetIntegerv(GL_BLEND_SRC_ALPHA, &blend_src_alpha);
+  glGetIntegerv(GL_BLEND_DST_ALPHA, &blend_dst_alpha);
+  glEnable(GL_BLEND);
+  glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+  glPointSize(point_size);
+  program_.use();
+  program_.setUniform("mvp", camera.getProjectionTransform() * camera.getViewTransform());
+  glBindVertexArray(vao_);
+  const GLenum modes[primitive_count] = {GL_LINES, GL_POINTS, GL_TRIANGLES};
+  for (u32 layer = 0; layer < 2; ++layer) {
+    if (layer == static_cast<u32>(Layer::depth_tested))
+      glEnable(GL_DEPTH_TEST);
+    else
+      glDisable(GL_DEPTH_TEST);
+    for (u32 primitive = 0; primitive < primitive_count; ++primitive)
+      if (!batches_[layer][primitive].empty())
+        glDrawArrays(modes[primitive], first[layer][primitive], batches_[layer][primitive].size());
+  }
+  glBindVertexArray(0);
+  fences_[frame_] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  if (depth_test)
+    glEnable(GL_DEPTH_TEST);
+  else
+    glDisable(GL_DEPTH_TEST);
+  glBlendFuncSeparate(blend_src_rgb, blend_dst_rgb, blend_src_alpha, blend_dst_alpha);
+  if (!blend)
+    glDisable(GL_BLEND);
+  CHECK_GL_ERRORS;
+  clear();
+}
+
+void DebugDraw::clear() {
+  for (auto &layer : batches_)
+    for (auto &vertices : layer)
+      vertices.clear();
+}
+
+u64 DebugDraw::vertexCount() const {
+  u64 count = 0;
+  for (const auto &layer : batches_)
+    for (const auto &vertices : layer)
+      count += vertices.size();
+  return count;
+}
+
+}
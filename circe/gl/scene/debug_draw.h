@@ -0,0 +1,179 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file debug_draw.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+
+#ifndef CIRCE_CIRCE_GL_SCENE_DEBUG_DRAW_H
+#define CIRCE_CIRCE_GL_SCENE_DEBUG_DRAW_H
+
+#include <circe/colors/color.h>
+#include <circe/gl/graphics/shader.h>
+#include <circe/scene/camera_interface.h>
+#include <hermes/geometry/bbox.h>
+
+namespace circe::gl {
+
+/// Batches debug geometry (lines, points, triangles, boxes, arrows, grids...)
+/// and draws it with one draw call per primitive type and layer.
+/// Primitives are collected on the host during the frame and streamed into a
+/// persistently mapped vertex buffer split in frame regions (fenced, so the
+/// host never writes a region the GPU is still reading). Primitives go to
+/// one of two layers: depth_tested, drawn with the scene depth buffer, and
+/// overlay, drawn on top of everything. Lines are rasterized one pixel wide,
+/// since core profile contexts reject wider GL lines.
+/// \code{.cpp}
+///     DebugDraw debug_draw;
+///     // anywhere during the frame
+///     debug_draw.box(bounds, Color::Red());
+///     debug_draw.arrow(p, v, Color::Black(), 0.1f, DebugDraw::Layer::overlay);
+///     // once per frame, after the scene
+///     debug_draw.render(camera);
+/// \endcode
+class DebugDraw {
+public:
+  enum class Layer {
+    depth_tested = 0,
+    overlay = 1
+  };
+  // ***********************************************************************
+  //                           CONSTRUCTORS
+  // ***********************************************************************
+  /// \param frame_count number of frames that may be in flight
+  explicit DebugDraw(u32 frame_count = 3);
+  ~DebugDraw();
+  DebugDraw(const DebugDraw &) = delete;
+  DebugDraw &operator=(const DebugDraw &) = delete;
+  // ***********************************************************************
+  //                           PRIMITIVES
+  // ***********************************************************************
+  ///
+  /// \param a
+  /// \param b
+  /// \param color
+  /// \param layer
+  void line(const hermes::point3 &a, const hermes::point3 &b, const Color &color,
+            Layer layer = Layer::depth_tested);
+  ///
+  /// \param p
+  /// \param color
+  /// \param layer
+  void point(const hermes::point3 &p, const Color &color, Layer layer = Layer::depth_tested);
+  ///
+  /// \param a
+  /// \param b
+  /// \param c
+  /// \param color
+  /// \param layer
+  void triangle(const hermes::point3 &a, const hermes::point3 &b, const hermes::point3 &c,
+                const Color &color, Layer layer = Layer::depth_tested);
+  /// Box edges
+  /// \param bounds
+  /// \param color
+  /// \param layer
+  void box(const hermes::bbox3 &bounds, const Color &color, Layer layer = Layer::depth_tested);
+  /// Edges of a transformed box
+  /// \param bounds
+  /// \param transform
+  /// \param color
+  /// \param layer
+  void box(const hermes::bbox3 &bounds, const hermes::Transform &transform, const Color &color,
+           Layer layer = Layer::depth_tested);
+  /// Segment from origin to origin + v with a head of two lines
+  /// \param origin
+  /// \param v
+  /// \param color
+  /// \param head_size head length relative to |v|
+  /// \param layer
+  void arrow(const hermes::point3 &origin, const hermes::vec3 &v, const Color &color,
+             f32 head_size = 0.1f, Layer layer = Layer::depth_tested);
+  /// Lines of a grid of u_count x v_count cells spanned by u and v
+  /// \param origin grid corner
+  /// \param u cell edge along the first direction
+  /// \param v cell edge along the second direction
+  /// \param u_count number of cells along u
+  /// \param v_count number of cells along v
+  /// \param color
+  /// \param layer
+  void grid(const hermes::point3 &origin, const hermes::vec3 &u, const hermes::vec3 &v,
+            u32 u_count, u32 v_count, const Color &color, Layer layer = Layer::depth_tested);
+  /// Circle outline
+  /// \param center
+  /// \param normal circle plane normal
+  /// \param radius
+  /// \param color
+  /// \param segments
+  /// \param layer
+  void circle(const hermes::point3 &center, const hermes::vec3 &normal, f32 radius, const Color &color,
+              u32 segments = 32, Layer layer = Layer::depth_tested);
+  /// Edges of the view frustum of a camera
+  /// \param camera
+  /// \param color
+  /// \param layer
+  void frustum(const CameraInterface &camera, const Color &color, Layer layer = Layer::depth_tested);
+  // ***********************************************************************
+  //                           METHODS
+  // ***********************************************************************
+  /// Draws everything collected since the last render and clears the batches
+  /// \param camera
+  void render(const CameraInterface &camera);
+  /// Discards collected primitives
+  void clear();
+  // ***********************************************************************
+  //                           FIELDS
+  // ***********************************************************************
+  /// \return number of vertices collected so far
+  [[nodiscard]] u64 vertexCount() const;
+
+  f32 point_size{4.f};
+
+private:
+  struct Vertex {
+    f32 x, y, z;
+    u32 color; //!< rgba8
+  };
+  enum Primitive {
+    lines = 0,
+    points = 1,
+    triangles = 2,
+    primitive_count = 3
+  };
+  std::vector<Vertex> &batch(Layer layer, Primitive primitive);
+  /// Makes sure the vertex buffer has room for vertex_count vertices per frame
+  void reserve(u64 vertex_count);
+
+  std::vector<Vertex> batches_[2][primitive_count];
+  Program program_;
+  GLuint vao_{0};
+  GLuint vbo_{0};
+  Vertex *mapped_{nullptr};
+  std::vector<GLsync> fences_;
+  u32 frame_{0};
+  u64 frame_capacity_{0}; //!< vertices per frame region
+};
+
+}
+
+#endif //CIRCE_CIRCE_GL_SCENE_DEBUG_DRAW_H
@@ -2,6 +2,7 @@
 #define CIRCE_HELPERS_CAMERA_MODEL_H
 
 #include <circe/scene/camera_interface.h>
+#include <circe/gl/scene/debug_draw.h>
 #include <circe/gl/utils/open_gl.h>
 
 #include <iostream>
@@ -13,7 +14,8 @@ public:
   CameraModel() = default;
   virtual ~CameraModel() = default;
 
-  static void drawCamera(const CameraInterface &camera) {
+  static void drawCamera(gl::DebugDraw &debug_draw, const CameraInterface &camera,
+                         const Color &color = Color::Black()) {
     hermes::vec3 dir = normalize(camera.getTarget() - camera.getPosition());
     hermes::vec3 left = normalize(cross(normalize(camera.getUpVector()), dir));
     hermes::vec3 up = normalize(cross(dir, left));
@@ -46,30 +48,14 @@ public:
           camera.getFar() * talpha * left + camera.getFar() * tbeta * up;
     ftr = camera.getPosition() + dir * camera.getFar() +
           camera.getFar() * talpha * left + camera.getFar() * tbeta * up;
-    glColor3f(0, 0, 0);
-//    glBegin(GL_LINES);
-//    glVertex(camera.getPosition());
-//    glVertex(fbl);
-//    glVertex(camera.getPosition());
-//    glVertex(fbr);
-//    glVertex(camera.getPosition());
-//    glVertex(ftl);
-//    glVertex(camera.getPosition());
-//    glVertex(ftr);
-//    glEnd();
-//    glBegin(GL_LINE_LOOP);
-//    glVertex(nbl);
-//    glVertex(nbr);
-//    glVertex(ntr);
-//    glVertex(ntl);
-//    glEnd();
-//    glBegin(GL_LINE_LOOP);
-//    glBegin(GL_LINE_LOOP);
-//    glVertex(fbl);
-//    glVertex(fbr);
-//    glVertex(ftr);
-//    glVertex(ftl);
-//    glEnd();
+    for (const auto &corner : {fbl, fbr, ftl, ftr})
+      debug_draw.line(camera.getPosition(), corner, color);
+    const hermes::point3 near_plane[4] = {nbl, nbr, ntr, ntl};
+    const hermes::point3 far_plane[4] = {fbl, fbr, ftr, ftl};
+    for (int i = 0; i < 4; ++i) {
+      debug_draw.line(near_plane[i], near_plane[(i + 1) % 4], color);
+      debug_draw.line(far_plane[i], far_plane[(i + 1) % 4], color);
+    }
   }
 };
 
@@ -27,178 +27,67 @@
 
 namespace circe::gl {
 
-void fill_box(const hermes::point2 &a, const hermes::point2 &b) {
-  HERMES_UNUSED_VARIABLE(a);
-  HERMES_UNUSED_VARIABLE(b);
-  //  glBegin(GL_QUADS);
-  //  glVertex(hermes::point2(a.x, a.y));
-  //  glVertex(hermes::point2(b.x, a.y));
-  //  glVertex(hermes::point2(b.x, b.y));
-  //  glVertex(hermes::point2(a.x, b.y));
-  //  glEnd();
+namespace {
+
+hermes::point3 xy(const hermes::point2 &p) {
+  return {p.x, p.y, 0.f};
 }
 
-void draw_bbox(const hermes::bbox2 &bbox, float *fillColor) {
-  HERMES_UNUSED_VARIABLE(bbox);
-  HERMES_UNUSED_VARIABLE(fillColor);
-  //  glBegin(GL_LINE_LOOP);
-  //  glVertex(hermes::point2(bbox.lower.x, bbox.lower.y));
-  //  glVertex(hermes::point2(bbox.upper.x, bbox.lower.y));
-  //  glVertex(hermes::point2(bbox.upper.x, bbox.upper.y));
-  //  glVertex(hermes::point2(bbox.lower.x, bbox.upper.y));
-  //  glEnd();
-  //  if (fillColor) {
-  //    glColor4fv(fillColor);
-  //    glBegin(GL_QUADS);
-  //    glVertex(hermes::point2(bbox.lower.x, bbox.lower.y));
-  //    glVertex(hermes::point2(bbox.upper.x, bbox.lower.y));
-  //    glVertex(hermes::point2(bbox.upper.x, bbox.upper.y));
-  //    glVertex(hermes::point2(bbox.lower.x, bbox.upper.y));
-  //    glEnd();
-  //  }
 }
 
-void draw_bbox(const hermes::bbox2 &bbox, const Color &edgeColor,
+void fill_box(DebugDraw &debug_draw, const hermes::point2 &a, const hermes::point2 &b, const Color &color) {
+  debug_draw.triangle(xy({a.x, a.y}), xy({b.x, a.y}), xy({b.x, b.y}), color);
+  debug_draw.triangle(xy({a.x, a.y}), xy({b.x, b.y}), xy({a.x, b.y}), color);
+}
+
+void draw_bbox(DebugDraw &debug_draw, const hermes::bbox2 &bbox, const Color &edgeColor) {
+  hermes::point2 corners[4] = {{bbox.lower.x, bbox.lower.y}, {bbox.upper.x, bbox.lower.y},
+                               {bbox.upper.x, bbox.upper.y}, {bbox.lower.x, bbox.upper.y}};
+  for (int i = 0; i < 4; ++i)
+    debug_draw.line(xy(corners[i]), xy(corners[(i + 1) % 4]), edgeColor);
+}
+
+void draw_bbox(DebugDraw &debug_draw, const hermes::bbox2 &bbox, const Color &edgeColor,
                const Color &fillColor) {
-  HERMES_UNUSED_VARIABLE(bbox);
-  HERMES_UNUSED_VARIABLE(edgeColor);
-  HERMES_UNUSED_VARIABLE(fillColor);
-  //  glColor4fv(edgeColor.asArray());
-  //  glBegin(GL_LINE_LOOP);
-  //  glVertex(hermes::point2(bbox.lower.x, bbox.lower.y));
-  //  glVertex(hermes::point2(bbox.upper.x, bbox.lower.y));
-  //  glVertex(hermes::point2(bbox.upper.x, bbox.upper.y));
-  //  glVertex(hermes::point2(bbox.lower.x, bbox.upper.y));
-  //  glEnd();
-  //  glColor4fv(fillColor.asArray());
-  //  glBegin(GL_QUADS);
-  //  glVertex(hermes::point2(bbox.lower.x, bbox.lower.y));
-  //  glVertex(hermes::point2(bbox.upper.x, bbox.lower.y));
-  //  glVertex(hermes::point2(bbox.upper.x, bbox.upper.y));
-  //  glVertex(hermes::point2(bbox.lower.x, bbox.upper.y));
-  //  glEnd();
+  draw_bbox(debug_draw, bbox, edgeColor);
+  fill_box(debug_draw, bbox.lower, bbox.upper, fillColor);
 }
 
-void draw_bbox(const hermes::bbox3 &bbox) {
-  HERMES_UNUSED_VARIABLE(bbox);
-  //  glBegin(GL_LINE_LOOP);
-  //  glVertex(hermes::point3(bbox.lower.x, bbox.lower.y, bbox.lower.z));
-  //  glVertex(hermes::point3(bbox.upper.x, bbox.lower.y, bbox.lower.z));
-  //  glVertex(hermes::point3(bbox.upper.x, bbox.upper.y, bbox.lower.z));
-  //  glVertex(hermes::point3(bbox.lower.x, bbox.upper.y, bbox.lower.z));
-  //  glEnd();
-  //  glBegin(GL_LINE_LOOP);
-  //  glVertex(hermes::point3(bbox.lower.x, bbox.lower.y, bbox.upper.z));
-  //  glVertex(hermes::point3(bbox.upper.x, bbox.lower.y, bbox.upper.z));
-  //  glVertex(hermes::point3(bbox.upper.x, bbox.upper.y, bbox.upper.z));
-  //  glVertex(hermes::point3(bbox.lower.x, bbox.upper.y, bbox.upper.z));
-  //  glEnd();
-  //  glBegin(GL_LINES);
-  //  glVertex(hermes::point3(bbox.lower.x, bbox.lower.y, bbox.lower.z));
-  //  glVertex(hermes::point3(bbox.lower.x, bbox.lower.y, bbox.upper.z));
-  //
-  //  glVertex(hermes::point3(bbox.upper.x, bbox.lower.y, bbox.lower.z));
-  //  glVertex(hermes::point3(bbox.upper.x, bbox.lower.y, bbox.upper.z));
-  //
-  //  glVertex(hermes::point3(bbox.upper.x, bbox.upper.y, bbox.lower.z));
-  //  glVertex(hermes::point3(bbox.upper.x, bbox.upper.y, bbox.upper.z));
-  //
-  //  glVertex(hermes::point3(bbox.lower.x, bbox.upper.y, bbox.lower.z));
-  //  glVertex(hermes::point3(bbox.lower.x, bbox.upper.y, bbox.upper.z));
-  //
-  //  glEnd();
+void draw_bbox(DebugDraw &debug_draw, const hermes::bbox3 &bbox, const Color &color) {
+  debug_draw.box(bbox, color);
 }
 
-void draw_segment(hermes::Segment3 segment) {
-  HERMES_UNUSED_VARIABLE(segment);
-  //  glBegin(GL_LINES);
-  //  glVertex(segment.a);
-  //  glVertex(segment.b);
-  //  glEnd();
+void draw_segment(DebugDraw &debug_draw, hermes::Segment3 segment, const Color &color) {
+  debug_draw.line(segment.a, segment.b, color);
 }
 
-void draw_circle(const hermes::Circle &circle,
+void draw_circle(DebugDraw &debug_draw, const hermes::Circle &circle, const Color &color,
                  const hermes::Transform2 *transform) {
-  HERMES_UNUSED_VARIABLE(circle);
-  HERMES_UNUSED_VARIABLE(transform);
-  //  glBegin(GL_TRIANGLE_FAN);
-  //  if (transform != nullptr)
-  //    glVertex((*transform)(circle.c));
-  //  else
-  //    glVertex(circle.c);
-  //  float angle = 0.0;
-  //  float step = hermes::Constants::two_pi / 100.f;
-  //  while (angle < hermes::Constants::two_pi + step) {
-  //    hermes::vec2 pp(circle.r * cosf(angle), circle.r * sinf(angle));
-  //    if (transform != nullptr)
-  //      glVertex((*transform)(circle.c + pp));
-  //    else
-  //      glVertex(circle.c + pp);
-  //    angle += step;
-  //  }
-  //  glEnd();
+  auto at = [&](float angle) {
+    hermes::point2 p = circle.c + hermes::vec2(circle.r * cosf(angle), circle.r * sinf(angle));
+    return xy(transform ? (*transform)(p) : p);
+  };
+  auto center = xy(transform ? (*transform)(circle.c) : circle.c);
+  const float step = hermes::Constants::two_pi / 100.f;
+  for (int i = 0; i < 100; ++i)
+    debug_draw.triangle(center, at(i * step), at((i + 1) * step), color);
 }
 
-void draw_sphere(hermes::Sphere sphere, const hermes::Transform *transform) {
-  HERMES_UNUSED_VARIABLE(sphere);
-  HERMES_UNUSED_VARIABLE(transform);
-  //  if (transform) {
-  //    glPushMatrix();
-  //    glApplyTransform(*transform);
-  //  }
-  //  const float vStep = hermes::Constants::pi / 20.f;
-  //  const float hStep = hermes::Constants::pi / 20.f;
-  //  glBegin(GL_TRIANGLES);
-  //   south pole
-  //  hermes::point3 pole(0.f, -sphere.r, 0.f);
-  //  for (float angle = 0.f; angle < hermes::Constants::two_pi; angle += hStep)
-  //  {
-  //    float r = sphere.r * sinf(vStep);
-  //    glVertex(sphere.c + hermes::vec3(pole));
-  //    glVertex(sphere.c + hermes::vec3(pole) +
-  //             r * hermes::vec3(cosf(angle), -sinf(vStep), sinf(angle)));
-  //    glVertex(sphere.c + hermes::vec3(pole) +
-  //             r * hermes::vec3(cosf(angle + hStep), -sinf(vStep),
-  //                             sinf(angle + hStep)));
-  //  }
-  //   north pole
-  //  pole = hermes::point3(0.f, sphere.r, 0.f);
-  //  for (float angle = 0.f; angle < hermes::Constants::two_pi; angle += hStep)
-  //  {
-  //    float r = sphere.r * sinf(vStep);
-  //    glVertex(sphere.c + hermes::vec3(pole));
-  //    glVertex(sphere.c + hermes::vec3(pole) +
-  //             r * hermes::vec3(cosf(angle), -sinf(vStep), sinf(angle)));
-  //    glVertex(sphere.c + hermes::vec3(pole) +
-  //             r * hermes::vec3(cosf(angle + hStep), -sinf(vStep),
-  //                             sinf(angle + hStep)));
-  //  }
-  //
-  //  glEnd();
-  //  glBegin(GL_QUADS);
-  //  for (float vAngle = vStep; vAngle <= hermes::Constants::pi - vStep;
-  //       vAngle += vStep) {
-  //    float r = sphere.r * sinf(vAngle);
-  //    float R = sphere.r * sinf(vAngle + vStep);
-  //    for (float angle = 0.f; angle < hermes::Constants::two_pi; angle +=
-  //    hStep) {
-  //      glVertex(sphere.c + hermes::vec3(r * cosf(angle), sphere.r *
-  //      cosf(vAngle),
-  //                                      r * sinf(angle)));
-  //      glVertex(sphere.c + hermes::vec3(r * cosf(angle + hStep),
-  //                                      sphere.r * cosf(vAngle),
-  //                                      r * sinf(angle + hStep)));
-  //      glVertex(sphere.c + hermes::vec3(R * cosf(angle + hStep),
-  //                                      sphere.r * cosf(vAngle + vStep),
-  //                                      R * sinf(angle + hStep)));
-  //      glVertex(sphere.c + hermes::vec3(R * cosf(angle),
-  //                                      sphere.r * cosf(vAngle + vStep),
-  //                                      R * sinf(angle)));
-  //    }
-  //  }
-  //  glEnd();
-  //  if (transform)
-  //    glPopMatrix();
+void draw_sphere(DebugDraw &debug_draw, hermes::Sphere sphere, const Color &color,
+                 const hermes::Transform *transform) {
+  const int slices = 40;
+  const int stacks = 20;
+  auto at = [&](int stack, int slice) {
+    float v = hermes::Constants::pi * stack / stacks;
+    float h = hermes::Constants::two_pi * slice / slices;
+    hermes::point3 p = sphere.c + sphere.r * hermes::vec3(sinf(v) * cosf(h), cosf(v), sinf(v) * sinf(h));
+    return transform ? (*transform)(p) : p;
+  };
+  for (int stack = 0; stack < stacks; ++stack)
+    for (int slice = 0; slice < slices; ++slice) {
+      debug_draw.triangle(at(stack, slice), at(stack + 1, slice), at(stack + 1, slice + 1), color);
+      debug_draw.triangle(at(stack, slice), at(stack + 1, slice + 1), at(stack, slice + 1), color);
+    }
 }
 
 //void draw_polygon(const hermes::Polygon &polygon,
@@ -253,20 +142,11 @@ void draw_sphere(hermes::Sphere sphere, const hermes::Transform *transform) {
   //  glLineWidth(1.f);
 //}
 
-void draw_vector(const hermes::point2 &p, const hermes::vec2 &v, float w,
-                 float h) {
-  HERMES_UNUSED_VARIABLE(p);
-  HERMES_UNUSED_VARIABLE(v);
-  HERMES_UNUSED_VARIABLE(w);
-  HERMES_UNUSED_VARIABLE(h);
-  //  glBegin(GL_LINES);
-  //  glVertex(p);
-  //  glVertex(p + v);
-  //  glVertex(p + v);
-  //  glVertex(p + v - h * v + w * v.left());
-  //  glVertex(p + v);
-  //  glVertex(p + v - h * v + w * v.right());
-  //  glEnd();
+void draw_vector(DebugDraw &debug_draw, const hermes::point2 &p, const hermes::vec2 &v, const Color &color,
+                 float w, float h) {
+  debug_draw.line(xy(p), xy(p + v), color);
+  debug_draw.line(xy(p + v), xy(p + v - h * v + w * v.left()), color);
+  debug_draw.line(xy(p + v), xy(p + v - h * v + w * v.right()), color);
 }
 
 } // namespace circe
@@ -2,6 +2,7 @@
 #define CIRCE_HELPERS_GEOMETRY_DRAWERS_H
 
 #include <circe/colors/color_palette.h>
+#include <circe/gl/scene/debug_draw.h>
 #include <circe/gl/utils/open_gl.h>
 #include <hermes/geometry/transform.h>
 #include <hermes/geometry/sphere.h>
@@ -9,21 +10,24 @@
 
 namespace circe::gl {
 
-void fill_box(const hermes::point2 &a, const hermes::point2 &b);
+// 2D shapes are drawn on the z = 0 plane. All functions only batch geometry
+// into debug_draw, it is drawn by DebugDraw::render.
 
-void draw_bbox(const hermes::bbox2 &bbox, float *fillColor = nullptr);
+void fill_box(DebugDraw &debug_draw, const hermes::point2 &a, const hermes::point2 &b, const Color &color);
 
-void draw_bbox(const hermes::bbox2 &bbox, const Color &edgeColor,
+void draw_bbox(DebugDraw &debug_draw, const hermes::bbox2 &bbox, const Color &edgeColor);
+
+void draw_bbox(DebugDraw &debug_draw, const hermes::bbox2 &bbox, const Color &edgeColor,
                const Color &fillColor);
 
-void draw_bbox(const hermes::bbox3 &bbox);
+void draw_bbox(DebugDraw &debug_draw, const hermes::bbox3 &bbox, const Color &color);
 
-void draw_segment(hermes::Segment3 segment);
+void draw_segment(DebugDraw &debug_draw, hermes::Segment3 segment, const Color &color);
 
-void draw_circle(const hermes::Circle &circle,
+void draw_circle(DebugDraw &debug_draw, const hermes::Circle &circle, const Color &color,
                  const hermes::Transform2 *transform = nullptr);
 
-void draw_sphere(hermes::Sphere sphere,
+void draw_sphere(DebugDraw &debug_draw, hermes::Sphere sphere, const Color &color,
                  const hermes::Transform *transform = nullptr);
 
 //void draw_polygon(const hermes::Polygon &polygon,
@@ -32,8 +36,8 @@ void draw_sphere(hermes::Sphere sphere,
 //void draw_mesh(const hermes::Mesh2D *m,
 //               const hermes::Transform2 *transform = nullptr);
 
-void draw_vector(const hermes::point2 &p, const hermes::vec2 &v, float w = 0.01f,
-                 float h = 0.01f);
+void draw_vector(DebugDraw &debug_draw, const hermes::point2 &p, const hermes::vec2 &v, const Color &color,
+                 float w = 0.01f, float h = 0.01f);
 } // namespace circe
 
 #endif // CIRCE_HELPERS_GEOMETRY_DRAWERS_H
@@ -26,6 +26,7 @@
 #define CIRCE_HELPERS_GRID_MODEL_H
 
 #include <circe/colors/color.h>
+#include <circe/gl/scene/helpers/geometry_drawers.h>
 #include <circe/gl/scene/scene_object.h>
 #include <circe/gl/ui/text_renderer.h>
 #include <circe/gl/utils/open_gl.h>
@@ -40,19 +41,15 @@ public:
   GridModel() {}
   GridModel(const GridType *g) : grid(g) {}
   void draw(const CameraInterface *camera, hermes::Transform t) {
-    glColor4fv(gridColor.asArray());
-    glBegin(GL_LINES); // XY
-    for (size_t x = 0; x <= grid->width; x++) {
-      glVertex(transform(grid->toWorld(hermes::point2(x, 0))));
-      glVertex(transform(grid->toWorld(hermes::point2(x, grid->height))));
-    }
-    for (size_t y = 0; y <= grid->height; y++) {
-      glVertex(transform(grid->toWorld(hermes::point2(0, y))));
-      glVertex(transform(grid->toWorld(hermes::point2(grid->width, y))));
-    }
-    glEnd();
+    if (!debug_draw)
+      return;
+    for (size_t x = 0; x <= grid->width; x++)
+      debug_draw->line(transform(grid->toWorld(hermes::point2(x, 0))),
+                       transform(grid->toWorld(hermes::point2(x, grid->height))), gridColor);
+    for (size_t y = 0; y <= grid->height; y++)
+      debug_draw->line(transform(grid->toWorld(hermes::point2(0, y))),
+                       transform(grid->toWorld(hermes::point2(grid->width, y))), gridColor);
     if (f) {
-      glColor4fv(dataColor.asArray());
       grid->forEach(
           [&](const typename GridType::DataType &v, size_t i, size_t j) {
             f((*grid)(i, j), hermes::point3(grid->dataWorldPosition(i, j)));
@@ -64,6 +61,8 @@ public:
 
   Color gridColor;
   Color dataColor;
+  /// batches the grid geometry (nothing is drawn while null)
+  DebugDraw *debug_draw{nullptr};
 
 protected:
   const GridType *grid;
@@ -81,19 +80,14 @@ public:
     scaleFactor = sf;
     mode = Mode::RAW;
     this->f = [&](const hermes::Vector2<T> v, hermes::point3 p) {
-      // glColor4fv(this->dataColor.asArray());
-      // glPointSize(3.f);
-      // glBegin(GL_POINTS);
-      // glVertex(p);
-      // glEnd();
       switch (mode) {
       case Mode::RAW:
-        draw_vector(hermes::point2(p.x, p.y),
-                    scaleFactor * hermes::vec2(v[0], v[1]));
+        draw_vector(*this->debug_draw, hermes::point2(p.x, p.y),
+                    scaleFactor * hermes::vec2(v[0], v[1]), this->dataColor);
         break;
       case Mode::EQUAL:
-        draw_vector(hermes::point2(p.x, p.y),
-                    scaleFactor * hermes::normalize(hermes::vec2(v[0], v[1])));
+        draw_vector(*this->debug_draw, hermes::point2(p.x, p.y),
+                    scaleFactor * hermes::normalize(hermes::vec2(v[0], v[1])), this->dataColor);
         break;
       }
     };
@@ -125,11 +119,8 @@ public:
                   Color gridColor, Color dataColor) {
     model->gridColor = gridColor;
     model->dataColor = dataColor;
-    model->f = [this, gridColor, dataColor](float v, hermes::point3 p) {
-      // glPointSize(4);
-      // glBegin(GL_POINTS);
-      // glVertex(p);
-      // glEnd();
+    model->f = [this, model, gridColor, dataColor](float v, hermes::point3 p) {
+      model->debug_draw->point(p, dataColor);
       std::ostringstream stringStream;
       stringStream << v;
       std::string copyOfStr = stringStream.str();
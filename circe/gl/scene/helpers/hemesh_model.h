@@ -25,6 +25,7 @@
 #ifndef CIRCE_HELPERS_HEMESH_MODEL_H
 #define CIRCE_HELPERS_HEMESH_MODEL_H
 
+#include <circe/gl/scene/helpers/geometry_drawers.h>
 #include <circe/scene/scene_object.h>
 #include <circe/ui/text_renderer.h>
 #include <circe/utils/open_gl.h>
@@ -33,8 +34,9 @@ namespace circe {
 
 class HEMeshObject : public circe::SceneObject {
 public:
-  HEMeshObject(const ponos::HEMesh2DF *m, TextRenderer *t, float de = 0.03f,
-               float dv = 0.015f) {
+  HEMeshObject(const ponos::HEMesh2DF *m, TextRenderer *t, gl::DebugDraw &dd,
+               float de = 0.03f, float dv = 0.015f)
+      : debug_draw(dd) {
     // mesh.reset(new ponos::HEMesh2DF(rm));
     mesh = m;
     // std::vector<size_t> p(1, 0);
@@ -49,12 +51,9 @@ public:
     const std::vector<ponos::HEMesh2DF::Vertex> &vertices = mesh->getVertices();
     const std::vector<ponos::HEMesh2DF::Edge> &edges = mesh->getEdges();
     const std::vector<ponos::HEMesh2DF::Face> &faces = mesh->getFaces();
-    glPointSize(4.f);
-    glColor4f(0, 0, 0, 0.5);
-    glBegin(GL_POINTS);
+    auto xy = [](const ponos::point2 &p) { return hermes::point3(p.x, p.y, 0.f); };
     for (auto p : vertices)
-      circe::glVertex(p.position);
-    glEnd();
+      debug_draw.point(xy(p.position), Color(0, 0, 0, 0.5));
     for (unsigned long int k = 0; k < vertices.size(); k++) {
       char label[100];
       sprintf(label, "%lu", k);
@@ -70,15 +69,10 @@ public:
     for (auto e : edges) {
       // std::cout << "edge " << k << " = " << e.orig
       //	<< " | " << e.dest << std::endl;
-      glColor4f(0, 0, 0, 0.5);
       ponos::point2 a = vertices[e.orig].position;
       ponos::point2 b = vertices[e.dest].position;
       ponos::vec2 v = ponos::normalize(b - a);
-      glBegin(GL_LINES);
-      circe::glVertex(a);
-      circe::glVertex(b);
-      glEnd();
-      glColor4f(1, 0, 0, 0.3);
+      debug_draw.line(xy(a), xy(b), Color(0, 0, 0, 0.5));
       ponos::point2 A =
           a + distanceFromEdge * v.left() + distanceFromVertex * v;
       ponos::point2 B =
@@ -90,35 +84,32 @@ public:
       sprintf(label, "%d", k++);
       //      text->render(label, labelPositition, .3f,
       //                   circe::Color(0.4f, 0.2f, 0.7f, 0.3f));
-      circe::draw_vector(A, B - A, 0.04, 0.05);
-      glColor4f(1, 0, 0, 0.2);
-      glBegin(GL_LINES);
+      gl::draw_vector(debug_draw, A, B - A, Color(1, 0, 0, 0.3), 0.04, 0.05);
       if (e.next >= 0) {
-        circe::glVertex(B);
         ponos::vec2 V = ponos::normalize(vertices[edges[e.next].dest].position -
                                          vertices[edges[e.next].orig].position);
-        circe::glVertex(vertices[edges[e.next].orig].position +
-                        distanceFromEdge * V.left() + distanceFromVertex * V);
+        debug_draw.line(xy(B), xy(vertices[edges[e.next].orig].position +
+                                  distanceFromEdge * V.left() + distanceFromVertex * V),
+                        Color(1, 0, 0, 0.2));
       }
       if (e.prev >= 0) {
-        circe::glVertex(A);
         ponos::vec2 V = ponos::normalize(vertices[edges[e.prev].dest].position -
                                          vertices[edges[e.prev].orig].position);
-        circe::glVertex(vertices[edges[e.prev].dest].position +
-                        distanceFromEdge * V.left() - distanceFromVertex * V);
+        debug_draw.line(xy(A), xy(vertices[edges[e.prev].dest].position +
+                                  distanceFromEdge * V.left() - distanceFromVertex * V),
+                        Color(1, 0, 0, 0.2));
       }
-      glEnd();
     }
     for (unsigned long int i = 0; i < faces.size(); i++) {
       ponos::point2 mp(0, 0);
-      glColor4f(0, 1, 0, 0);
-      glBegin(GL_TRIANGLES);
-      mesh->traversePolygonEdges(i, [&mp, &edges, &vertices](int e) {
-        circe::glVertex(vertices[edges[e].orig].position);
+      std::vector<hermes::point3> polygon;
+      mesh->traversePolygonEdges(i, [&](int e) {
+        polygon.emplace_back(xy(vertices[edges[e].orig].position));
         mp[0] += vertices[edges[e].orig].position[0];
         mp[1] += vertices[edges[e].orig].position[1];
       });
-      glEnd();
+      for (size_t t = 2; t < polygon.size(); ++t)
+        debug_draw.triangle(polygon[0], polygon[t - 1], polygon[t], Color(0, 1, 0, 0));
       char label[100];
       ponos::point3 labelPosition =
           glGetMVPTransform()(ponos::point3(mp[0] / 3.f, mp[1] / 3.f, 0.f));
@@ -129,6 +120,7 @@ public:
   }
 
   TextRenderer *text;
+  gl::DebugDraw &debug_draw;
   float distanceFromEdge;
   float distanceFromVertex;
 
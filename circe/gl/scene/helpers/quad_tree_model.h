@@ -41,9 +41,10 @@ public:
   QuadTreeModel() : tree(nullptr) {}
   QuadTreeModel(const QT *qt) : tree(qt) { edgesColor = Color::Black(); }
   void draw() const {
+    if (!debug_draw)
+      return;
     tree->traverse([this](const typename QT::Node &node) -> bool {
-      glColor4fv(edgesColor.asArray());
-      draw_bbox(node.region());
+      draw_bbox(*debug_draw, node.region(), edgesColor);
       if (drawCallback)
         drawCallback(node);
       return true;
@@ -52,6 +53,8 @@ public:
   std::function<void(const typename QT::Node &n)> drawCallback;
   Color edgesColor;
   ColorPalette colorPallete;
+  /// batches the tree geometry (nothing is drawn while null)
+  DebugDraw *debug_draw{nullptr};
 
 private:
   const QT *tree;
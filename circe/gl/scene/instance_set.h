@@ -95,6 +95,10 @@ public:
   /// \param n number of instances
   void resize(uint n);
   View instanceData();
+  /// \return instance buffer (instance attributes are interleaved)
+  [[nodiscard]] const DeviceMemory &instanceBuffer() const { return instance_buffer_; }
+  /// \return instance buffer attributes
+  [[nodiscard]] const VertexAttributes &instanceAttributes() const { return instance_attributes_; }
   void draw(const CameraInterface *camera, hermes::Transform transform) override;
   void draw(const CameraInterface *camera);
   // *******************************************************************************************************************
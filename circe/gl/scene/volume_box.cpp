@@ -147,6 +147,10 @@ void VolumeBox2::update(float *data) {
   density_texture_.setTexels(reinterpret_cast<unsigned char *>(data));
 }
 
+void VolumeBox2::update(float *data, const std::vector<TexelRegion> &dirty) {
+  upload_ring_.upload(density_texture_, dirty, data, sizeof(float));
+}
+
 VolumeBox::VolumeBox() {
   const char *vs = "#version 440 core\n"
                    "layout (location = 0) in vec3 position;"
@@ -161,60 +165,88 @@ VolumeBox::VolumeBox() {
                    "}";
   const char *fs =
       "#version 440 core\n"
-      "layout(location = 0) out vec4 fragColor;"
-      "layout(location = 4) uniform vec3 cameraPosition;"
-      "layout(location = 5) uniform sampler3D g_densityTex;"
-      "layout(location = 6) uniform vec3 g_lightPos;"
-      "layout(location = 7) uniform vec3 g_lightIntensity;"
-      "layout(location = 8) uniform float g_absorption;"
-      "in vec3 tex;"
-      "void main() {"
-      // diagonal of the cube
-      "const float maxDist = sqrt(3.0);"
-      "const int numSamples = 128;"
-      "const float scale = maxDist/float(numSamples);"
-      "const int numLightSamples = 32;"
-      "const float lscale = maxDist / float(numLightSamples);"
+      "layout(location = 0) out vec4 fragColor;\n"
+      "layout(location = 4) uniform vec3 cameraPosition;\n"
+      "layout(location = 5) uniform sampler3D g_densityTex;\n"
+      "layout(location = 6) uniform vec3 g_lightPos;\n"
+      "layout(location = 7) uniform vec3 g_lightIntensity;\n"
+      "layout(location = 8) uniform float g_absorption;\n"
+      "layout(location = 9) uniform sampler3D g_macroCells;\n"
+      "layout(location = 10) uniform float g_minTransmittance;\n"
+      "in vec3 tex;\n"
+      // max optical depth of a single step inside a non empty cell
+      "const float stepOpticalDepth = 0.05;\n"
+      "const int maxSteps = 1024;\n"
+      "vec3 cells;\n"
+      "float minStep, maxStep;\n"
+      // distance from p, along d, to the exit of the box [lower, upper]
+      "float boxExit(vec3 p, vec3 d, vec3 lower, vec3 upper) {\n"
+      "  d = mix(d, vec3(1e-8), equal(d, vec3(0.0)));\n"
+      "  vec3 t = max((lower - p) / d, (upper - p) / d);\n"
+      "  return min(min(t.x, t.y), t.z);\n"
+      "}\n"
+      // min/max density and exit distance of the macro cell containing p
+      "vec2 cell(vec3 p, vec3 d, out float exit) {\n"
+      "  vec3 c = clamp(floor(p * cells), vec3(0.0), cells - 1.0);\n"
+      "  exit = boxExit(p, d, c / cells, (c + 1.0) / cells) + 1e-5;\n"
+      "  return texelFetch(g_macroCells, ivec3(c), 0).rg;\n"
+      "}\n"
+      // adaptive step: denser cells are sampled more finely
+      "float cellStep(float max_density) {\n"
+      "  return clamp(stepOpticalDepth / (max_density * g_absorption), minStep, maxStep);\n"
+      "}\n"
+      "float lightTransmittance(vec3 p, vec3 d, float t_max) {\n"
+      "  float Tl = 1.0;\n"
+      "  float t = 0.0;\n"
+      "  for (int i = 0; i < maxSteps && t < t_max && Tl > g_minTransmittance; ++i) {\n"
+      "    float exit;\n"
+      "    vec2 bounds = cell(p + d * t, d, exit);\n"
+      "    float t_exit = min(t + exit, t_max);\n"
+      // skip empty cells
+      "    if (bounds.y <= 0.0) { t = t_exit; continue; }\n"
+      "    float dt = min(cellStep(bounds.y), t_exit - t);\n"
+      "    float ld = texture(g_densityTex, p + d * (t + 0.5 * dt)).x;\n"
+      "    Tl *= exp(-g_absorption * ld * dt);\n"
+      "    t += dt;\n"
+      "  }\n"
+      "  return Tl;\n"
+      "}\n"
+      "void main() {\n"
+      "  cells = vec3(textureSize(g_macroCells, 0));\n"
+      "  vec3 texels = vec3(textureSize(g_densityTex, 0));\n"
+      "  minStep = 0.5 / max(texels.x, max(texels.y, texels.z));\n"
+      "  maxStep = 1.0 / max(cells.x, max(cells.y, cells.z));\n"
       // assume all coordinates are in texture space
-      "vec3 pos = tex;"
-      "vec3 eyeDir = normalize(pos-cameraPosition)*scale;"
+      "  vec3 pos = tex;\n"
+      "  vec3 eyeDir = normalize(pos - cameraPosition);\n"
+      "  float t_max = boxExit(pos, eyeDir, vec3(0.0), vec3(1.0));\n"
       // transmittance
-      "float T = 1.0;"
+      "  float T = 1.0;\n"
       // in-scattered radiance
-      "vec3 Lo = vec3(0.0);"
-      "for (int i=0; i < numSamples; ++i) {"
-      // sample density
-      "    float density = texture(g_densityTex, pos).x;"
-      "     if(pos.x < 0.0 || pos.y < 0.0 || pos.z < 0.0 || pos.x > 1.0 || "
-      "pos.y > 1.0 || pos.z > 1.0) density = 0.;"
-      // skip empty space
-      "    if (density > 0.0) {"
-      // attenuate ray-throughput
-      "        T *= 1.0-density*scale*g_absorption;"
-      "        if (T <= 0.01)"
-      "            break;"
-      // point light dir in texture space
-      "        vec3 lightDir = normalize(g_lightPos-pos)*lscale;"
-      // sample light
-      // transmittance along light ray
-      "        float Tl = 1.0;  "
-      "        vec3 lpos = pos + lightDir;"
-      "        for (int s=0; s < numLightSamples; ++s) {"
-      "            float ld = texture(g_densityTex, lpos).x;"
-      "     if(lpos.x < 0.0 || lpos.y < 0.0 || lpos.z < 0.0 || lpos.x > 1.0 || "
-      "lpos.y > 1.0 || lpos.z > 1.0) ld = 0.;"
-      "            Tl *= 1.0-g_absorption*lscale*ld;"
-      "            if (Tl <= 0.01)"
-      "                break;"
-      "            lpos += lightDir;"
-      "        }"
-      "        vec3 Li = g_lightIntensity*Tl;"
-      "        Lo += Li*T*density*scale;"
-      "    }"
-      "    pos += eyeDir;"
-      "}"
-      "fragColor.xyz = Lo;"
-      "fragColor.w = 1.0 - T;"
+      "  vec3 Lo = vec3(0.0);\n"
+      "  float t = 0.0;\n"
+      // early ray termination on transmittance
+      "  for (int i = 0; i < maxSteps && t < t_max && T > g_minTransmittance; ++i) {\n"
+      "    float exit;\n"
+      "    vec2 bounds = cell(pos + eyeDir * t, eyeDir, exit);\n"
+      "    float t_exit = min(t + exit, t_max);\n"
+      "    if (bounds.y <= 0.0) { t = t_exit; continue; }\n"
+      "    float dt = min(cellStep(bounds.y), t_exit - t);\n"
+      "    vec3 p = pos + eyeDir * (t + 0.5 * dt);\n"
+      "    float density = texture(g_densityTex, p).x;\n"
+      "    if (density > 0.0) {\n"
+      "      T *= exp(-g_absorption * density * dt);\n"
+      // point light transmittance, clipped at the light position
+      "      vec3 lightDir = g_lightPos - p;\n"
+      "      float lightDist = length(lightDir);\n"
+      "      lightDir /= max(lightDist, 1e-8);\n"
+      "      float Tl = lightTransmittance(p, lightDir, min(lightDist, boxExit(p, lightDir, vec3(0.0), vec3(1.0))));\n"
+      "      Lo += g_lightIntensity * Tl * T * density * dt;\n"
+      "    }\n"
+      "    t += dt;\n"
+      "  }\n"
+      "  fragColor.xyz = Lo;\n"
+      "  fragColor.w = 1.0 - T;\n"
       "}";
   shader_ = createShaderProgramPtr(vs, nullptr, fs);
   shader_->addVertexAttribute("position", 0);
@@ -226,6 +258,8 @@ VolumeBox::VolumeBox() {
   shader_->addUniform("g_lightPos", 6);
   shader_->addUniform("g_lightIntensity", 7);
   shader_->addUniform("g_absorption", 8);
+  shader_->addUniform("g_macroCells", 9);
+  shader_->addUniform("g_minTransmittance", 10);
   mesh_ = createSceneMeshPtr(
       hermes::RawMeshes::cube(hermes::Transform(), false, true));
 }
@@ -248,6 +282,7 @@ VolumeBox::VolumeBox(size_t w, size_t h, size_t d, float *data) : VolumeBox() {
   glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
   densityTexture.set(ta);
   densityTexture.setTexels(data);
+  macro_cells_.build(densityTexture, macro_cell_size);
 }
 
 VolumeBox::~VolumeBox() = default;
@@ -255,6 +290,7 @@ VolumeBox::~VolumeBox() = default;
 void VolumeBox::draw(const CameraInterface *camera, hermes::Transform t) {
   HERMES_UNUSED_VARIABLE(t);
   densityTexture.bind(GL_TEXTURE0);
+  macro_cells_.bind(GL_TEXTURE1);
   shader_->begin();
   shader_->setUniform("model_view_matrix",
                       hermes::transpose(camera->getViewTransform().matrix()));
@@ -266,6 +302,8 @@ void VolumeBox::draw(const CameraInterface *camera, hermes::Transform t) {
   shader_->setUniform("g_lightPos", lightPos);
   shader_->setUniform("g_lightIntensity", lightIntensity);
   shader_->setUniform("g_absorption", absorption);
+  shader_->setUniform("g_macroCells", 1);
+  shader_->setUniform("g_minTransmittance", min_transmittance);
   mesh_->bind();
   mesh_->vertexBuffer()->locateAttributes(*shader_.get());
   render(GL_BACK);
@@ -279,6 +317,15 @@ Texture &VolumeBox::texture() { return densityTexture; }
 
 void VolumeBox::update(float *data) {
   densityTexture.setTexels(reinterpret_cast<unsigned char *>(data));
+  macro_cells_.build(densityTexture, macro_cell_size);
+}
+
+void VolumeBox::update(float *data, const std::vector<TexelRegion> &dirty) {
+  upload_ring_.upload(densityTexture, dirty, data, sizeof(float));
+  if (macro_cells_.cellSize() != macro_cell_size)
+    macro_cells_.build(densityTexture, macro_cell_size);
+  else
+    macro_cells_.update(densityTexture, dirty);
 }
 
 void VolumeBox::render(GLenum cullFace) {
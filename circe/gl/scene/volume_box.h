@@ -26,6 +26,8 @@
 #define CIRCE_SCENE_VOLUME_BOX_H
 
 #include <circe/gl/texture/texture.h>
+#include <circe/gl/texture/macro_cell_grid.h>
+#include <circe/gl/texture/texture_upload_ring.h>
 #include <circe/gl/scene/scene_object.h>
 
 namespace circe::gl {
@@ -41,6 +43,10 @@ public:
   Texture &texture();
   /// \param data
   void update(float *data);
+  /// Uploads only the changed regions of data (through a PBO ring)
+  /// \param data whole grid data
+  /// \param dirty changed regions (depth = 1)
+  void update(float *data, const std::vector<TexelRegion> &dirty);
 
   float absorption = 1.f;
   hermes::vec3 light_intensity = hermes::vec3(1);
@@ -49,6 +55,7 @@ private:
   VolumeBox2();
   void render(GLenum cullFace);
   Texture density_texture_;
+  TextureUploadRing upload_ring_;
 };
 
 class VolumeBox : public SceneMeshObject {
@@ -64,17 +71,28 @@ public:
   const Texture &texture() const;
   /// \return
   Texture &texture();
+  /// Uploads new data and rebuilds the macro cell grid used to skip empty
+  /// space
   /// \param data
   void update(float *data);
+  /// Uploads only the changed regions of data (through a PBO ring) and
+  /// rebuilds the macro cells they overlap
+  /// \param data whole volume data
+  /// \param dirty changed regions
+  void update(float *data, const std::vector<TexelRegion> &dirty);
 
   float absorption = 1.f;
   hermes::vec3 lightIntensity = hermes::vec3(1);
   hermes::vec3 lightPos = hermes::vec3();
+  u32 macro_cell_size = 8; //!< texels per macro cell side (applied on update)
+  float min_transmittance = 0.01f; //!< rays stop below this transmittance
 
 private:
   VolumeBox();
   void render(GLenum cullFace);
   Texture densityTexture;
+  MacroCellGrid macro_cells_;
+  TextureUploadRing upload_ring_;
 };
 
 } // namespace circe
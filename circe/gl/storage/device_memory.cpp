@@ -117,6 +117,11 @@ void DeviceMemory::resize(u64 size_in_bytes) {
   allocate_(nullptr);
 }
 
+void DeviceMemory::reserve(u64 size_in_bytes) {
+  if (!allocated() || size_ < size_in_bytes)
+    resize(size_in_bytes);
+}
+
 void DeviceMemory::allocate_(void *data) {
   destroy();
   CHECK_GL_ERRORS
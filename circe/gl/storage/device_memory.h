@@ -111,6 +111,10 @@ public:
   void setUsage(GLuint _usage);
   /// \param size Specifies the size in bytes of the buffer object.
   void resize(u64 size_in_bytes);
+  /// Reallocates the buffer only if it is not allocated or smaller than the
+  /// requested size. Contents are lost when the buffer grows.
+  /// \param size_in_bytes minimum buffer size in bytes
+  void reserve(u64 size_in_bytes);
   /// \return buffer size in bytes
   [[nodiscard]] inline u64 size() const { return size_; }
   /// \return buffer usage
@@ -0,0 +1,308 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file bricked_volume.cpp
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+#include <circe/gl/texture/bricked_volume.h>
+#include <hermes/common/debug.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace circe::gl {
+
+namespace {
+
+const char *bricked_volume_glsl =
+    "uniform sampler3D brick_atlas;\n"
+    "uniform sampler3D brick_page_table;\n"
+    "uniform vec3 brick_volume_size;\n"
+    "uniform float brick_size;\n"
+    "float sampleBricked(vec3 uvw) {\n"
+    "  vec3 p = clamp(uvw, vec3(0.0), vec3(1.0)) * brick_volume_size;\n"
+    "  vec3 brick = min(floor(p / brick_size), vec3(textureSize(brick_page_table, 0)) - 1.0);\n"
+    "  vec4 entry = texelFetch(brick_page_table, ivec3(brick), 0);\n"
+    "  if (entry.x < 0.0)\n"
+    "    return 0.0;\n"
+    "  float padded = brick_size + 2.0;\n"
+    "  ivec3 slots = textureSize(brick_atlas, 0) / int(padded);\n"
+    "  int slot = int(entry.x);\n"
+    "  vec3 origin = vec3(slot % slots.x, (slot / slots.x) % slots.y, slot / (slots.x * slots.y)) * padded;\n"
+    // skip the apron texel
+    "  vec3 local = p - brick * brick_size + 1.0;\n"
+    "  float v = texture(brick_atlas, (origin + local) / vec3(textureSize(brick_atlas, 0))).r;\n"
+    "  return entry.z + entry.y * v;\n"
+    "}\n";
+
+u16 toHalf(f32 value) {
+  u32 bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  u32 sign = (bits >> 16) & 0x8000;
+  i32 exponent = static_cast<i32>((bits >> 23) & 0xff) - 127 + 15;
+  u32 mantissa = bits & 0x7fffff;
+  if (exponent <= 0) {
+    if (exponent < -10)
+      return static_cast<u16>(sign);
+    // subnormal
+    mantissa |= 0x800000;
+    return static_cast<u16>(sign | (mantissa >> (14 - exponent)));
+  }
+  if (exponent >= 31)
+    return static_cast<u16>(sign | 0x7c00);
+  return static_cast<u16>(sign | (exponent << 10) | (mantissa >> 13));
+}
+
+}
+
+const char *BrickedVolume::glsl() {
+  return bricked_volume_glsl;
+}
+
+BrickedVolume::BrickedVolume() = default;
+
+BrickedVolume::~BrickedVolume() = default;
+
+bool BrickedVolume::init(const hermes::size3 &resolution, u32 brick_size, Storage storage,
+                         u32 max_resident_bricks) {
+  resolution_ = resolution;
+  brick_size_ = std::max(1u, brick_size);
+  storage_ = storage;
+  brick_grid_ = hermes::size3((resolution.width + brick_size_ - 1) / brick_size_,
+                              (resolution.height + brick_size_ - 1) / brick_size_,
+                              (resolution.depth + brick_size_ - 1) / brick_size_);
+  u32 brick_count = brick_grid_.width * brick_grid_.height * brick_grid_.depth;
+  u32 capacity = max_resident_bricks ? std::min(max_resident_bricks, brick_count) : brick_count;
+  // cube-like slot layout
+  u32 side = std::max(1u, static_cast<u32>(std::ceil(std::cbrt(static_cast<f64>(capacity)))));
+  slot_grid_ = hermes::size3(side, side, (capacity + side * side - 1) / (side * side));
+  const u32 padded = brick_size_ + 2;
+  GLint max_size = 0;
+  glGetIntegerv(GL_MAX_3D_TEXTURE_SIZE, &max_size);
+  if (static_cast<i64>(side) * padded > max_size) {
+    HERMES_LOG_ERROR("brick atlas of {} bricks exceeds GL_MAX_3D_TEXTURE_SIZE ({})", capacity, max_size);
+    return false;
+  }
+  // atlas
+  Texture::Attributes attributes;
+  attributes.size_in_texels = {slot_grid_.width * padded, slot_grid_.height * padded, slot_grid_.depth * padded};
+  attributes.target = GL_TEXTURE_3D;
+  attributes.format = GL_RED;
+  switch (storage_) {
+  case Storage::float32: attributes.internal_format = GL_R32F;
+    attributes.type = GL_FLOAT;
+    break;
+  case Storage::float16: attributes.internal_format = GL_R16F;
+    attributes.type = GL_HALF_FLOAT;
+    break;
+  case Storage::unorm8: attributes.internal_format = GL_R8;
+    attributes.type = GL_UNSIGNED_BYTE;
+    break;
+  }
+  atlas_.set(attributes);
+  atlas_.bind();
+  Texture::View view(GL_TEXTURE_3D);
+  view[GL_TEXTURE_MIN_FILTER] = GL_LINEAR;
+  view[GL_TEXTURE_MAG_FILTER] = GL_LINEAR;
+  view[GL_TEXTURE_WRAP_S] = GL_CLAMP_TO_EDGE;
+  view[GL_TEXTURE_WRAP_T] = GL_CLAMP_TO_EDGE;
+  view[GL_TEXTURE_WRAP_R] = GL_CLAMP_TO_EDGE;
+  view.apply();
+  // page table, every brick starts empty
+  page_entries_.assign(4 * static_cast<size_t>(brick_count), 0.f);
+  for (size_t i = 0; i < brick_count; ++i)
+    page_entries_[4 * i] = -1.f;
+  attributes.size_in_texels = brick_grid_;
+  attributes.internal_format = GL_RGBA32F;
+  attributes.format = GL_RGBA;
+  attributes.type = GL_FLOAT;
+  page_table_.set(attributes);
+  page_table_.setTexels(page_entries_.data());
+  page_table_.bind();
+  view[GL_TEXTURE_MIN_FILTER] = GL_NEAREST;
+  view[GL_TEXTURE_MAG_FILTER] = GL_NEAREST;
+  view.apply();
+  // slots are taken from the back
+  capacity_ = capacity;
+  free_slots_.resize(capacity);
+  for (u32 i = 0; i < capacity; ++i)
+    free_slots_[i] = capacity - 1 - i;
+  warned_full_ = false;
+  CHECK_GL_ERRORS;
+  return true;
+}
+
+void BrickedVolume::update(const f32 *data, const std::vector<TexelRegion> &dirty) {
+  if (!data || page_entries_.empty())
+    return;
+  // bricks touched by the regions, aprons included
+  std::vector<u8> marked(brick_grid_.width * brick_grid_.height * brick_grid_.depth, dirty.empty());
+  const i32 n = brick_size_;
+  for (const auto &region : dirty) {
+    i32 lower[3] = {region.offset.i, region.offset.j, region.offset.k};
+    i32 upper[3] = {region.offset.i + static_cast<i32>(region.size.width),
+                    region.offset.j + static_cast<i32>(region.size.height),
+                    region.offset.k + static_cast<i32>(region.size.depth)};
+    i32 grid[3] = {static_cast<i32>(brick_grid_.width), static_cast<i32>(brick_grid_.height),
+                   static_cast<i32>(brick_grid_.depth)};
+    i32 first[3], last[3];
+    for (int d = 0; d < 3; ++d) {
+      first[d] = std::max(0, (lower[d] - 1) / n);
+      last[d] = std::min(grid[d] - 1, upper[d] / n);
+    }
+    for (i32 z = first[2]; z <= last[2]; ++z)
+      for (i32 y = first[1]; y <= last[1]; ++y)
+        for (i32 x = first[0]; x <= last[0]; ++x)
+          marked[(z * grid[1] + y) * grid[0] + x] = 1;
+  }
+  hermes::index3 changed_lower(brick_grid_.width, brick_grid_.height, brick_grid_.depth);
+  hermes::index3 changed_upper(-1, -1, -1);
+  for (u32 z = 0; z < brick_grid_.depth; ++z)
+    for (u32 y = 0; y < brick_grid_.height; ++y)
+      for (u32 x = 0; x < brick_grid_.width; ++x) {
+        if (!marked[(z * brick_grid_.height + y) * brick_grid_.width + x])
+          continue;
+        updateBrick(data, hermes::index3(x, y, z));
+        changed_lower = hermes::index3(std::min<i32>(changed_lower.i, x), std::min<i32>(changed_lower.j, y),
+                                       std::min<i32>(changed_lower.k, z));
+        changed_upper = hermes::index3(std::max<i32>(changed_upper.i, x), std::max<i32>(changed_upper.j, y),
+                                       std::max<i32>(changed_upper.k, z));
+      }
+  if (changed_upper.i >= 0)
+    ring_.upload(page_table_, {changed_lower, {static_cast<u32>(changed_upper.i - changed_lower.i + 1),
+                                               static_cast<u32>(changed_upper.j - changed_lower.j + 1),
+                                               static_cast<u32>(changed_upper.k - changed_lower.k + 1)}},
+                 page_entries_.data(), 4 * sizeof(f32));
+  ring_.flush();
+}
+
+void BrickedVolume::updateBrick(const f32 *data, const hermes::index3 &brick) {
+  const i32 padded = brick_size_ + 2;
+  const i32 w = resolution_.width, h = resolution_.height, d = resolution_.depth;
+  // gather the padded brick, clamping at the volume borders
+  brick_values_.resize(static_cast<size_t>(padded) * padded * padded);
+  f32 min_value = std::numeric_limits<f32>::max();
+  f32 max_value = std::numeric_limits<f32>::lowest();
+  size_t index = 0;
+  for (i32 z = 0; z < padded; ++z) {
+    i32 vz = std::clamp<i32>(brick.k * brick_size_ + z - 1, 0, d - 1);
+    for (i32 y = 0; y < padded; ++y) {
+      i32 vy = std::clamp<i32>(brick.j * brick_size_ + y - 1, 0, h - 1);
+      const f32 *row = data + (static_cast<size_t>(vz) * h + vy) * w;
+      for (i32 x = 0; x < padded; ++x) {
+        f32 v = row[std::clamp<i32>(brick.i * brick_size_ + x - 1, 0, w - 1)];
+        brick_values_[index++] = v;
+        min_value = std::min(min_value, v);
+        max_value = std::max(max_value, v);
+      }
+    }
+  }
+  size_t entry = 4 * ((static_cast<size_t>(brick.k) * brick_grid_.height + brick.j) * brick_grid_.width + brick.i);
+  i32 slot = static_cast<i32>(page_entries_[entry]);
+  if (max_value <= empty_threshold) {
+    // release the slot
+    if (slot >= 0)
+      free_slots_.emplace_back(slot);
+    page_entries_[entry] = -1.f;
+    return;
+  }
+  if (slot < 0) {
+    if (free_slots_.empty()) {
+      if (!warned_full_)
+        HERMES_LOG_WARNING("brick atlas is full, non-empty bricks are being dropped");
+      warned_full_ = true;
+      return;
+    }
+    slot = free_slots_.back();
+    free_slots_.pop_back();
+  }
+  // encode
+  f32 scale = 1.f, offset = 0.f;
+  u32 texel_size = 4;
+  switch (storage_) {
+  case Storage::float32:staging_.resize(brick_values_.size() * sizeof(f32));
+    std::memcpy(staging_.data(), brick_values_.data(), staging_.size());
+    break;
+  case Storage::float16:texel_size = sizeof(u16);
+    staging_.resize(brick_values_.size() * sizeof(u16));
+    for (size_t i = 0; i < brick_values_.size(); ++i) {
+      u16 half = toHalf(brick_values_[i]);
+      std::memcpy(staging_.data() + i * sizeof(u16), &half, sizeof(u16));
+    }
+    break;
+  case Storage::unorm8:texel_size = 1;
+    offset = min_value;
+    scale = max_value - min_value;
+    staging_.resize(brick_values_.size());
+    for (size_t i = 0; i < brick_values_.size(); ++i)
+      staging_[i] = scale > 0.f ? static_cast<u8>(std::lround((brick_values_[i] - offset) / scale * 255.f)) : 0;
+    break;
+  }
+  page_entries_[entry + 0] = static_cast<f32>(slot);
+  page_entries_[entry + 1] = scale;
+  page_entries_[entry + 2] = offset;
+  hermes::index3 origin(static_cast<i32>(slot % slot_grid_.width) * padded,
+                        static_cast<i32>((slot / slot_grid_.width) % slot_grid_.height) * padded,
+                        static_cast<i32>(slot / (slot_grid_.width * slot_grid_.height)) * padded);
+  ring_.uploadPacked(atlas_, {origin, {static_cast<u32>(padded), static_cast<u32>(padded), static_cast<u32>(padded)}},
+                     staging_.data(), texel_size);
+}
+
+void BrickedVolume::bind(GLenum atlas_unit, GLenum page_table_unit) const {
+  atlas_.bind(atlas_unit);
+  page_table_.bind(page_table_unit);
+}
+
+void BrickedVolume::setUniforms(const Program &program) const {
+  program.setUniform("brick_volume_size",
+                     hermes::vec3(resolution_.width, resolution_.height, resolution_.depth));
+  program.setUniform("brick_size", static_cast<f32>(brick_size_));
+}
+
+u32 BrickedVolume::residentBrickCount() const {
+  return brickCapacity() - free_slots_.size();
+}
+
+u32 BrickedVolume::brickCapacity() const {
+  return capacity_;
+}
+
+hermes::size3 BrickedVolume::brickGridSize() const {
+  return brick_grid_;
+}
+
+const Texture &BrickedVolume::atlas() const {
+  return atlas_;
+}
+
+const Texture &BrickedVolume::pageTable() const {
+  return page_table_;
+}
+
+u64 BrickedVolume::uploadedBytes() const {
+  return ring_.uploadedBytes();
+}
+
+}
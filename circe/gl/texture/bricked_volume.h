@@ -0,0 +1,138 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file bricked_volume.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+#ifndef CIRCE_CIRCE_GL_TEXTURE_BRICKED_VOLUME_H
+#define CIRCE_CIRCE_GL_TEXTURE_BRICKED_VOLUME_H
+
+#include <circe/gl/texture/texture_upload_ring.h>
+#include <circe/gl/graphics/shader.h>
+
+namespace circe::gl {
+
+/// Sparse storage for mostly empty scalar volumes.
+/// The volume is split into bricks of brick_size^3 texels. Only non-empty
+/// bricks are stored, each in a slot of a 3D atlas texture with a one texel
+/// apron (so hardware trilinear filtering is seamless across bricks). A page
+/// table texture (one RGBA32F texel per brick) holds the atlas slot of each
+/// brick (-1 if empty) and the scale/offset used to decode its values.
+/// Bricks can be stored as f32, f16 or 8-bit values quantized to the
+/// [min, max] range of each brick, cutting memory and upload bandwidth 2-4x.
+/// Updates only touch the bricks overlapping the dirty regions and are
+/// streamed through a TextureUploadRing.
+/// Shaders sample the volume with the code returned by glsl():
+/// \code{.cpp}
+///     BrickedVolume volume;
+///     volume.init({512, 512, 512}, 16, BrickedVolume::Storage::unorm8, 4096);
+///     volume.update(density.data());                  // everything
+///     volume.update(density.data(), {{{0, 0, 0}, {64, 64, 64}}}); // only a region
+///     volume.bind(GL_TEXTURE0, GL_TEXTURE1);
+///     volume.setUniforms(program);
+///     // glsl: float d = sampleBricked(uvw);
+/// \endcode
+/// \note Bricks are placed in an atlas instead of ARB_sparse_texture pages,
+/// since the GL loader only exposes core functions.
+class BrickedVolume {
+public:
+  /// Atlas texel format
+  enum class Storage {
+    float32, //!< GL_R32F
+    float16, //!< GL_R16F
+    unorm8   //!< GL_R8, quantized per brick
+  };
+  // ***********************************************************************
+  //                           STATIC METHODS
+  // ***********************************************************************
+  /// \return glsl declarations of the brick_atlas, brick_page_table,
+  /// brick_volume_size and brick_size uniforms and of the
+  /// float sampleBricked(vec3 uvw) function
+  static const char *glsl();
+  // ***********************************************************************
+  //                           CONSTRUCTORS
+  // ***********************************************************************
+  BrickedVolume();
+  ~BrickedVolume();
+  // ***********************************************************************
+  //                           METHODS
+  // ***********************************************************************
+  /// Allocates the atlas and the page table, all bricks start empty
+  /// \param resolution volume size in texels
+  /// \param brick_size brick side in texels (without apron)
+  /// \param storage atlas texel format
+  /// \param max_resident_bricks atlas capacity (0 = all bricks)
+  /// \return true if success
+  bool init(const hermes::size3 &resolution, u32 brick_size = 16, Storage storage = Storage::float16,
+            u32 max_resident_bricks = 0);
+  /// Re-classifies and uploads the bricks overlapping the dirty regions
+  /// \param data host volume with resolution texels (x varies fastest)
+  /// \param dirty updated regions (empty = whole volume)
+  void update(const f32 *data, const std::vector<TexelRegion> &dirty = {});
+  /// \param atlas_unit texture unit of brick_atlas
+  /// \param page_table_unit texture unit of brick_page_table
+  void bind(GLenum atlas_unit, GLenum page_table_unit) const;
+  /// Sets brick_volume_size and brick_size
+  /// \param program
+  void setUniforms(const Program &program) const;
+  // ***********************************************************************
+  //                           FIELDS
+  // ***********************************************************************
+  /// \return number of bricks stored in the atlas
+  [[nodiscard]] u32 residentBrickCount() const;
+  /// \return atlas capacity in bricks
+  [[nodiscard]] u32 brickCapacity() const;
+  /// \return number of bricks in each dimension
+  [[nodiscard]] hermes::size3 brickGridSize() const;
+  /// \return
+  [[nodiscard]] const Texture &atlas() const;
+  /// \return
+  [[nodiscard]] const Texture &pageTable() const;
+  /// \return total bytes streamed to the GPU
+  [[nodiscard]] u64 uploadedBytes() const;
+
+  f32 empty_threshold{0.f}; //!< bricks with all values <= threshold are not stored
+
+private:
+  void updateBrick(const f32 *data, const hermes::index3 &brick);
+
+  hermes::size3 resolution_;
+  hermes::size3 brick_grid_;
+  hermes::size3 slot_grid_;
+  u32 brick_size_{16};
+  u32 capacity_{0};
+  Storage storage_{Storage::float16};
+  Texture atlas_;
+  Texture page_table_;
+  std::vector<f32> page_entries_; //!< (slot, scale, offset, 0) per brick
+  std::vector<u32> free_slots_;
+  std::vector<f32> brick_values_; //!< padded brick gathered from host data
+  std::vector<u8> staging_;       //!< padded brick in storage format
+  bool warned_full_{false};
+  TextureUploadRing ring_;
+};
+
+}
+
+#endif //CIRCE_CIRCE_GL_TEXTURE_BRICKED_VOLUME_H
@@ -0,0 +1,163 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file macro_cell_grid.cpp
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+#include <circe/gl/texture/macro_cell_grid.h>
+#include <hermes/common/debug.h>
+#include <algorithm>
+
+namespace circe::gl {
+
+namespace {
+
+const char *macro_cell_cs = "#version 430 core\n"
+                            "layout(local_size_x = 4, local_size_y = 4, local_size_z = 4) in;\n"
+                            "layout(binding = 0) uniform sampler3D volume;\n"
+                            "layout(binding = 0, rg32f) writeonly uniform image3D cells;\n"
+                            "uniform int cell_size;\n"
+                            "uniform ivec3 first_cell;\n"
+                            "uniform ivec3 cell_count;\n"
+                            "void main() {\n"
+                            "  ivec3 id = ivec3(gl_GlobalInvocationID);\n"
+                            "  if (any(greaterThanEqual(id, cell_count)))\n"
+                            "    return;\n"
+                            "  ivec3 cell = first_cell + id;\n"
+                            "  ivec3 resolution = textureSize(volume, 0);\n"
+                            // one texel border for trilinear filtering
+                            "  ivec3 lower = max(cell * cell_size - 1, ivec3(0));\n"
+                            "  ivec3 upper = min((cell + 1) * cell_size + 1, resolution);\n"
+                            "  vec2 bounds = vec2(1e30, -1e30);\n"
+                            "  for (int z = lower.z; z < upper.z; ++z)\n"
+                            "    for (int y = lower.y; y < upper.y; ++y)\n"
+                            "      for (int x = lower.x; x < upper.x; ++x) {\n"
+                            "        float v = texelFetch(volume, ivec3(x, y, z), 0).r;\n"
+                            "        bounds = vec2(min(bounds.x, v), max(bounds.y, v));\n"
+                            "      }\n"
+                            "  imageStore(cells, cell, vec4(bounds, 0.0, 0.0));\n"
+                            "}\n";
+
+u32 cellCount(u32 texels, u32 cell_size) {
+  return std::max(1u, (texels + cell_size - 1) / cell_size);
+}
+
+}
+
+MacroCellGrid::MacroCellGrid() = default;
+
+MacroCellGrid::~MacroCellGrid() = default;
+
+bool MacroCellGrid::build(const Texture &volume, u32 cell_size) {
+  HERMES_VALIDATE_EXP_WITH_WARNING(volume.target() == GL_TEXTURE_3D, "macro cell grid expects a 3D texture.")
+  cell_size_ = std::max(1u, cell_size);
+  auto volume_size = volume.size();
+  hermes::size3 resolution(cellCount(volume_size.width, cell_size_),
+                           cellCount(volume_size.height, cell_size_),
+                           cellCount(volume_size.depth, cell_size_));
+  auto current = cells_.size();
+  if (!cells_.textureObjectId() || current.width != resolution.width || current.height != resolution.height ||
+      current.depth != resolution.depth) {
+    Texture::Attributes attributes;
+    attributes.size_in_texels = resolution;
+    attributes.internal_format = GL_RG32F;
+    attributes.format = GL_RG;
+    attributes.type = GL_FLOAT;
+    attributes.target = GL_TEXTURE_3D;
+    cells_.set(attributes);
+    cells_.bind();
+    Texture::View view(GL_TEXTURE_3D);
+    view[GL_TEXTURE_MIN_FILTER] = GL_NEAREST;
+    view[GL_TEXTURE_MAG_FILTER] = GL_NEAREST;
+    view[GL_TEXTURE_WRAP_S] = GL_CLAMP_TO_EDGE;
+    view[GL_TEXTURE_WRAP_T] = GL_CLAMP_TO_EDGE;
+    view[GL_TEXTURE_WRAP_R] = GL_CLAMP_TO_EDGE;
+    view.apply();
+  }
+  return dispatch(volume, {0, 0, 0}, resolution);
+}
+
+bool MacroCellGrid::update(const Texture &volume, const TexelRegion &region) {
+  if (!cell_size_)
+    return build(volume);
+  auto resolution = cells_.size();
+  const i32 n = cell_size_;
+  // border texels also belong to the neighbour cells
+  hermes::index3 first(std::max(0, (region.offset.i - 1) / n),
+                       std::max(0, (region.offset.j - 1) / n),
+                       std::max(0, (region.offset.k - 1) / n));
+  hermes::index3 last(std::min<i32>(resolution.width - 1, (region.offset.i + region.size.width) / n),
+                      std::min<i32>(resolution.height - 1, (region.offset.j + region.size.height) / n),
+                      std::min<i32>(resolution.depth - 1, (region.offset.k + region.size.depth) / n));
+  if (last.i < first.i || last.j < first.j || last.k < first.k)
+    return true;
+  return dispatch(volume, first, hermes::size3(last.i - first.i + 1, last.j - first.j + 1, last.k - first.k + 1));
+}
+
+bool MacroCellGrid::update(const Texture &volume, const std::vector<TexelRegion> &dirty) {
+  for (const auto &region : dirty)
+    if (!update(volume, region))
+      return false;
+  return true;
+}
+
+bool MacroCellGrid::dispatch(const Texture &volume, const hermes::index3 &first_cell,
+                             const hermes::size3 &cell_count) {
+  if (!program_.good()) {
+    program_.attach(Shader(GL_COMPUTE_SHADER, macro_cell_cs));
+    if (!program_.link()) {
+      HERMES_LOG_ERROR("failed to compile macro cell grid shader: {}", program_.err);
+      return false;
+    }
+  }
+  program_.use();
+  program_.setUniform("cell_size", static_cast<int>(cell_size_));
+  glUniform3i(glGetUniformLocation(program_.id(), "first_cell"), first_cell.i, first_cell.j, first_cell.k);
+  glUniform3i(glGetUniformLocation(program_.id(), "cell_count"),
+              cell_count.width, cell_count.height, cell_count.depth);
+  volume.bind(GL_TEXTURE0);
+  glBindImageTexture(0, cells_.textureObjectId(), 0, GL_TRUE, 0, GL_WRITE_ONLY, GL_RG32F);
+  glDispatchCompute((cell_count.width + 3) / 4, (cell_count.height + 3) / 4, (cell_count.depth + 3) / 4);
+  glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+  CHECK_GL_ERRORS;
+  return true;
+}
+
+void MacroCellGrid::bind(GLenum texture_unit) const {
+  cells_.bind(texture_unit);
+}
+
+const Texture &MacroCellGrid::texture() const {
+  return cells_;
+}
+
+hermes::size3 MacroCellGrid::resolution() const {
+  return cells_.size();
+}
+
+u32 MacroCellGrid::cellSize() const {
+  return cell_size_;
+}
+
+}
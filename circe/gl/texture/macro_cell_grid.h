@@ -0,0 +1,97 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file macro_cell_grid.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+#ifndef CIRCE_CIRCE_GL_TEXTURE_MACRO_CELL_GRID_H
+#define CIRCE_CIRCE_GL_TEXTURE_MACRO_CELL_GRID_H
+
+#include <circe/gl/texture/texture.h>
+#include <circe/gl/graphics/shader.h>
+
+namespace circe::gl {
+
+/// Coarse min/max grid over a 3D scalar texture (density, extinction, ...).
+/// Each macro cell covers cell_size^3 texels of the volume and stores their
+/// minimum and maximum values in a GL_RG32F 3D texture. Cells also cover a
+/// one texel border, so the bounds hold for trilinear lookups anywhere
+/// inside the cell.
+/// Ray marchers use the grid to skip empty cells and to get tight local
+/// majorants for delta tracking. The grid is built on the GPU by a compute
+/// shader, so it can be rebuilt every time the volume changes.
+/// \code{.cpp}
+///     MacroCellGrid grid;
+///     grid.build(density_texture, 8);
+///     grid.bind(GL_TEXTURE1);
+///     // glsl: texelFetch(macro_cells, ivec3(uvw * textureSize(macro_cells, 0)), 0).rg
+/// \endcode
+class MacroCellGrid {
+public:
+  // ***********************************************************************
+  //                           CONSTRUCTORS
+  // ***********************************************************************
+  MacroCellGrid();
+  ~MacroCellGrid();
+  // ***********************************************************************
+  //                           METHODS
+  // ***********************************************************************
+  /// Rebuilds the grid from the current contents of a volume
+  /// \param volume GL_TEXTURE_3D, values are read from the red channel
+  /// \param cell_size number of volume texels per cell side
+  /// \return true if success
+  bool build(const Texture &volume, u32 cell_size = 8);
+  /// Rebuilds only the cells overlapping a region of the volume
+  /// \param volume GL_TEXTURE_3D with the same size used in the last build
+  /// \param region updated volume texels
+  /// \return true if success
+  bool update(const Texture &volume, const TexelRegion &region);
+  /// Rebuilds only the cells overlapping the regions of the volume
+  /// \param volume GL_TEXTURE_3D with the same size used in the last build
+  /// \param dirty updated volume texels
+  /// \return true if success
+  bool update(const Texture &volume, const std::vector<TexelRegion> &dirty);
+  /// \param texture_unit
+  void bind(GLenum texture_unit) const;
+  // ***********************************************************************
+  //                           FIELDS
+  // ***********************************************************************
+  /// \return min (r) / max (g) texture
+  [[nodiscard]] const Texture &texture() const;
+  /// \return number of cells in each dimension
+  [[nodiscard]] hermes::size3 resolution() const;
+  /// \return number of volume texels per cell side
+  [[nodiscard]] u32 cellSize() const;
+
+private:
+  bool dispatch(const Texture &volume, const hermes::index3 &first_cell, const hermes::size3 &cell_count);
+
+  Program program_;
+  Texture cells_;
+  u32 cell_size_{0};
+};
+
+}
+
+#endif //CIRCE_CIRCE_GL_TEXTURE_MACRO_CELL_GRID_H
@@ -30,6 +30,7 @@
 #include <circe/scene/shapes.h>
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
+#include <algorithm>
 
 namespace circe::gl {
 
@@ -125,6 +126,24 @@ Texture unfoldCubemap(const Texture &cubemap, texture_options output_options) {
   return output;
 }
 
+Texture colorLookupTexture(const std::vector<circe::Color> &colors) {
+  Texture::Attributes attributes = {
+      .size_in_texels = {static_cast<u32>(colors.size()), 1, 1},
+      .internal_format = GL_RGBA32F,
+      .format = GL_RGBA,
+      .type = GL_FLOAT,
+      .target = GL_TEXTURE_1D,
+  };
+  Texture texture(attributes, colors.data());
+  Texture::View parameters(GL_TEXTURE_1D);
+  parameters[GL_TEXTURE_MIN_FILTER] = GL_LINEAR;
+  parameters[GL_TEXTURE_MAG_FILTER] = GL_LINEAR;
+  parameters[GL_TEXTURE_WRAP_S] = GL_CLAMP_TO_EDGE;
+  texture.bind();
+  parameters.apply();
+  return texture;
+}
+
 Texture convertToCubemap(const Texture &input, texture_options input_options, hermes::size2 resolution) {
   bool input_is_hdr = CIRCE_MASK_BIT(input_options, circe::texture_options::hdr);
   bool input_is_equirectangular = CIRCE_MASK_BIT(input_options, texture_options::equirectangular);
@@ -389,6 +408,24 @@ Texture Texture::fromTexture(const Texture &texture, circe::texture_options outp
   return Texture();
 }
 
+Texture Texture::fromColorPalette(const circe::ColorPalette &palette, u32 size) {
+  size = std::max(1u, size);
+  std::vector<f32> values(size, 0.f);
+  for (u32 i = 1; i < size; ++i)
+    values[i] = static_cast<f32>(i) / static_cast<f32>(size - 1);
+  return colorLookupTexture(palette.map(values));
+}
+
+Texture Texture::fromColorPalette(const circe::ProceduralColorPalette &palette, u32 size) {
+  size = std::max(1u, size);
+  std::vector<circe::Color> colors(size);
+  for (u32 i = 0; i < size; ++i) {
+    colors[i] = palette(size > 1 ? static_cast<f32>(i) / static_cast<f32>(size - 1) : 0.f);
+    colors[i].a = 1.f;
+  }
+  return colorLookupTexture(colors);
+}
+
 Texture::Texture() {
   glGenTextures(1, &texture_object_);
   HERMES_ASSERT(texture_object_);
@@ -441,10 +478,13 @@ Texture &Texture::operator=(Texture &&other) noexcept {
 void Texture::setTexels(const void *texels) const {
   /// bind texture
   glBindTexture(attributes_.target, texture_object_);
-  if (attributes_.target == GL_TEXTURE_3D)
-    glTexImage3D(GL_TEXTURE_3D, 0, attributes_.internal_format, attributes_.size_in_texels.width,
+  if (attributes_.target == GL_TEXTURE_3D || attributes_.target == GL_TEXTURE_2D_ARRAY)
+    glTexImage3D(attributes_.target, 0, attributes_.internal_format, attributes_.size_in_texels.width,
                  attributes_.size_in_texels.height, attributes_.size_in_texels.depth, 0, attributes_.format,
                  attributes_.type, texels);
+  else if (attributes_.target == GL_TEXTURE_1D)
+    glTexImage1D(GL_TEXTURE_1D, 0, attributes_.internal_format, attributes_.size_in_texels.width, 0,
+                 attributes_.format, attributes_.type, texels);
   else if (attributes_.target == GL_TEXTURE_CUBE_MAP)
     for (u32 i = 0; i < 6; ++i)
       glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, attributes_.internal_format, attributes_.size_in_texels.width,
@@ -595,6 +635,17 @@ void Texture::texels(hermes::index2 offset, hermes::size2 size, byte *data) cons
   CHECK_GL_ERRORS;
 }
 
+void Texture::setTexels(const hermes::index3 &offset, const hermes::size3 &size, const void *texels) const {
+  glBindTexture(attributes_.target, texture_object_);
+  if (attributes_.target == GL_TEXTURE_3D || attributes_.target == GL_TEXTURE_2D_ARRAY)
+    glTexSubImage3D(attributes_.target, 0, offset.i, offset.j, offset.k, size.width, size.height, size.depth,
+                    attributes_.format, attributes_.type, texels);
+  else
+    glTexSubImage2D(attributes_.target, 0, offset.i, offset.j, size.width, size.height,
+                    attributes_.format, attributes_.type, texels);
+  CHECK_GL_ERRORS;
+}
+
 void Texture::resize(const hermes::size3 &new_size) {
   attributes_.size_in_texels = new_size;
   setTexels(nullptr);
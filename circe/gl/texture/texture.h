@@ -26,11 +26,18 @@
 #define CIRCE_IO_TEXTURE_H
 
 #include <circe/gl/utils/open_gl.h>
+#include <circe/colors/color_palette.h>
 #include <circe/texture/texture_options.h>
 #include <hermes/common/file_system.h>
 
 namespace circe::gl {
 
+/// Box of texels [offset, offset + size)
+struct TexelRegion {
+  hermes::index3 offset;
+  hermes::size3 size;
+};
+
 /// Holds an OpenGL texture object
 /// \note Texture objects are created and deleted upon initialization and destruction,
 /// respectively. So when using a copy constructor or operator, a full copy of
@@ -129,6 +136,21 @@ public:
 
   static Texture fromTexture(const Texture &texture,
                              circe::texture_options output_options = circe::texture_options::none);
+  /// Bakes a color palette into a 1D RGBA32F lookup texture (linear
+  /// filtering, clamped), so shaders can color map scalars directly:
+  /// \code{.glsl}
+  ///   // t in [0,1], n = texture size, hits the first and last texels exactly
+  ///   vec4 color = texture(palette, (t * (n - 1) + 0.5) / n);
+  /// \endcode
+  /// \param palette
+  /// \param size number of texels
+  /// \return Texture object
+  static Texture fromColorPalette(const circe::ColorPalette &palette, u32 size = 256);
+  /// Bakes a procedural color palette into a 1D RGBA32F lookup texture
+  /// \param palette
+  /// \param size number of texels
+  /// \return Texture object
+  static Texture fromColorPalette(const circe::ProceduralColorPalette &palette, u32 size = 256);
   // ***********************************************************************
   //                           CONSTRUCTORS
   // ***********************************************************************
@@ -199,6 +221,12 @@ public:
   /// \param texels
   /// \param target
   void setTexels(GLenum target, const void *texels) const;
+  /// Updates a region of the texture (glTexSubImage)
+  /// \note If a GL_PIXEL_UNPACK_BUFFER is bound, texels is an offset into it
+  /// \param offset first texel of the region
+  /// \param size region size in texels
+  /// \param texels tightly packed region content
+  void setTexels(const hermes::index3 &offset, const hermes::size3 &size, const void *texels) const;
   /// \param new_size
   void resize(const hermes::size3 &new_size);
   /// \param new_size
@@ -0,0 +1,156 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file texture_upload_ring.cpp
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+#include <circe/gl/texture/texture_upload_ring.h>
+#include <algorithm>
+#include <cstring>
+
+namespace circe::gl {
+
+TextureUploadRing::TextureUploadRing(u32 segment_count, u64 segment_size) : segment_size_(segment_size) {
+  segments_.resize(std::max(1u, segment_count));
+  for (auto &segment : segments_) {
+    segment.memory.setTarget(GL_PIXEL_UNPACK_BUFFER);
+    segment.memory.setUsage(GL_STREAM_DRAW);
+  }
+}
+
+TextureUploadRing::~TextureUploadRing() {
+  for (auto &segment : segments_)
+    if (segment.fence)
+      glDeleteSync(segment.fence);
+}
+
+void TextureUploadRing::upload(const Texture &texture, const TexelRegion &region, const void *data,
+                               u32 texel_size) {
+  auto size = texture.size();
+  const auto *texels = reinterpret_cast<const u8 *>(data);
+  u64 row_pitch = static_cast<u64>(size.width) * texel_size;
+  u64 slice_pitch = row_pitch * size.height;
+  // move data to the first texel of the region
+  texels += region.offset.k * slice_pitch + region.offset.j * row_pitch + region.offset.i * texel_size;
+  uploadSlices(texture, region, texels, row_pitch, slice_pitch, texel_size);
+}
+
+void TextureUploadRing::upload(const Texture &texture, const std::vector<TexelRegion> &dirty, const void *data,
+                               u32 texel_size) {
+  for (const auto &region : dirty)
+    upload(texture, region, data, texel_size);
+  flush();
+}
+
+void TextureUploadRing::uploadPacked(const Texture &texture, const TexelRegion &region, const void *data,
+                                     u32 texel_size) {
+  u64 row_pitch = static_cast<u64>(region.size.width) * texel_size;
+  u64 slice_pitch = row_pitch * region.size.height;
+  uploadSlices(texture, region, reinterpret_cast<const u8 *>(data), row_pitch, slice_pitch, texel_size);
+}
+
+void TextureUploadRing::uploadSlices(const Texture &texture, const TexelRegion &region, const u8 *data,
+                                     u64 row_pitch, u64 slice_pitch, u32 texel_size) {
+  u64 row_size = static_cast<u64>(region.size.width) * texel_size;
+  u64 slice_size = row_size * region.size.height;
+  if (!slice_size || !region.size.depth)
+    return;
+  // a segment must hold at least one slice
+  if (slice_size > segment_size_) {
+    flush();
+    for (auto &segment : segments_)
+      waitSegment(segment);
+    segment_size_ = slice_size;
+    for (auto &segment : segments_)
+      segment.memory.resize(segment_size_);
+    offset_ = 0;
+  }
+  GLint unpack_alignment = 4;
+  glGetIntegerv(GL_UNPACK_ALIGNMENT, &unpack_alignment);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  u32 slices_per_chunk = std::max<u64>(1, segment_size_ / slice_size);
+  for (u32 z = 0; z < region.size.depth; z += slices_per_chunk) {
+    u32 slice_count = std::min<u32>(slices_per_chunk, region.size.depth - z);
+    u64 offset = reserve(slice_count * slice_size);
+    auto &segment = segments_[current_];
+    auto *mapped = reinterpret_cast<u8 *>(segment.memory.mapped(offset, slice_count * slice_size,
+                                                                 GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT |
+                                                                     GL_MAP_UNSYNCHRONIZED_BIT));
+    if (!mapped) {
+      // later client pointer uploads must not source from the ring
+      glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+      break;
+    }
+    for (u32 s = 0; s < slice_count; ++s)
+      for (u32 y = 0; y < region.size.height; ++y)
+        std::memcpy(mapped + s * slice_size + y * row_size, data + (z + s) * slice_pitch + y * row_pitch, row_size);
+    segment.memory.unmap();
+    // the buffer is still bound to GL_PIXEL_UNPACK_BUFFER: texels is an offset
+    TexelRegion chunk{{region.offset.i, region.offset.j, static_cast<i32>(region.offset.k + z)},
+                      {region.size.width, region.size.height, slice_count}};
+    texture.setTexels(chunk.offset, chunk.size, reinterpret_cast<const void *>(offset));
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    uploaded_bytes_ += slice_count * slice_size;
+  }
+  glPixelStorei(GL_UNPACK_ALIGNMENT, unpack_alignment);
+  CHECK_GL_ERRORS;
+}
+
+u64 TextureUploadRing::reserve(u64 size) {
+  if (offset_ + size > segment_size_)
+    flush();
+  auto &segment = segments_[current_];
+  if (!segment.memory.allocated() || segment.memory.size() < segment_size_)
+    segment.memory.resize(segment_size_);
+  u64 offset = offset_;
+  // keep offsets aligned for the driver's copy path
+  offset_ = (offset_ + size + 15) & ~u64(15);
+  return offset;
+}
+
+void TextureUploadRing::flush() {
+  if (!offset_)
+    return;
+  auto &segment = segments_[current_];
+  if (segment.fence)
+    glDeleteSync(segment.fence);
+  segment.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  current_ = (current_ + 1) % segments_.size();
+  offset_ = 0;
+  waitSegment(segments_[current_]);
+}
+
+void TextureUploadRing::waitSegment(Segment &segment) {
+  if (!segment.fence)
+    return;
+  waitSync(segment.fence);
+  glDeleteSync(segment.fence);
+  segment.fence = nullptr;
+}
+
+u64 TextureUploadRing::uploadedBytes() const {
+  return uploaded_bytes_;
+}
+
+}
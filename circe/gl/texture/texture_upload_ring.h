@@ -0,0 +1,113 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file texture_upload_ring.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+#ifndef CIRCE_CIRCE_GL_TEXTURE_TEXTURE_UPLOAD_RING_H
+#define CIRCE_CIRCE_GL_TEXTURE_TEXTURE_UPLOAD_RING_H
+
+#include <circe/gl/texture/texture.h>
+#include <circe/gl/storage/device_memory.h>
+
+namespace circe::gl {
+
+/// Streams texel regions from host memory into textures through a ring of
+/// pixel unpack buffers.
+/// Each upload is written into the current segment of the ring (mapped
+/// unsynchronized) and copied into the texture by glTexSubImage from the
+/// buffer, so the call returns without waiting for the transfer. A segment is
+/// fenced when the ring moves on, and is only written again after the GPU
+/// has consumed it.
+/// \code{.cpp}
+///     TextureUploadRing ring;
+///     // every frame
+///     ring.upload(texture, dirty_regions, host_volume.data(), sizeof(f32));
+///     macro_cells.update(texture, dirty_regions);
+/// \endcode
+class TextureUploadRing {
+public:
+  // ***********************************************************************
+  //                           CONSTRUCTORS
+  // ***********************************************************************
+  /// \param segment_count number of buffers in the ring
+  /// \param segment_size initial size of each buffer in bytes (grows to fit
+  /// at least one slice of the largest upload)
+  explicit TextureUploadRing(u32 segment_count = 3, u64 segment_size = 16u << 20);
+  ~TextureUploadRing();
+  TextureUploadRing(const TextureUploadRing &) = delete;
+  TextureUploadRing &operator=(const TextureUploadRing &) = delete;
+  // ***********************************************************************
+  //                           METHODS
+  // ***********************************************************************
+  /// Uploads a region of a host array that covers the whole texture
+  /// \param texture destination texture (GL_TEXTURE_2D, 2D_ARRAY or 3D)
+  /// \param region region of both the host array and the texture
+  /// \param data host array with texture.size() texels (x varies fastest)
+  /// \param texel_size bytes per texel of data
+  void upload(const Texture &texture, const TexelRegion &region, const void *data, u32 texel_size);
+  /// Uploads the changed regions of a host array that covers the whole
+  /// texture and flushes the ring
+  /// \param texture destination texture (GL_TEXTURE_2D, 2D_ARRAY or 3D)
+  /// \param dirty changed regions of both the host array and the texture
+  /// \param data host array with texture.size() texels (x varies fastest)
+  /// \param texel_size bytes per texel of data
+  void upload(const Texture &texture, const std::vector<TexelRegion> &dirty, const void *data, u32 texel_size);
+  /// Uploads tightly packed region data
+  /// \param texture destination texture (GL_TEXTURE_2D, 2D_ARRAY or 3D)
+  /// \param region destination region
+  /// \param data region.size texels (x varies fastest)
+  /// \param texel_size bytes per texel of data
+  void uploadPacked(const Texture &texture, const TexelRegion &region, const void *data, u32 texel_size);
+  /// Fences the current segment, following uploads go to the next one.
+  /// Call it once per frame.
+  void flush();
+  // ***********************************************************************
+  //                           FIELDS
+  // ***********************************************************************
+  /// \return total number of bytes uploaded
+  [[nodiscard]] u64 uploadedBytes() const;
+
+private:
+  struct Segment {
+    DeviceMemory memory;
+    GLsync fence{nullptr};
+  };
+  /// Copies count slices of a region into the ring and issues the texture update
+  void uploadSlices(const Texture &texture, const TexelRegion &region, const u8 *data,
+                    u64 row_pitch, u64 slice_pitch, u32 texel_size);
+  /// \return offset of size bytes inside the current segment
+  u64 reserve(u64 size);
+  void waitSegment(Segment &segment);
+
+  std::vector<Segment> segments_;
+  u32 current_{0};
+  u64 offset_{0};
+  u64 segment_size_{0};
+  u64 uploaded_bytes_{0};
+};
+
+}
+
+#endif //CIRCE_CIRCE_GL_TEXTURE_TEXTURE_UPLOAD_RING_H
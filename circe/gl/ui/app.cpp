@@ -15,6 +15,9 @@ App::App(uint w, uint h, const char *t, circe::viewport_options viewport_config,
 
   init();
 
+  if (CIRCE_MASK_BIT(options, circe::app_options::on_demand))
+    setOnDemandRendering(true);
+
   auto no_viewport = CIRCE_MASK_BIT(options, circe::app_options::no_viewport);
 
   if (no_viewport)
@@ -64,6 +67,12 @@ void App::init() {
   gd.scrollCallback = [this](double dx, double dy) { scroll(dx, dy); };
   gd.keyCallback = [this](int k, int s, int a, int m) { key(k, s, a, m); };
   gd.resizeCallback = [this](int w, int h) { resize(w, h); };
+  gd.invalidationCallback = [this]() {
+    for (const auto &viewport : viewports_)
+      if (viewport.cameraChanged())
+        return true;
+    return false;
+  };
   initialized_ = true;
 }
 
@@ -75,6 +84,14 @@ int App::run() {
 
 void App::exit() { GraphicsDisplay::instance().stop(); }
 
+void App::requestRedraw(u32 frame_count) { GraphicsDisplay::instance().requestRedraw(frame_count); }
+
+void App::setOnDemandRendering(bool on_demand, double max_fps) {
+  GraphicsDisplay::instance().on_demand_rendering = on_demand;
+  GraphicsDisplay::instance().max_fps = max_fps;
+  GraphicsDisplay::instance().requestRedraw();
+}
+
 void App::render() {
   if (prepareRenderCallback)
     prepareRenderCallback();
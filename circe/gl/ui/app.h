@@ -115,6 +115,12 @@ public:
   int run();
   /// \brief Halts render loop execution
   static void exit();
+  /// \brief Asks for new frames (on demand rendering)
+  /// \param frame_count minimum number of frames to render
+  static void requestRedraw(u32 frame_count = 1);
+  /// \brief Renders only on input, resizes, camera changes and redraw requests
+  /// \param max_fps frame rate cap (0 = uncapped)
+  static void setOnDemandRendering(bool on_demand, double max_fps = 0);
   //                                                                                                     input update
   virtual void button(int b, int a, int m);
   virtual void mouse(double x, double y);
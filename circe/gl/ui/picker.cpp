@@ -27,91 +27,126 @@
 
 #include <circe/gl/ui/picker.h>
 #include <hermes/common/profiler.h>
+#include <algorithm>
+#include <cstring>
 
 namespace circe::gl {
 
-const char *mesh_pick_rt_vs =
-    "#version 450\n"
-    "layout (location = 0) in vec3 a_pos;\n"
-    "layout (location = 0) out vec3 v_world_pos;\n"
-    "layout (location = 1) out vec3 v_view_vector;\n"
-    "layout(location = 2) uniform vec3 camera_pos;\n"
-    "layout(location = 3) uniform mat4 projection;\n"
-    "layout(location = 4) uniform mat4 model;\n"
-    "layout(location = 5) uniform mat4 view;\n"
-    "void main() {\n"
-    "  vec3 world_pos = (vec4(a_pos, 1) * model).xyz;\n"
-    "  gl_Position = projection * view * vec4(world_pos, 1.0);\n"
-    "  v_world_pos = world_pos;\n"
-    "  v_view_vector = world_pos - camera_pos.xyz;\n"
-    "}";
-
-const char *mesh_pick_rt_fs =
-    "#version 450\n"
-    "struct VertexPacked\n"
-    "{\n"
-    " vec3 p;\n"
-    "};"
-    "layout (std430, binding = 3) readonly buffer VertexBuffer {\n"
-    " VertexPacked g_vertices[];\n"
-    "};\n"
-    "layout (std430, binding = 4) readonly buffer IndexBuffer {\n"
-    " uint g_indices[];\n"
-    "};"
-    "vec3 intersectRayTri(vec3 rayOrigin, vec3 rayDirection, vec3 v0, vec3 v1, vec3 v2){\n"
-    "  vec3 e0 = v1 - v0;\n"
-    "  vec3 e1 = v2 - v0;\n"
-    "  vec3 s1 = cross(rayDirection, e1);\n"
-    "  float  invd = 1.0 / (dot(s1, e0));\n"
-    "  vec3 d = rayOrigin - v0;\n"
-    "  float  b1 = dot(d, s1) * invd;\n"
-    "  vec3 s2 = cross(d, e0);\n"
-    "  float  b2 = dot(rayDirection, s2) * invd;\n"
-    "  float temp = dot(e1, s2) * invd;\n"
-    "  return vec3(1.0 - b1 - b2, b1, b2);\n"
-    "}\n"
-    "layout (location = 0) in flat vec3 v_world_pos;\n"
-    "layout (location = 1) in vec3 v_view_vector;\n"
-    "layout(location = 2) uniform vec3 camera_pos;\n"
-    "layout(location = 4) uniform mat4 model;\n"
-    "layout(location = 0) out int p_object_id;\n"
-    "layout(location = 1) out int primitive_id;\n"
-    "layout(location = 2) out int edge_id;\n"
-    "uniform int object_id;\n"
-    "uniform float line_width;\n"
+const char *mesh_pick_rt_cs =
+    "#version 430 core\n"
+    "layout(local_size_x = 64) in;\n"
+    // lower.w = first triangle (leaves) or second child (interior nodes)
+    // upper.w = triangle count | split axis << 16
+    "struct Node { vec4 lower; vec4 upper; };\n"
+    "struct Query { vec4 origin; vec4 direction; };\n"
+    "struct Hit { uvec4 ids; vec4 barycentric; };\n"
+    "layout(std430, binding = 0) readonly buffer Nodes { Node nodes[]; };\n"
+    // 3 vertices per triangle, w of the first vertex holds the primitive index
+    "layout(std430, binding = 1) readonly buffer Triangles { vec4 vertices[]; };\n"
+    "layout(std430, binding = 2) readonly buffer Queries { Query queries[]; };\n"
+    "layout(std430, binding = 3) writeonly buffer Hits { Hit hits[]; };\n"
+    "uniform int query_count;\n"
+    "uniform float edge_width;\n"
     "uniform float vertex_width;\n"
-    "void main(){\n"
-    "  uint index1 = g_indices[gl_PrimitiveID*3+1];\n"
-    "  uint index2 = g_indices[gl_PrimitiveID*3+2];\n"
-    "  vec3 vertex1 = g_vertices[index1].p;\n"
-    "  vec3 vertex2 = g_vertices[index2].p;\n"
-    "  vec3 vbc = intersectRayTri(camera_pos,normalize(v_view_vector),"
-    "                             v_world_pos,"
-    "                             (vec4(vertex1, 1) * model).xyz,"
-    "                             (vec4(vertex2, 1) * model).xyz);\n"
-    "  p_object_id = object_id;\n"
-    "  primitive_id = gl_PrimitiveID;\n"
-    "  edge_id = 0;\n"
-    "  vec3 d = fwidth(vbc);\n"
-    "  vec3 f = step(d * line_width, vbc);\n"
-    "  if(min(min(f.x, f.y), f.z) < 1) {\n"
-    "   edge_id = 30;\n"
-    "   if(f.x < f.y && f.x < f.z)\n"
-    "     edge_id = 10;\n"
-    "   else if(f.y < f.z && f.y < f.z)\n"
-    "     edge_id = 20;\n"
+    "bool intersectBox(vec3 lower, vec3 upper, vec3 o, vec3 inv_d, float t_max) {\n"
+    "  vec3 t0 = (lower - o) * inv_d;\n"
+    "  vec3 t1 = (upper - o) * inv_d;\n"
+    "  vec3 near = min(t0, t1);\n"
+    "  vec3 far = max(t0, t1);\n"
+    "  float t_near = max(max(near.x, near.y), max(near.z, 0.0));\n"
+    "  float t_far = min(min(far.x, far.y), min(far.z, t_max));\n"
+    "  return t_near <= t_far;\n"
+    "}\n"
+    "void main() {\n"
+    "  int q = int(gl_GlobalInvocationID.x);\n"
+    "  if (q >= query_count)\n"
+    "    return;\n"
+    "  vec3 o = queries[q].origin.xyz;\n"
+    "  vec3 d = queries[q].direction.xyz;\n"
+    "  vec3 inv_d = 1.0 / d;\n"
+    "  bvec3 dir_is_neg = lessThan(inv_d, vec3(0.0));\n"
+    "  float closest = 1e30;\n"
+    "  int closest_triangle = -1;\n"
+    "  vec2 closest_uv = vec2(0.0);\n"
+    "  uint stack[64];\n"
+    "  int stack_size = 0;\n"
+    "  uint node = 0u;\n"
+    "  while (true) {\n"
+    "    vec4 lower = nodes[node].lower;\n"
+    "    vec4 upper = nodes[node].upper;\n"
+    "    if (intersectBox(lower.xyz, upper.xyz, o, inv_d, closest)) {\n"
+    "      uint offset = floatBitsToUint(lower.w);\n"
+    "      uint count_axis = floatBitsToUint(upper.w);\n"
+    "      uint count = count_axis & 0xffffu;\n"
+    "      if (count > 0u) {\n"
+    "        for (uint i = offset; i < offset + count; ++i) {\n"
+    "          vec3 v0 = vertices[3 * i].xyz;\n"
+    "          vec3 e0 = vertices[3 * i + 1].xyz - v0;\n"
+    "          vec3 e1 = vertices[3 * i + 2].xyz - v0;\n"
+    "          vec3 s1 = cross(d, e1);\n"
+    "          float det = dot(s1, e0);\n"
+    "          if (abs(det) < 1e-12)\n"
+    "            continue;\n"
+    "          float inv_det = 1.0 / det;\n"
+    "          vec3 s = o - v0;\n"
+    "          float b1 = dot(s, s1) * inv_det;\n"
+    "          vec3 s2 = cross(s, e0);\n"
+    "          float b2 = dot(d, s2) * inv_det;\n"
+    "          float t = dot(e1, s2) * inv_det;\n"
+    "          if (b1 >= 0.0 && b2 >= 0.0 && b1 + b2 <= 1.0 && t > 0.0 && t < closest) {\n"
+    "            closest = t;\n"
+    "            closest_triangle = int(i);\n"
+    "            closest_uv = vec2(b1, b2);\n"
+    "          }\n"
+    "        }\n"
+    "        if (stack_size == 0)\n"
+    "          break;\n"
+    "        node = stack[--stack_size];\n"
+    "      } else if (dir_is_neg[count_axis >> 16]) {\n"
+    "        stack[stack_size++] = node + 1u;\n"
+    "        node = offset;\n"
+    "      } else {\n"
+    "        stack[stack_size++] = offset;\n"
+    "        node = node + 1u;\n"
+    "      }\n"
+    "    } else {\n"
+    "      if (stack_size == 0)\n"
+    "        break;\n"
+    "      node = stack[--stack_size];\n"
+    "    }\n"
     "  }\n"
-    "  f = step(d * vertex_width, vbc);\n"
-    "  if(min(min(f.x, f.y), f.z) < 1) {\n"
-    "   int vertex_id = 0;\n"
-    "   if(vbc.x > 0.9)"
-    "     vertex_id = 1;\n"
-    "   else if(vbc.y > 0.9)\n"
-    "     vertex_id = 2;\n"
-    "   else if(vbc.z > 0.9)\n"
-    "     vertex_id = 3;\n"
-    "   edge_id += vertex_id;\n"
+    "  if (closest_triangle < 0) {\n"
+    "    hits[q].ids = uvec4(0u);\n"
+    "    hits[q].barycentric = vec4(0.0);\n"
+    "    return;\n"
+    "  }\n"
+    "  int i = closest_triangle;\n"
+    "  vec3 v[3] = vec3[3](vertices[3 * i].xyz, vertices[3 * i + 1].xyz, vertices[3 * i + 2].xyz);\n"
+    "  vec3 b = vec3(1.0 - closest_uv.x - closest_uv.y, closest_uv);\n"
+    "  vec3 p = o + closest * d;\n"
+    // size of a pixel at the hit distance
+    "  float pixel = queries[q].origin.w + queries[q].direction.w * closest;\n"
+    "  float double_area = length(cross(v[1] - v[0], v[2] - v[0]));\n"
+    "  uint edge = 0u;\n"
+    "  float edge_distance = edge_width * pixel;\n"
+    "  for (int k = 0; k < 3; ++k) {\n"
+    "    float distance = b[k] * double_area / length(v[(k + 2) % 3] - v[(k + 1) % 3]);\n"
+    "    if (distance < edge_distance) {\n"
+    "      edge_distance = distance;\n"
+    "      edge = uint(k + 1);\n"
+    "    }\n"
+    "  }\n"
+    "  uint vertex = 0u;\n"
+    "  float vertex_distance = vertex_width * pixel;\n"
+    "  for (int k = 0; k < 3; ++k) {\n"
+    "    float distance = length(p - v[k]);\n"
+    "    if (distance < vertex_distance) {\n"
+    "      vertex_distance = distance;\n"
+    "      vertex = uint(k + 1);\n"
+    "    }\n"
     "  }\n"
+    "  hits[q].ids = uvec4(1u, floatBitsToUint(vertices[3 * i].w), edge, vertex);\n"
+    "  hits[q].barycentric = vec4(b, closest);\n"
     "}";
 
 const char *object_pick_vs =
@@ -201,6 +236,66 @@ const char *instance_pick_fs =
     "  result = instance + 1;"
     "}";
 
+namespace {
+
+struct BVHTriangle {
+  hermes::bbox3 bounds;
+  hermes::point3 centroid;
+  u32 index{0};
+};
+
+/// Matches the Node struct of mesh_pick_rt_cs
+struct BVHNode {
+  f32 lower[3];
+  u32 offset;     //!< first triangle (leaves) or second child (interior nodes)
+  f32 upper[3];
+  u32 count_axis; //!< triangle count | split axis << 16
+};
+
+f32 bitsToFloat(u32 bits) {
+  f32 f;
+  std::memcpy(&f, &bits, sizeof(f32));
+  return f;
+}
+
+/// Builds nodes in depth first order (the first child of an interior node
+/// follows it), triangles[start, end) are reordered so leaves index
+/// contiguous ranges.
+u32 buildBVH(std::vector<BVHTriangle> &triangles, u32 start, u32 end, u32 max_leaf_size,
+             std::vector<BVHNode> &nodes) {
+  u32 node_index = nodes.size();
+  nodes.emplace_back();
+  hermes::bbox3 bounds, centroid_bounds;
+  for (u32 i = start; i < end; ++i) {
+    bounds = hermes::make_union(bounds, triangles[i].bounds);
+    centroid_bounds = hermes::make_union(centroid_bounds, triangles[i].centroid);
+  }
+  for (int d = 0; d < 3; ++d) {
+    nodes[node_index].lower[d] = bounds.lower[d];
+    nodes[node_index].upper[d] = bounds.upper[d];
+  }
+  if (end - start <= max_leaf_size) {
+    nodes[node_index].offset = start;
+    nodes[node_index].count_axis = end - start;
+    return node_index;
+  }
+  // split at the median centroid along the largest extent
+  int axis = centroid_bounds.maxExtent();
+  u32 mid = (start + end) / 2;
+  if (centroid_bounds.upper[axis] > centroid_bounds.lower[axis])
+    std::nth_element(triangles.begin() + start, triangles.begin() + mid, triangles.begin() + end,
+                     [axis](const BVHTriangle &a, const BVHTriangle &b) {
+                       return a.centroid[axis] < b.centroid[axis];
+                     });
+  buildBVH(triangles, start, mid, max_leaf_size, nodes);
+  u32 second_child = buildBVH(triangles, mid, end, max_leaf_size, nodes);
+  nodes[node_index].offset = second_child;
+  nodes[node_index].count_axis = static_cast<u32>(axis) << 16;
+  return node_index;
+}
+
+}
+
 Picker::Picker() {
   // compile programs
   program_.attach(Shader(GL_VERTEX_SHADER, object_pick_vs));
@@ -434,106 +529,146 @@ void InstancePicker::pick(const circe::CameraInterface *camera,
 }
 
 RTMeshPicker::RTMeshPicker() {
-  program_.destroy();
-  program_.attach(Shader(GL_VERTEX_SHADER, mesh_pick_rt_vs));
-  program_.attach(Shader(GL_FRAGMENT_SHADER, mesh_pick_rt_fs));
-  if (!program_.link())
-  HERMES_LOG_ERROR("Failed to compile rt picker shader: {}", program_.err);
+  for (auto *memory : {&nodes_, &triangles_, &queries_, &hits_}) {
+    memory->setTarget(GL_SHADER_STORAGE_BUFFER);
+    memory->setUsage(GL_DYNAMIC_DRAW);
+  }
 }
 
 RTMeshPicker::~RTMeshPicker() = default;
 
 HeResult RTMeshPicker::setModel(SceneModel *model) {
+  model_ = nullptr;
+  node_count_ = 0;
+  if (!model || model->model().primitiveType() != hermes::GeometricPrimitiveType::TRIANGLES)
+    return HeResult::ERROR;
+  const auto &indices = model->model().indices();
+  auto positions = model->model().attributeAccessor<hermes::point3>("position");
+  u32 triangle_count = model->model().elementCount();
+  auto vertex_index = [&](u32 triangle, u32 k) -> u32 {
+    return indices.empty() ? 3 * triangle + k : static_cast<u32>(indices[3 * triangle + k]);
+  };
+  // build
+  std::vector<BVHTriangle> triangles(triangle_count);
+  for (u32 i = 0; i < triangle_count; ++i) {
+    triangles[i].index = i;
+    for (u32 k = 0; k < 3; ++k)
+      triangles[i].bounds = hermes::make_union(triangles[i].bounds, positions[vertex_index(i, k)]);
+    triangles[i].centroid = triangles[i].bounds.centroid();
+  }
+  std::vector<BVHNode> nodes;
+  nodes.reserve(triangle_count ? 2 * ((triangle_count + max_leaf_size - 1) / max_leaf_size) : 0);
+  if (triangle_count)
+    buildBVH(triangles, 0, triangle_count, max_leaf_size, nodes);
+  // upload
+  std::vector<f32> vertex_data;
+  vertex_data.reserve(triangle_count * 12);
+  for (const auto &triangle : triangles)
+    for (u32 k = 0; k < 3; ++k) {
+      auto p = positions[vertex_index(triangle.index, k)];
+      vertex_data.insert(vertex_data.end(), {p.x, p.y, p.z, k ? 0.f : bitsToFloat(triangle.index)});
+    }
+  if (!nodes.empty()) {
+    nodes_.reserve(nodes.size() * sizeof(BVHNode));
+    nodes_.copy(nodes.data(), nodes.size() * sizeof(BVHNode));
+    triangles_.reserve(vertex_data.size() * sizeof(f32));
+    triangles_.copy(vertex_data.data(), vertex_data.size() * sizeof(f32));
+  }
   model_ = model;
-  vertex_ssbo_ = ShaderStorageBuffer::fromVertexBuffer(model->vertexBuffer());
-  vertex_ssbo_.setBindingIndex(3);
-  index_ssbo_ = ShaderStorageBuffer::fromIndexBuffer(model->indexBuffer());
-  index_ssbo_.setBindingIndex(4);
+  node_count_ = nodes.size();
   return HeResult::SUCCESS;
 }
 
-void RTMeshPicker::pick(const circe::CameraInterface *camera,
-                      const hermes::index2 &pick_position) {
-  // check pick position
-  if (!(pick_position < t_object_id_.size().slice()) || !(pick_position >= hermes::index2(0, 0)))
-    return;
-
-  glEnable(GL_SCISSOR_TEST);
-  glScissor(static_cast<int>(pick_position.i - 1), static_cast<int>(pick_position.j - 1), 3, 3);
-  t_object_id_.bind();
-  t_primitive_id_.bind();
-  t_barycentric_.bind();
-  index_ssbo_.bind();
-  vertex_ssbo_.bind();
-  fbo_.render([&]() {
-    program_.use();
-    program_.setUniform("projection", camera->getProjectionTransform());
-    program_.setUniform("view", camera->getViewTransform());
-    program_.setUniform("line_width", edge_width);
-    program_.setUniform("vertex_width", vertex_width);
-    program_.setUniform("camera_pos", camera->getPosition());
-    model_->draw();
-  });
-  glDisable(GL_SCISSOR_TEST);
-  // get result
-  std::vector<unsigned char> data(4 * 3 * 3);
-  {
-    HERMES_PROFILE_SCOPE("pick primitive");
-//    auto data = t_primitive_id_.texels();
-//    auto data = t_primitive_id_.texels({static_cast<int>(pick_position.i - 1),
-//                                        static_cast<int>(pick_position.j - 1)}, {3, 3});
-    t_primitive_id_.texels({static_cast<int>(pick_position.i - 1),
-                            static_cast<int>(pick_position.j - 1)}, {3, 3}, &data[0]);
-    // get mouse texel
-//    picked_primitive_index = reinterpret_cast<u32 *>(data.data())[pick_position.j * t_primitive_id_.size().width
-//        + pick_position.i];
-    if (!data.empty())
-      picked_primitive_index = reinterpret_cast<u32 *>(data.data())[4];
-  }
-  {
-    HERMES_PROFILE_SCOPE("pick object");
-    // TODO I should get just the subregion! but it is not working for some reason....
-//    auto data = t_object_id_.texels({static_cast<int>(pick_position.i - 1),
-//                                     static_cast<int>(pick_position.j - 1)}, {3, 3});
-    HERMES_PROFILE_START_BLOCK("texels");
-    t_object_id_.texels({static_cast<int>(pick_position.i - 1),
-                         static_cast<int>(pick_position.j - 1)}, {3, 3}, &data[0]);
-    HERMES_PROFILE_END_BLOCK
-//    auto data = t_object_id_.texels();
-    // get mouse texel
-//    picked_index = reinterpret_cast<u32 *>(data.data())[pick_position.j * t_object_id_.size().width + pick_position.i];
-    if (!data.empty())
-      picked_index = reinterpret_cast<u32 *>(data.data())[4];
-  }
+void RTMeshPicker::setResolution(const hermes::size2 &resolution_in_pixels) {
+  // no render targets, the resolution is only used to build pick rays
+  resolution_ = resolution_in_pixels;
+}
 
-  {
-    HERMES_PROFILE_SCOPE("pick edge");
-//    auto data = t_edge_id_.texels();
-//    auto data = t_edge_id_.texels({static_cast<int>(pick_position.i - 1),
-//                                   static_cast<int>(pick_position.j - 1)}, {3, 3});
-    t_edge_id_.texels({static_cast<int>(pick_position.i - 1),
-                       static_cast<int>(pick_position.j - 1)}, {3, 3}, &data[0]);
-    // get mouse texel
-//    picked_edge_index = reinterpret_cast<u32 *>(data.data())[pick_position.j * t_edge_id_.size().width
-//        + pick_position.i];
-    if (!data.empty()) {
-      picked_edge_index = reinterpret_cast<u32 *>(data.data())[4];
-      picked_vertex_index = picked_edge_index % 10;
-      picked_edge_index /= 10;
+std::vector<RTMeshPicker::Hit> RTMeshPicker::trace(const std::vector<Query> &queries) {
+  std::vector<Hit> hits(queries.size());
+  if (!model_ || !node_count_ || queries.empty())
+    return hits;
+  if (!trace_program_.good()) {
+    trace_program_.attach(Shader(GL_COMPUTE_SHADER, mesh_pick_rt_cs));
+    if (!trace_program_.link()) {
+      HERMES_LOG_ERROR("Failed to compile rt picker shader: {}", trace_program_.err);
+      return hits;
     }
   }
-  {
-//    auto data = t_barycentric_.texels();
-    // get mouse texel
-//    picked_barycentric_coordinates = {
-//        reinterpret_cast<f32 *>(data.data())[pick_position.j * t_barycentric_.size().width * 3
-//            + pick_position.i * 3 + 0],
-//        reinterpret_cast<f32 *>(data.data())[pick_position.j * t_barycentric_.size().width * 3
-//            + pick_position.i * 3 + 1],
-//        reinterpret_cast<f32 *>(data.data())[pick_position.j * t_barycentric_.size().width * 3
-//            + pick_position.i * 3 + 2],
-//    };
+  // rays are traced in model space, with normalized directions
+  auto to_model = hermes::inverse(model_->transform);
+  std::vector<f32> query_data;
+  std::vector<f32> distance_scale(queries.size());
+  query_data.reserve(queries.size() * 8);
+  for (size_t i = 0; i < queries.size(); ++i) {
+    hermes::Ray3 ray = to_model(queries[i].ray);
+    f32 world_length = queries[i].ray.d.length();
+    f32 model_length = ray.d.length();
+    if (world_length == 0.f || model_length == 0.f)
+      model_length = world_length = 1.f;
+    // model units per world unit along the ray
+    distance_scale[i] = model_length / world_length;
+    auto d = ray.d / model_length;
+    query_data.insert(query_data.end(), {ray.o.x, ray.o.y, ray.o.z,
+                                         queries[i].footprint_offset * distance_scale[i],
+                                         d.x, d.y, d.z, queries[i].footprint_slope});
   }
+  queries_.reserve(query_data.size() * sizeof(f32));
+  queries_.copy(query_data.data(), query_data.size() * sizeof(f32));
+  hits_.reserve(queries.size() * 8 * sizeof(u32));
+  trace_program_.use();
+  trace_program_.setUniform("query_count", static_cast<int>(queries.size()));
+  trace_program_.setUniform("edge_width", edge_width);
+  trace_program_.setUniform("vertex_width", vertex_width);
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, nodes_.id());
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, triangles_.id());
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, queries_.id());
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, hits_.id());
+  glDispatchCompute((queries.size() + 63) / 64, 1, 1);
+  glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+  CHECK_GL_ERRORS;
+  // get result
+  HERMES_PROFILE_SCOPE("pick data");
+  auto data = hits_.rawData(0, queries.size() * 8 * sizeof(u32));
+  const auto *ids = reinterpret_cast<const u32 *>(data.data());
+  const auto *barycentric = reinterpret_cast<const f32 *>(data.data());
+  for (size_t i = 0; i < queries.size(); ++i) {
+    if (!ids[8 * i])
+      continue;
+    hits[i].hit = true;
+    hits[i].primitive_index = ids[8 * i + 1];
+    hits[i].edge_index = ids[8 * i + 2];
+    hits[i].vertex_index = ids[8 * i + 3];
+    hits[i].barycentric_coordinates = {barycentric[8 * i + 4], barycentric[8 * i + 5], barycentric[8 * i + 6]};
+    hits[i].distance = barycentric[8 * i + 7] / distance_scale[i];
+  }
+  return hits;
+}
+
+void RTMeshPicker::pick(const circe::CameraInterface *camera,
+                        const hermes::index2 &pick_position) {
+  // check pick position
+  if (!(pick_position < resolution_) || !(pick_position >= hermes::index2(0, 0)))
+    return;
+  // rays through the pixel center and its right neighbour give the pixel
+  // footprint along the ray
+  auto ndc = [&](f32 x, f32 y) {
+    return hermes::point2(2.f * x / resolution_.width - 1.f, 2.f * y / resolution_.height - 1.f);
+  };
+  f32 x = pick_position.i + 0.5f;
+  f32 y = pick_position.j + 0.5f;
+  auto ray = camera->pickRay(ndc(x, y));
+  auto neighbour = camera->pickRay(ndc(x + 1.f, y));
+  Query query;
+  query.ray = hermes::Ray3(ray.o, hermes::normalize(ray.d));
+  query.footprint_offset = (neighbour.o - ray.o).length();
+  query.footprint_slope = (hermes::normalize(neighbour.d) - query.ray.d).length();
+  auto hit = trace({query}).front();
+  picked_index = hit.hit ? object_id : 0;
+  picked_primitive_index = hit.primitive_index;
+  picked_edge_index = hit.edge_index;
+  picked_vertex_index = hit.vertex_index;
+  picked_barycentric_coordinates = hit.barycentric_coordinates;
 }
 
-}
\ No newline at end of file
+}
@@ -133,9 +133,34 @@ public:
 // *********************************************************************************************************************
 //                                                                                                       RTMeshPicker
 // *********************************************************************************************************************
-/// Computes picking by ray tracing mesh elements
+/// Computes picking by ray tracing mesh elements.
+/// setModel builds a bounding volume hierarchy over the model triangles and
+/// uploads it, together with the (reordered) triangle vertices, to shader
+/// storage buffers once. Each pick traces the camera ray through the
+/// hierarchy with a compute shader and reads back a single small result, so
+/// its cost grows logarithmically with the triangle count instead of
+/// requiring the whole model to be rasterized.
+/// Edges and vertices are picked when the hit point is closer to them than
+/// edge_width (vertex_width) pixels, measured at the hit distance.
+/// \note Only triangle models are supported. The model transform is read at
+/// each pick, but vertex data changes require a new setModel call.
 class RTMeshPicker : public MeshPicker {
 public:
+  /// Ray query
+  struct Query {
+    hermes::Ray3 ray;          //!< world space ray
+    f32 footprint_offset{0};   //!< pixel size (world units) at the ray origin
+    f32 footprint_slope{0};    //!< pixel size growth per unit of distance
+  };
+  /// Ray query result
+  struct Hit {
+    bool hit{false};
+    u32 primitive_index{0};
+    u32 edge_index{0};         //!< 0 = none, k = edge opposite to vertex k
+    u32 vertex_index{0};       //!< 0 = none, k = k-th vertex of the primitive
+    hermes::point3 barycentric_coordinates;
+    f32 distance{0};           //!< world space distance along the query ray
+  };
   // *******************************************************************************************************************
   //                                                                                                     CONSTRUCTORS
   // *******************************************************************************************************************
@@ -144,19 +169,36 @@ public:
   // *******************************************************************************************************************
   //                                                                                                          METHODS
   // *******************************************************************************************************************
-  ///
-  /// \param model
+  /// Builds and uploads the model acceleration structure
+  /// \param model triangle model
   /// \return
   HeResult setModel(SceneModel *model);
   ///
+  /// \param resolution_in_pixels
+  void setResolution(const hermes::size2 &resolution_in_pixels) override;
+  /// Traces the camera ray through pick_position and updates the picked fields
   /// \param camera
-  /// \param pick_position
-  /// \param f
+  /// \param pick_position pixel position (origin at the bottom left corner)
   void pick(const circe::CameraInterface *camera, const hermes::index2 &pick_position);
+  /// Traces a batch of rays with a single dispatch
+  /// \param queries
+  /// \return one hit per query
+  std::vector<Hit> trace(const std::vector<Query> &queries);
+  // *******************************************************************************************************************
+  //                                                                                                    PUBLIC FIELDS
+  // *******************************************************************************************************************
+  u32 object_id{1}; //!< value of picked_index on hits (0 on misses)
+  /// maximum number of triangles per leaf
+  static constexpr u32 max_leaf_size = 4;
 private:
-  SceneModel* model_{nullptr};
-  circe::gl::ShaderStorageBuffer vertex_ssbo_;
-  circe::gl::ShaderStorageBuffer index_ssbo_;
+  SceneModel *model_{nullptr};
+  hermes::size2 resolution_;
+  u32 node_count_{0};
+  Program trace_program_;
+  DeviceMemory nodes_;
+  DeviceMemory triangles_;
+  DeviceMemory queries_;
+  DeviceMemory hits_;
 };
 }
 
@@ -0,0 +1,353 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file region_selector.cpp
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+
+#include <circe/gl/ui/region_selector.h>
+#include <algorithm>
+
+namespace circe::gl {
+
+namespace {
+
+const char *region_select_cs =
+    "#version 430 core\n"
+    "layout(local_size_x = 256) in;\n"
+    "layout(std430, binding = 0) readonly buffer ElementData { float element_data[]; };\n"
+    "layout(std430, binding = 1) readonly buffer ElementIndices { uint element_indices[]; };\n"
+    "layout(std430, binding = 2) readonly buffer Polygon { vec2 polygon[]; };\n"
+    "layout(std430, binding = 3) buffer Mask { uint mask[]; };\n"
+    "layout(std430, binding = 4) writeonly buffer Selected { uint selected[]; };\n"
+    "layout(std430, binding = 5) buffer Command { uint command[]; };\n"
+    // 0: update mask, 1: compact selected indices
+    "uniform int stage;\n"
+    // 0: points, 1: instances, 2: triangles
+    "uniform int source;\n"
+    "uniform uint element_count;\n"
+    "uniform uint data_offset;\n"
+    "uniform uint data_stride;\n"
+    "uniform uint index_offset;\n"
+    "uniform mat4 projection;\n"
+    "uniform mat4 view;\n"
+    "uniform mat4 model;\n"
+    "uniform vec2 viewport_size;\n"
+    // 0: rectangle, 1: lasso, 2: brush
+    "uniform int region_type;\n"
+    "uniform vec2 region_min;\n"
+    "uniform vec2 region_max;\n"
+    "uniform vec2 brush_center;\n"
+    "uniform float brush_radius;\n"
+    "uniform int polygon_size;\n"
+    "uniform int subtract;\n"
+    "uniform int depth_test;\n"
+    "uniform float depth_bias;\n"
+    "uniform sampler2D depth_map;\n"
+    "vec3 fetchPosition(uint i) {\n"
+    "  uint b = data_offset + i * data_stride;\n"
+    "  return vec3(element_data[b], element_data[b + 1], element_data[b + 2]);\n"
+    "}\n"
+    "bool insideRegion(vec2 p) {\n"
+    "  if (any(lessThan(p, region_min)) || any(greaterThan(p, region_max)))\n"
+    "    return false;\n"
+    "  if (region_type == 2)\n"
+    "    return distance(p, brush_center) <= brush_radius;\n"
+    "  if (region_type == 0)\n"
+    "    return true;\n"
+    "  bool inside = false;\n"
+    "  for (int k = 0, j = polygon_size - 1; k < polygon_size; j = k++) {\n"
+    "    vec2 a = polygon[k];\n"
+    "    vec2 b = polygon[j];\n"
+    "    if ((a.y > p.y) != (b.y > p.y) && p.x < (b.x - a.x) * (p.y - a.y) / (b.y - a.y) + a.x)\n"
+    "      inside = !inside;\n"
+    "  }\n"
+    "  return inside;\n"
+    "}\n"
+    "void main() {\n"
+    "  uint i = gl_GlobalInvocationID.x;\n"
+    "  if (i >= element_count)\n"
+    "    return;\n"
+    "  uint bit = 1u << (i & 31u);\n"
+    "  if (stage == 1) {\n"
+    "    if ((mask[i >> 5] & bit) != 0u)\n"
+    "      selected[atomicAdd(command[0], 1u)] = i;\n"
+    "    return;\n"
+    "  }\n"
+    "  vec3 p;\n"
+    "  if (source == 2) {\n"
+    "    uint t = index_offset + 3u * i;\n"
+    "    p = (fetchPosition(element_indices[t]) + fetchPosition(element_indices[t + 1u]) +\n"
+    "         fetchPosition(element_indices[t + 2u])) / 3.0;\n"
+    "  } else\n"
+    // points and instances (data_offset points to the translation column)
+    "    p = fetchPosition(i);\n"
+    "  vec4 clip = projection * view * model * vec4(p, 1.0);\n"
+    "  if (clip.w <= 0.0)\n"
+    "    return;\n"
+    "  vec3 ndc = clip.xyz / clip.w;\n"
+    "  vec2 pixel = (ndc.xy * 0.5 + 0.5) * viewport_size;\n"
+    "  float depth = ndc.z * 0.5 + 0.5;\n"
+    "  if (depth < 0.0 || depth > 1.0 || !insideRegion(pixel))\n"
+    "    return;\n"
+    "  if (depth_test != 0) {\n"
+    "    ivec2 texel = clamp(ivec2(pixel), ivec2(0), ivec2(viewport_size) - 1);\n"
+    "    if (depth > texelFetch(depth_map, texel, 0).r + depth_bias)\n"
+    "      return;\n"
+    "  }\n"
+    "  if (subtract != 0)\n"
+    "    atomicAnd(mask[i >> 5], ~bit);\n"
+    "  else\n"
+    "    atomicOr(mask[i >> 5], bit);\n"
+    "}";
+
+}
+
+RegionSelector::Region RegionSelector::Region::rectangle(const hermes::point2 &a, const hermes::point2 &b) {
+  Region region;
+  region.type_ = Type::rectangle;
+  region.a_ = {std::min(a.x, b.x), std::min(a.y, b.y)};
+  region.b_ = {std::max(a.x, b.x), std::max(a.y, b.y)};
+  return region;
+}
+
+RegionSelector::Region RegionSelector::Region::lasso(const std::vector<hermes::point2> &polygon) {
+  Region region;
+  region.type_ = Type::lasso;
+  region.polygon_ = polygon;
+  if (polygon.empty())
+    return region;
+  region.a_ = region.b_ = polygon.front();
+  for (const auto &p : polygon) {
+    region.a_ = {std::min(region.a_.x, p.x), std::min(region.a_.y, p.y)};
+    region.b_ = {std::max(region.b_.x, p.x), std::max(region.b_.y, p.y)};
+  }
+  return region;
+}
+
+RegionSelector::Region RegionSelector::Region::brush(const hermes::point2 &center, f32 radius) {
+  Region region;
+  region.type_ = Type::brush;
+  region.radius_ = radius;
+  region.a_ = {center.x - radius, center.y - radius};
+  region.b_ = {center.x + radius, center.y + radius};
+  return region;
+}
+
+std::string RegionSelector::glsl(GLuint binding) {
+  return "layout(std430, binding = " + std::to_string(binding) +
+      ") readonly buffer SelectionMask { uint selection_mask[]; };\n"
+      "bool isSelected(uint i) { return (selection_mask[i >> 5] & (1u << (i & 31u))) != 0u; }\n";
+}
+
+RegionSelector::RegionSelector() {
+  for (auto *memory : {&mask_, &indices_, &command_, &polygon_}) {
+    memory->setTarget(GL_SHADER_STORAGE_BUFFER);
+    memory->setUsage(GL_DYNAMIC_DRAW);
+  }
+}
+
+RegionSelector::~RegionSelector() = default;
+
+bool RegionSelector::selectVertices(const CameraInterface *camera, const hermes::size2 &viewport_size,
+                                    const SceneModel &model, const Region &region, Operation operation) {
+  const auto &vertex_buffer = model.vertexBuffer();
+  if (!vertex_buffer.memory() || !vertex_buffer.attributes.contains("position"))
+    return false;
+  Input input;
+  input.source = Source::points;
+  input.element_count = vertex_buffer.vertexCount();
+  input.data_buffer = vertex_buffer.memory()->bufferId();
+  input.data_offset = vertex_buffer.memory()->offset() +
+      vertex_buffer.attributes.attributeOffset(vertex_buffer.attributes.attributeIndex("position"));
+  input.data_stride = vertex_buffer.attributes.stride();
+  input.model = model.transform;
+  return select(camera, viewport_size, input, region, operation);
+}
+
+bool RegionSelector::selectPrimitives(const CameraInterface *camera, const hermes::size2 &viewport_size,
+                                      const SceneModel &model, const Region &region, Operation operation) {
+  const auto &vertex_buffer = model.vertexBuffer();
+  const auto &index_buffer = model.indexBuffer();
+  if (!vertex_buffer.memory() || !index_buffer.memory() || !vertex_buffer.attributes.contains("position"))
+    return false;
+  if (index_buffer.element_type != GL_TRIANGLES || index_buffer.data_type != GL_UNSIGNED_INT) {
+    HERMES_LOG_WARNING("region selection of primitives requires triangles with unsigned int indices.");
+    return false;
+  }
+  Input input;
+  input.source = Source::triangles;
+  input.element_count = index_buffer.element_count;
+  input.data_buffer = vertex_buffer.memory()->bufferId();
+  input.data_offset = vertex_buffer.memory()->offset() +
+      vertex_buffer.attributes.attributeOffset(vertex_buffer.attributes.attributeIndex("position"));
+  input.data_stride = vertex_buffer.attributes.stride();
+  input.index_buffer = index_buffer.memory()->bufferId();
+  input.index_offset = index_buffer.memory()->offset();
+  input.model = model.transform;
+  return select(camera, viewport_size, input, region, operation);
+}
+
+bool RegionSelector::selectInstances(const CameraInterface *camera, const hermes::size2 &viewport_size,
+                                     const InstanceSet &instances, const hermes::Transform &transform,
+                                     const Region &region, Operation operation,
+                                     const std::string &transform_attribute) {
+  const auto &attributes = instances.instanceAttributes();
+  if (!instances.instanceBuffer().allocated() || !attributes.contains(transform_attribute))
+    return false;
+  Input input;
+  input.source = Source::instances;
+  input.element_count = instances.count();
+  input.data_buffer = instances.instanceBuffer().id();
+  // the translation is the last column of the (column major) matrix
+  input.data_offset = attributes.attributeOffset(attributes.attributeIndex(transform_attribute)) +
+      12 * sizeof(f32);
+  input.data_stride = attributes.stride();
+  input.model = transform;
+  return select(camera, viewport_size, input, region, operation);
+}
+
+bool RegionSelector::select(const CameraInterface *camera, const hermes::size2 &viewport_size,
+                            const Input &input, const Region &region, Operation operation) {
+  if (!program_.good()) {
+    program_.attach(Shader(GL_COMPUTE_SHADER, region_select_cs));
+    if (!program_.link()) {
+      HERMES_LOG_ERROR("failed to compile region selection shader: {}", program_.err);
+      return false;
+    }
+  }
+  if (input.data_offset % sizeof(f32) || input.data_stride % sizeof(f32) || input.index_offset % sizeof(u32)) {
+    HERMES_LOG_WARNING("region selection requires 4 byte aligned element data.");
+    return false;
+  }
+  // a new element set starts with an empty selection
+  if (input.element_count != element_count_) {
+    element_count_ = input.element_count;
+    mask_.reserve(std::max<u64>(1, (element_count_ + 31) / 32) * sizeof(u32));
+    indices_.reserve(std::max<u64>(1, element_count_) * sizeof(u32));
+    mask_.bind();
+    glClearBufferData(GL_SHADER_STORAGE_BUFFER, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+  } else if (operation == Operation::replace) {
+    mask_.bind();
+    glClearBufferData(GL_SHADER_STORAGE_BUFFER, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+  }
+  u32 command[4] = {0, 1, 0, 0};
+  command_.reserve(sizeof(command));
+  command_.copy(command, sizeof(command));
+  if (!element_count_)
+    return true;
+  if (region.type_ == Region::Type::lasso) {
+    std::vector<f32> polygon;
+    polygon.reserve(2 * region.polygon_.size());
+    for (const auto &p : region.polygon_)
+      polygon.insert(polygon.end(), {p.x, p.y});
+    polygon_.reserve(std::max<u64>(1, polygon.size()) * sizeof(f32));
+    if (!polygon.empty())
+      polygon_.copy(polygon.data(), polygon.size() * sizeof(f32));
+  } else
+    polygon_.reserve(2 * sizeof(f32));
+  program_.use();
+  program_.setUniform("source", static_cast<int>(input.source));
+  glUniform1ui(glGetUniformLocation(program_.id(), "element_count"), static_cast<GLuint>(element_count_));
+  glUniform1ui(glGetUniformLocation(program_.id(), "data_offset"), static_cast<GLuint>(input.data_offset / sizeof(f32)));
+  glUniform1ui(glGetUniformLocation(program_.id(), "data_stride"), static_cast<GLuint>(input.data_stride / sizeof(f32)));
+  glUniform1ui(glGetUniformLocation(program_.id(), "index_offset"), static_cast<GLuint>(input.index_offset / sizeof(u32)));
+  program_.setUniform("projection", camera->getProjectionTransform());
+  program_.setUniform("view", camera->getViewTransform());
+  program_.setUniform("model", input.model);
+  program_.setUniform("viewport_size", hermes::vec2(viewport_size.width, viewport_size.height));
+  program_.setUniform("region_type", static_cast<int>(region.type_));
+  program_.setUniform("region_min", hermes::vec2(region.a_.x, region.a_.y));
+  program_.setUniform("region_max", hermes::vec2(region.b_.x, region.b_.y));
+  program_.setUniform("brush_center", hermes::vec2((region.a_.x + region.b_.x) * 0.5f,
+                                                   (region.a_.y + region.b_.y) * 0.5f));
+  program_.setUniform("brush_radius", region.radius_);
+  program_.setUniform("polygon_size", static_cast<int>(region.polygon_.size()));
+  program_.setUniform("subtract", operation == Operation::subtract ? 1 : 0);
+  program_.setUniform("depth_test", depth_texture ? 1 : 0);
+  program_.setUniform("depth_bias", depth_bias);
+  program_.setUniform("depth_map", 0);
+  if (depth_texture)
+    depth_texture->bind(GL_TEXTURE0);
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, input.data_buffer);
+  // triangles are the only source that reads indices, bind anything otherwise
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, input.index_buffer ? input.index_buffer : input.data_buffer);
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, polygon_.id());
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, mask_.id());
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 4, indices_.id());
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 5, command_.id());
+  auto group_count = static_cast<GLuint>((element_count_ + 255) / 256);
+  program_.setUniform("stage", 0);
+  glDispatchCompute(group_count, 1, 1);
+  glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+  program_.setUniform("stage", 1);
+  glDispatchCompute(group_count, 1, 1);
+  glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_COMMAND_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT);
+  CHECK_GL_ERRORS;
+  return true;
+}
+
+void RegionSelector::clear() {
+  if (mask_.allocated()) {
+    mask_.bind();
+    glClearBufferData(GL_SHADER_STORAGE_BUFFER, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+  }
+  u32 command[4] = {0, 1, 0, 0};
+  command_.reserve(sizeof(command));
+  command_.copy(command, sizeof(command));
+  CHECK_GL_ERRORS;
+}
+
+void RegionSelector::bindMask(GLuint binding) const {
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, mask_.id());
+}
+
+void RegionSelector::bindIndices(GLuint binding) const {
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, indices_.id());
+}
+
+u32 RegionSelector::selectedCount() {
+  if (!command_.allocated())
+    return 0;
+  auto data = command_.rawData(0, sizeof(u32));
+  return *reinterpret_cast<const u32 *>(data.data());
+}
+
+const DeviceMemory &RegionSelector::selectionMask() const {
+  return mask_;
+}
+
+const DeviceMemory &RegionSelector::selectedIndices() const {
+  return indices_;
+}
+
+const DeviceMemory &RegionSelector::drawCommand() const {
+  return command_;
+}
+
+u64 RegionSelector::elementCount() const {
+  return element_count_;
+}
+
+}
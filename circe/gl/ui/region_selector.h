@@ -0,0 +1,204 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file region_selector.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+
+#ifndef CIRCE_CIRCE_GL_UI_REGION_SELECTOR_H
+#define CIRCE_CIRCE_GL_UI_REGION_SELECTOR_H
+
+#include <circe/gl/graphics/shader.h>
+#include <circe/gl/scene/instance_set.h>
+#include <circe/gl/scene/scene_model.h>
+#include <circe/gl/texture/texture.h>
+#include <circe/scene/camera_interface.h>
+
+namespace circe::gl {
+
+/// Selects all vertices, primitives or instances that project into a screen
+/// region (rectangle, lasso polygon or brush).
+/// Selection runs entirely on the GPU: a compute pass projects every element
+/// with the camera, optionally discards occluded elements by comparing its
+/// depth against a depth texture, and updates a selection bitmask (one bit per
+/// element). A second pass compacts the selected element indices into a list
+/// and writes its size into a glDrawArraysIndirect command, so the result can
+/// be drawn or used as a highlight mask without reading anything back.
+/// Storage buffer bindings used by the selection passes: 0 to 5.
+/// \code{.cpp}
+///     RegionSelector selector;
+///     selector.selectVertices(camera, viewport_size, model,
+///                             RegionSelector::Region::rectangle(a, b));
+///     // highlight: RegionSelector::glsl() declarations
+///     program.use();
+///     selector.bindMask();
+///     //  if (isSelected(gl_VertexID)) ...
+///     // draw selected vertices only (selected_index[gl_VertexID])
+///     selector.bindIndices(binding);
+///     glBindBuffer(GL_DRAW_INDIRECT_BUFFER, selector.drawCommand().id());
+///     glDrawArraysIndirect(GL_POINTS, nullptr);
+/// \endcode
+/// \note Primitives are tested by their centroid, instances by their
+/// translation. The index list is not sorted.
+class RegionSelector {
+public:
+  /// How a new region combines with the current selection
+  enum class Operation {
+    replace,
+    add,
+    subtract
+  };
+  /// Screen region, in pixels with origin at the bottom left corner
+  class Region {
+    friend class RegionSelector;
+  public:
+    /// \param a corner
+    /// \param b opposite corner
+    static Region rectangle(const hermes::point2 &a, const hermes::point2 &b);
+    /// \param polygon lasso points (closed implicitly, even-odd rule)
+    static Region lasso(const std::vector<hermes::point2> &polygon);
+    /// \param center
+    /// \param radius in pixels
+    static Region brush(const hermes::point2 &center, f32 radius);
+  private:
+    enum class Type {
+      rectangle = 0,
+      lasso = 1,
+      brush = 2
+    };
+    Type type_{Type::rectangle};
+    hermes::point2 a_, b_;
+    f32 radius_{0};
+    std::vector<hermes::point2> polygon_;
+  };
+  // ***********************************************************************
+  //                           STATIC METHODS
+  // ***********************************************************************
+  /// \param binding selection mask storage buffer binding
+  /// \return glsl declarations of the selection mask and bool isSelected(uint)
+  static std::string glsl(GLuint binding = 6);
+  // ***********************************************************************
+  //                           CONSTRUCTORS
+  // ***********************************************************************
+  RegionSelector();
+  ~RegionSelector();
+  // ***********************************************************************
+  //                           METHODS
+  // ***********************************************************************
+  /// Selects model vertices
+  /// \param camera
+  /// \param viewport_size viewport size in pixels
+  /// \param model (its transform is used)
+  /// \param region
+  /// \param operation
+  /// \return false if the selection pass could not run
+  bool selectVertices(const CameraInterface *camera, const hermes::size2 &viewport_size,
+                      const SceneModel &model, const Region &region,
+                      Operation operation = Operation::replace);
+  /// Selects model triangles
+  /// \note the model must use an unsigned int index buffer
+  /// \param camera
+  /// \param viewport_size viewport size in pixels
+  /// \param model (its transform is used)
+  /// \param region
+  /// \param operation
+  /// \return false if the selection pass could not run
+  bool selectPrimitives(const CameraInterface *camera, const hermes::size2 &viewport_size,
+                        const SceneModel &model, const Region &region,
+                        Operation operation = Operation::replace);
+  /// Selects instances by the translation of their transform attribute
+  /// \param camera
+  /// \param viewport_size viewport size in pixels
+  /// \param instances
+  /// \param transform transform used to draw the instance set
+  /// \param region
+  /// \param operation
+  /// \param transform_attribute name of the mat4 instance attribute
+  /// \return false if the selection pass could not run
+  bool selectInstances(const CameraInterface *camera, const hermes::size2 &viewport_size,
+                       const InstanceSet &instances, const hermes::Transform &transform,
+                       const Region &region, Operation operation = Operation::replace,
+                       const std::string &transform_attribute = "transform_matrix");
+  /// Clears the selection
+  void clear();
+  /// Binds the selection mask
+  /// \param binding
+  void bindMask(GLuint binding = 6) const;
+  /// Binds the compacted list of selected indices
+  /// \param binding
+  void bindIndices(GLuint binding) const;
+  /// Reads back the number of selected elements
+  /// \note This waits for the selection passes
+  /// \return
+  [[nodiscard]] u32 selectedCount();
+  // ***********************************************************************
+  //                           FIELDS
+  // ***********************************************************************
+  /// \return one bit per element (uint words)
+  [[nodiscard]] const DeviceMemory &selectionMask() const;
+  /// \return selected element indices (the first selectedCount() entries)
+  [[nodiscard]] const DeviceMemory &selectedIndices() const;
+  /// \return DrawArraysIndirectCommand {selected count, 1, 0, 0}
+  [[nodiscard]] const DeviceMemory &drawCommand() const;
+  /// \return number of elements of the last selection
+  [[nodiscard]] u64 elementCount() const;
+  // ***********************************************************************
+  //                          PUBLIC FIELDS
+  // ***********************************************************************
+  /// (optional) window depth of the scene, same size as the viewport. When
+  /// set, elements behind the stored depth are not selected
+  const Texture *depth_texture{nullptr};
+  f32 depth_bias{1e-4f}; //!< window depth tolerance of the occlusion test
+
+private:
+  enum class Source {
+    points = 0,
+    instances = 1,
+    triangles = 2
+  };
+  struct Input {
+    Source source{Source::points};
+    u64 element_count{0};
+    GLuint data_buffer{0};
+    u64 data_offset{0};  //!< bytes
+    u64 data_stride{0};  //!< bytes
+    GLuint index_buffer{0};
+    u64 index_offset{0}; //!< bytes
+    hermes::Transform model;
+  };
+
+  bool select(const CameraInterface *camera, const hermes::size2 &viewport_size,
+              const Input &input, const Region &region, Operation operation);
+
+  Program program_;
+  DeviceMemory mask_;
+  DeviceMemory indices_;
+  DeviceMemory command_;
+  DeviceMemory polygon_;
+  u64 element_count_{0};
+};
+
+}
+
+#endif //CIRCE_CIRCE_GL_UI_REGION_SELECTOR_H
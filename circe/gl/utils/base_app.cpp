@@ -30,12 +30,14 @@
 #include <circe/gl/imgui/imgui_impl_glfw.h>
 #include <circe/gl/imgui/imgui_impl_opengl3.h>
 #include <circe/gl/scene/scene_resource_manager.h>
+#include <algorithm>
 
 namespace circe::gl {
 
 using namespace circe::gl;
 
 BaseApp::~BaseApp() {
+  stopSimulation();
   // Cleanup
   ImGui_ImplOpenGL3_Shutdown();
   ImGui_ImplGlfw_Shutdown();
@@ -88,6 +90,14 @@ void BaseApp::prepareFrame() {
 void BaseApp::startFrame() {
   // start frame time
   t_start = std::chrono::high_resolution_clock::now();
+  render_pacing_.tick(clock::now());
+  if (simulation_mode_ == SimulationMode::serial)
+    simulationStep(simulation_step_ > 0 ? simulation_step_ : render_pacing_.stats.last_ms / 1000.0);
+  if (simulation_mode_ != SimulationMode::none) {
+    bool contiguous = false;
+    if (const auto *snapshot = snapshots_.acquire(contiguous))
+      applySnapshot(*snapshot, contiguous);
+  }
   prepareFrame();
 }
 
@@ -118,11 +128,108 @@ void BaseApp::nextFrame(circe::CameraInterface *camera) {
 
 int BaseApp::run() {
   init();
-  return app->run();
+  if (simulation_mode_ == SimulationMode::threaded) {
+    simulation_running_ = true;
+    simulation_thread_ = std::thread([this]() { simulationLoop(); });
+  }
+  int result = app->run();
+  // derived objects must not be touched by update() after run returns
+  stopSimulation();
+  return result;
 }
 
 void BaseApp::render(circe::CameraInterface *camera) {
 
 }
 
+void BaseApp::setSimulationMode(SimulationMode mode, f64 step_seconds) {
+  HERMES_ASSERT(!simulation_thread_.joinable());
+  simulation_mode_ = mode;
+  simulation_step_ = std::max(0.0, step_seconds);
+}
+
+void BaseApp::update(SceneSnapshot &snapshot, f64 dt) {
+  HERMES_UNUSED_VARIABLE(snapshot);
+  HERMES_UNUSED_VARIABLE(dt);
+}
+
+void BaseApp::applySnapshot(const SceneSnapshot &snapshot, bool contiguous) {
+  HERMES_UNUSED_VARIABLE(snapshot);
+  HERMES_UNUSED_VARIABLE(contiguous);
+}
+
+BaseApp::PacingStats BaseApp::renderStats() const {
+  return render_pacing_.stats;
+}
+
+BaseApp::PacingStats BaseApp::simulationStats() const {
+  std::lock_guard<std::mutex> lock(pacing_mutex_);
+  return simulation_pacing_.stats;
+}
+
+u64 BaseApp::skippedSnapshotCount() const {
+  return snapshots_.skippedCount();
+}
+
+void BaseApp::simulationStep(f64 dt) {
+  {
+    std::lock_guard<std::mutex> lock(pacing_mutex_);
+    simulation_pacing_.tick(clock::now());
+  }
+  auto &snapshot = snapshots_.beginWrite();
+  snapshot.time += dt;
+  update(snapshot, dt);
+  snapshots_.publish();
+}
+
+void BaseApp::simulationLoop() {
+  const auto step = std::chrono::duration_cast<clock::duration>(std::chrono::duration<f64>(simulation_step_));
+  auto last = clock::now();
+  auto next = last;
+  while (simulation_running_) {
+    auto now = clock::now();
+    f64 dt = simulation_step_ > 0 ? simulation_step_ : std::chrono::duration<f64>(now - last).count();
+    last = now;
+    simulationStep(dt);
+    // on demand rendering must wake up for the new snapshot
+    App::requestRedraw();
+    if (simulation_step_ > 0) {
+      next += step;
+      now = clock::now();
+      // when a step takes longer than its period, do not try to catch up
+      if (next + step < now)
+        next = now;
+      else
+        std::this_thread::sleep_until(next);
+    }
+  }
+}
+
+void BaseApp::stopSimulation() {
+  simulation_running_ = false;
+  if (simulation_thread_.joinable())
+    simulation_thread_.join();
+}
+
+void BaseApp::PacingCounter::tick(clock::time_point now) {
+  if (last_tick == clock::time_point{}) {
+    window_start = now;
+  } else {
+    f64 ms = std::chrono::duration<f64, std::milli>(now - last_tick).count();
+    stats.last_ms = ms;
+    stats.average_ms = stats.average_ms > 0 ? 0.9 * stats.average_ms + 0.1 * ms : ms;
+    window_max_ms = std::max(window_max_ms, ms);
+    window_count++;
+  }
+  last_tick = now;
+  f64 window = std::chrono::duration<f64>(now - window_start).count();
+  if (window >= 1.0) {
+    stats.rate = window_count / window;
+    stats.max_ms = window_max_ms;
+    window_max_ms = 0;
+    window_count = 0;
+    window_start = now;
+  }
+}
+
 } // circe::gl namespace
\ No newline at end of file
@@ -29,12 +29,29 @@
 #define CIRCE_UTILS_BASE_APP_H
 
 #include <circe/gl/ui/scene_app.h>
+#include <circe/gl/utils/scene_snapshot.h>
+#include <atomic>
 #include <chrono>
+#include <mutex>
+#include <thread>
 
 namespace circe::gl {
 
 class BaseApp {
 public:
+  /// Where update() runs
+  enum class SimulationMode {
+    none,     //!< update() is never called
+    serial,   //!< once per frame, on the render thread, before prepareFrame
+    threaded  //!< continuously, on a dedicated simulation thread
+  };
+  /// Frame pacing statistics of a thread
+  struct PacingStats {
+    f64 last_ms{0};    //!< period of the last frame (step)
+    f64 average_ms{0}; //!< exponential moving average of the period
+    f64 max_ms{0};     //!< largest period in the last full second
+    f64 rate{0};       //!< frames (steps) per second in the last full second
+  };
   template<typename... Args>
   explicit BaseApp(Args &&... args) {
     app = std::make_unique<circe::gl::App>(std::forward<Args>(args)...);
@@ -51,6 +68,36 @@ public:
   virtual void render(circe::CameraInterface *camera);
   virtual void finishFrame();
   int run();
+  // simulation
+  /// Selects where update() runs (must be called before run()).
+  /// In threaded mode, the simulation thread writes each step into a scene
+  /// snapshot taken from a triple-buffered mailbox, and the render thread
+  /// receives the latest one through applySnapshot() at the start of its
+  /// frame. Neither thread ever waits for the other: a slow simulation does
+  /// not lower the render frame rate, and snapshots published while the
+  /// render thread was busy are skipped.
+  /// \note In threaded mode update() must not touch OpenGL or ImGui, and
+  /// the render thread should only read scene state from snapshots.
+  /// \param mode
+  /// \param step_seconds fixed simulation step (0 = steps run back to back
+  /// with the measured elapsed time as dt, or once per frame in serial mode)
+  void setSimulationMode(SimulationMode mode, f64 step_seconds = 0);
+  /// Simulation step
+  /// \param snapshot holds the state of the previous step (transforms and
+  /// buffers), only changed ranges need to be written
+  /// \param dt step duration (seconds)
+  virtual void update(SceneSnapshot &snapshot, f64 dt);
+  /// Receives the latest snapshot (render thread)
+  /// \param snapshot
+  /// \param contiguous true if the snapshot directly follows the previously
+  /// applied one, so uploading its changed ranges is enough
+  virtual void applySnapshot(const SceneSnapshot &snapshot, bool contiguous);
+  /// \return render thread frame pacing
+  [[nodiscard]] PacingStats renderStats() const;
+  /// \return simulation frame pacing
+  [[nodiscard]] PacingStats simulationStats() const;
+  /// \return number of snapshots never applied by the render thread
+  [[nodiscard]] u64 skippedSnapshotCount() const;
 
   ///  Last frame time measured using a high performance timer (if available)
   float frame_timer = 1.0f;
@@ -66,6 +113,31 @@ protected:
   uint32_t frame_counter_ = 0;
   uint32_t last_FPS_ = 0;
   std::chrono::time_point<std::chrono::high_resolution_clock> last_timestamp_;
+
+private:
+  using clock = std::chrono::steady_clock;
+  /// Accumulates frame periods into PacingStats
+  struct PacingCounter {
+    void tick(clock::time_point now);
+    PacingStats stats;
+    clock::time_point last_tick{};
+    clock::time_point window_start{};
+    f64 window_max_ms{0};
+    u32 window_count{0};
+  };
+
+  void simulationStep(f64 dt);
+  void simulationLoop();
+  void stopSimulation();
+
+  SimulationMode simulation_mode_{SimulationMode::none};
+  f64 simulation_step_{0};
+  SnapshotMailbox snapshots_;
+  std::thread simulation_thread_;
+  std::atomic<bool> simulation_running_{false};
+  PacingCounter render_pacing_;
+  PacingCounter simulation_pacing_; //!< guarded by pacing_mutex_ in threaded mode
+  mutable std::mutex pacing_mutex_;
 };
 
 } // circe namespace
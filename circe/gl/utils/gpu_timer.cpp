@@ -0,0 +1,152 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file gpu_timer.cpp
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+
+#include <circe/gl/utils/gpu_timer.h>
+#include <hermes/common/debug.h>
+#include <algorithm>
+
+namespace circe::gl {
+
+GpuTimer::Scope::Scope(GpuTimer &timer, const std::string &name, u32 color) : timer_(timer) {
+  scope_id_ = timer_.beginScope(name, color);
+}
+
+GpuTimer::Scope::~Scope() {
+  timer_.endScope(scope_id_);
+}
+
+GpuTimer::GpuTimer(u32 latency, u32 max_scopes_per_frame)
+    : max_scopes_per_frame_(max_scopes_per_frame), frames_(std::max(1u, latency)) {}
+
+GpuTimer::~GpuTimer() {
+  for (auto &frame : frames_)
+    if (!frame.queries.empty())
+      glDeleteQueries(frame.queries.size(), frame.queries.data());
+}
+
+void GpuTimer::newFrame() {
+  if (started_)
+    frame_++;
+  started_ = true;
+  auto &frame = frames_[frame_ % frames_.size()];
+  resolve(frame);
+  frame.scopes.clear();
+  frame.depth = 0;
+  // both clocks are sampled together, gpu timestamps of this frame are placed
+  // relative to this point of the cpu timeline
+  frame.cpu_anchor = hermes::profiler::now();
+  glGetInteger64v(GL_TIMESTAMP, &frame.gpu_anchor);
+}
+
+u32 GpuTimer::beginScope(const std::string &name, u32 color) {
+  if (!started_)
+    return max_scopes_per_frame_;
+  auto &frame = frames_[frame_ % frames_.size()];
+  if (frame.scopes.size() >= max_scopes_per_frame_) {
+    HERMES_LOG_WARNING("gpu timer: too many scopes in a single frame.");
+    return max_scopes_per_frame_;
+  }
+  u32 id = frame.scopes.size();
+  if (frame.queries.size() < 2 * (id + 1)) {
+    frame.queries.resize(2 * (id + 1));
+    glGenQueries(2, &frame.queries[2 * id]);
+  }
+  frame.scopes.push_back({name, color, frame.depth++, false});
+  glQueryCounter(frame.queries[2 * id], GL_TIMESTAMP);
+  frame.last_query = frame.queries[2 * id];
+  return id;
+}
+
+void GpuTimer::endScope(u32 scope_id) {
+  auto &frame = frames_[frame_ % frames_.size()];
+  if (scope_id >= frame.scopes.size())
+    return;
+  frame.scopes[scope_id].closed = true;
+  frame.depth--;
+  glQueryCounter(frame.queries[2 * scope_id + 1], GL_TIMESTAMP);
+  frame.last_query = frame.queries[2 * scope_id + 1];
+}
+
+void GpuTimer::resolve(FrameQueries &frame) {
+  if (frame.scopes.empty() || !frame.cpu_anchor)
+    return;
+  // queries complete in order, the last one tells if the frame is done
+  GLint available = 0;
+  glGetQueryObjectiv(frame.last_query, GL_QUERY_RESULT_AVAILABLE, &available);
+  if (!available) {
+    dropped_frame_count_++;
+    return;
+  }
+  auto to_ticks = [&](GLuint64 timestamp) -> u64 {
+    auto anchor = static_cast<GLuint64>(frame.gpu_anchor);
+    return frame.cpu_anchor + hermes::profiler::ns2ticks(timestamp > anchor ? timestamp - anchor : 0);
+  };
+  std::map<std::string, f64> frame_totals;
+  for (u32 i = 0; i < frame.scopes.size(); ++i) {
+    const auto &scope = frame.scopes[i];
+    if (!scope.closed)
+      continue;
+    GLuint64 begin = 0, end = 0;
+    glGetQueryObjectui64v(frame.queries[2 * i], GL_QUERY_RESULT, &begin);
+    glGetQueryObjectui64v(frame.queries[2 * i + 1], GL_QUERY_RESULT, &end);
+    blocks_.push_back({scope.name, to_ticks(begin), to_ticks(end), scope.level, scope.color});
+    frame_totals[scope.name] += end > begin ? static_cast<f64>(end - begin) * 1e-6 : 0.0;
+  }
+  for (const auto &total : frame_totals) {
+    auto it = averages_.find(total.first);
+    if (it == averages_.end())
+      averages_[total.first] = total.second;
+    else
+      it->second += smoothing * (total.second - it->second);
+  }
+  while (blocks_.size() > max_block_count_)
+    blocks_.pop_front();
+}
+
+void GpuTimer::iterateBlocks(const std::function<void(const HProfiler::TrackBlock &)> &f) const {
+  for (const auto &block : blocks_)
+    f(block);
+}
+
+void GpuTimer::setMaxBlockCount(size_t max_block_count) {
+  max_block_count_ = max_block_count;
+}
+
+const std::deque<HProfiler::TrackBlock> &GpuTimer::blocks() const {
+  return blocks_;
+}
+
+const std::map<std::string, f64> &GpuTimer::averages() const {
+  return averages_;
+}
+
+u64 GpuTimer::droppedFrameCount() const {
+  return dropped_frame_count_;
+}
+
+}
@@ -0,0 +1,161 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file gpu_timer.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+
+#ifndef CIRCE_CIRCE_GL_UTILS_GPU_TIMER_H
+#define CIRCE_CIRCE_GL_UTILS_GPU_TIMER_H
+
+#include <circe/gl/utils/open_gl.h>
+#include <circe/ui/imgui_profiler.h>
+#include <deque>
+#include <map>
+
+namespace circe::gl {
+
+/// Measures GPU execution time of OpenGL commands with timestamp queries.
+/// Each frame writes its queries into one slot of a ring of latency frame
+/// slots. A slot is only read when newFrame() is about to reuse it, latency
+/// frames later, and only if its results are already available, so
+/// glGetQueryObject never stalls (late frames are dropped instead).
+/// newFrame() also samples the CPU clock and the GPU clock (GL_TIMESTAMP)
+/// together, so resolved blocks are placed on the hermes::profiler timeline
+/// at the CPU frame they belong to and can be shown as an HProfiler track:
+/// \code{.cpp}
+///     GpuTimer gpu_timer;
+///     profiler_view.addTrack("GPU", [&](const auto &f) { gpu_timer.iterateBlocks(f); });
+///     // every frame
+///     gpu_timer.newFrame();
+///     {
+///       // cpu block + gpu block
+///       CIRCE_GL_PROFILE_SCOPE(gpu_timer, "shadows", color);
+///       ...
+///     }
+///     for (const auto &average : gpu_timer.averages())
+///       ImGui::Text("%s %.3f ms", average.first.c_str(), average.second);
+/// \endcode
+class GpuTimer {
+public:
+  /// RAII helper that writes the begin/end timestamps of a region
+  class Scope {
+  public:
+    Scope(GpuTimer &timer, const std::string &name, u32 color);
+    ~Scope();
+  private:
+    GpuTimer &timer_;
+    u32 scope_id_;
+  };
+  // ***********************************************************************
+  //                           CONSTRUCTORS
+  // ***********************************************************************
+  /// \param latency number of frame slots (frames until results are read)
+  /// \param max_scopes_per_frame maximum number of regions per frame
+  explicit GpuTimer(u32 latency = 4, u32 max_scopes_per_frame = 64);
+  GpuTimer(const GpuTimer &other) = delete;
+  ~GpuTimer();
+  // ***********************************************************************
+  //                           OPERATORS
+  // ***********************************************************************
+  GpuTimer &operator=(const GpuTimer &other) = delete;
+  // ***********************************************************************
+  //                           METHODS
+  // ***********************************************************************
+  /// Starts a new frame: reads the results of the slot being reused and
+  /// anchors the new frame on the CPU timeline.
+  /// \note Call it once per frame, before any region of the frame.
+  void newFrame();
+  /// Writes the begin timestamp of a region
+  /// \param name region name
+  /// \param color region color (argb)
+  /// \return region id (used by endScope)
+  u32 beginScope(const std::string &name, u32 color);
+  /// Writes the end timestamp of a region
+  /// \param scope_id value returned by beginScope
+  void endScope(u32 scope_id);
+  /// Iterates over the resolved blocks (HProfiler::TrackSource compatible)
+  /// \param f
+  void iterateBlocks(const std::function<void(const HProfiler::TrackBlock &)> &f) const;
+  // ***********************************************************************
+  //                            FIELDS
+  // ***********************************************************************
+  /// \param max_block_count maximum number of resolved blocks kept
+  void setMaxBlockCount(size_t max_block_count);
+  /// \return resolved blocks, from oldest to newest
+  [[nodiscard]] const std::deque<HProfiler::TrackBlock> &blocks() const;
+  /// \return rolling average of the GPU time (ms) of each region name (regions
+  /// with the same name are summed per frame)
+  [[nodiscard]] const std::map<std::string, f64> &averages() const;
+  /// \return number of frames whose results were not ready when their slot
+  /// was reused
+  [[nodiscard]] u64 droppedFrameCount() const;
+  // ***********************************************************************
+  //                           PUBLIC FIELDS
+  // ***********************************************************************
+  f64 smoothing{0.05}; //!< weight of the newest frame in the rolling averages
+
+private:
+  struct ScopeInfo {
+    std::string name;
+    u32 color{0};
+    u32 level{0};
+    bool closed{false};
+  };
+  struct FrameQueries {
+    std::vector<GLuint> queries; //!< begin/end pairs, generated on demand
+    std::vector<ScopeInfo> scopes;
+    u32 depth{0};
+    GLuint last_query{0};        //!< last written query of the frame
+    u64 cpu_anchor{0};           //!< profiler ticks at newFrame
+    GLint64 gpu_anchor{0};       //!< GL_TIMESTAMP at newFrame
+  };
+
+  void resolve(FrameQueries &frame);
+
+  u32 max_scopes_per_frame_{0};
+  std::vector<FrameQueries> frames_;
+  u64 frame_{0};
+  bool started_{false};
+  std::deque<HProfiler::TrackBlock> blocks_;
+  size_t max_block_count_{200};
+  std::map<std::string, f64> averages_;
+  u64 dropped_frame_count_{0};
+};
+
+}
+
+#define CIRCE_GL_GPU_SCOPE_CONCAT_(A, B) A##B
+#define CIRCE_GL_GPU_SCOPE_CONCAT(A, B) CIRCE_GL_GPU_SCOPE_CONCAT_(A, B)
+/// Measures the GPU time of the GL commands issued until the end of the
+/// current C++ scope
+#define CIRCE_GL_GPU_SCOPE(TIMER, NAME, COLOR)                                                                        \
+  circe::gl::GpuTimer::Scope CIRCE_GL_GPU_SCOPE_CONCAT(circe_gl_gpu_scope_, __LINE__)(TIMER, NAME, COLOR)
+/// Measures both the CPU (HERMES_PROFILE_SCOPE) and the GPU time of the
+/// current C++ scope
+#define CIRCE_GL_PROFILE_SCOPE(TIMER, NAME, COLOR)                                                                    \
+  HERMES_PROFILE_SCOPE(NAME, COLOR);                                                                                  \
+  CIRCE_GL_GPU_SCOPE(TIMER, NAME, COLOR)
+
+#endif //CIRCE_CIRCE_GL_UTILS_GPU_TIMER_H
@@ -189,6 +189,17 @@ bool checkFramebuffer(const char *file, int line_number, const char *function) {
   return 0;
 }
 
+bool waitSync(GLsync fence, bool block) {
+  if (!block) {
+    GLenum result = glClientWaitSync(fence, 0, 0);
+    return result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED;
+  }
+  GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+  while (result == GL_TIMEOUT_EXPIRED)
+    result = glClientWaitSync(fence, 0, 1000000000);
+  return result != GL_WAIT_FAILED;
+}
+
 bool initGLEW() {
   /*glewExperimental = GL_TRUE;
   GLenum err = glewInit();
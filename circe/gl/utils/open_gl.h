@@ -422,6 +422,13 @@ std::string glErrorToString(GLenum error, bool description = true);
  */
 bool checkFramebuffer(const char *file, int line_number, const char *function = nullptr);
 
+/// Waits on a fence sync object. A blocking wait flushes the command stream
+/// first, so the fence is guaranteed to signal, and retries on timeout.
+/// \param fence sync object created by glFenceSync
+/// \param block false only polls the fence status
+/// \return true if the fence is signaled
+bool waitSync(GLsync fence, bool block = true);
+
 /* query
  * @major **[out]** receives major version
  * @minor **[out]** receives minor version
@@ -0,0 +1,147 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file scene_snapshot.cpp
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+
+#include <circe/gl/utils/scene_snapshot.h>
+#include <algorithm>
+#include <cstring>
+
+namespace circe::gl {
+
+void SceneSnapshot::resizeBuffer(u32 buffer, u64 size_in_bytes) {
+  if (buffer >= buffers.size())
+    buffers.resize(buffer + 1);
+  auto &b = buffers[buffer];
+  if (b.data.size() == size_in_bytes)
+    return;
+  b.data.resize(size_in_bytes);
+  b.dirty = {{0, size_in_bytes}};
+}
+
+void SceneSnapshot::write(u32 buffer, u64 offset, const void *data, u64 size) {
+  markDirty(buffer, offset, size);
+  std::memcpy(buffers[buffer].data.data() + offset, data, size);
+}
+
+void SceneSnapshot::markDirty(u32 buffer, u64 offset, u64 size) {
+  HERMES_ASSERT(buffer < buffers.size() && offset + size <= buffers[buffer].data.size());
+  if (!size)
+    return;
+  auto &dirty = buffers[buffer].dirty;
+  // merge with the last range when they touch, sequential writes are common
+  if (!dirty.empty()) {
+    auto &last = dirty.back();
+    if (offset <= last.offset + last.size && offset + size >= last.offset) {
+      u64 end = std::max(last.offset + last.size, offset + size);
+      last.offset = std::min(last.offset, offset);
+      last.size = end - last.offset;
+      return;
+    }
+  }
+  dirty.push_back({offset, size});
+}
+
+void SceneSnapshot::upload(u32 buffer, DeviceMemory &memory, bool only_dirty) const {
+  if (buffer >= buffers.size() || buffers[buffer].data.empty())
+    return;
+  const auto &b = buffers[buffer];
+  auto *data = const_cast<u8 *>(b.data.data());
+  if (!memory.allocated() || memory.size() != b.data.size()) {
+    memory.resize(b.data.size());
+    only_dirty = false;
+  }
+  if (!only_dirty) {
+    memory.copy(data, b.data.size());
+    return;
+  }
+  for (const auto &range : b.dirty)
+    memory.copy(data + range.offset, range.size, range.offset);
+}
+
+SceneSnapshot &SnapshotMailbox::beginWrite() {
+  auto &snapshot = snapshots_.back();
+  const auto *latest = snapshots_.lastPublished();
+  if (!latest) {
+    for (auto &buffer : snapshot.buffers)
+      buffer.dirty.clear();
+    snapshot.step = 1;
+    return snapshot;
+  }
+  snapshot.transforms = latest->transforms;
+  snapshot.buffers.resize(latest->buffers.size());
+  // the history covers every step after the one this snapshot was written in
+  bool incremental = snapshot.step && !history_.empty() && history_.front().step <= snapshot.step + 1;
+  for (size_t i = 0; i < snapshot.buffers.size(); ++i) {
+    auto &buffer = snapshot.buffers[i];
+    const auto &source = latest->buffers[i];
+    buffer.dirty.clear();
+    if (!incremental || buffer.data.size() != source.data.size()) {
+      buffer.data = source.data;
+      continue;
+    }
+    for (const auto &h : history_) {
+      if (h.step <= snapshot.step || i >= h.dirty.size())
+        continue;
+      for (const auto &range : h.dirty[i])
+        std::memcpy(buffer.data.data() + range.offset, source.data.data() + range.offset, range.size);
+    }
+  }
+  snapshot.time = latest->time;
+  snapshot.step = latest->step + 1;
+  return snapshot;
+}
+
+void SnapshotMailbox::publish() {
+  const auto &snapshot = snapshots_.back();
+  History h;
+  h.step = snapshot.step;
+  h.dirty.reserve(snapshot.buffers.size());
+  for (const auto &buffer : snapshot.buffers)
+    h.dirty.emplace_back(buffer.dirty);
+  history_.emplace_back(std::move(h));
+  while (history_.size() > max_history_size)
+    history_.pop_front();
+  snapshots_.publish();
+}
+
+const SceneSnapshot *SnapshotMailbox::acquire(bool &contiguous) {
+  contiguous = false;
+  if (!snapshots_.update())
+    return nullptr;
+  const auto &snapshot = snapshots_.front();
+  contiguous = acquired_step_ && snapshot.step == acquired_step_ + 1;
+  if (acquired_step_ && snapshot.step > acquired_step_ + 1)
+    skipped_count_ += snapshot.step - acquired_step_ - 1;
+  acquired_step_ = snapshot.step;
+  return &snapshot;
+}
+
+u64 SnapshotMailbox::skippedCount() const {
+  return skipped_count_;
+}
+
+}
@@ -0,0 +1,151 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file scene_snapshot.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+
+#ifndef CIRCE_CIRCE_GL_UTILS_SCENE_SNAPSHOT_H
+#define CIRCE_CIRCE_GL_UTILS_SCENE_SNAPSHOT_H
+
+#include <circe/common/triple_buffer.h>
+#include <circe/gl/storage/device_memory.h>
+#include <hermes/geometry/transform.h>
+#include <deque>
+#include <vector>
+
+namespace circe::gl {
+
+/// Immutable copy of the scene state produced by a simulation step.
+/// It holds object transforms and raw buffer data (instance data, vertex
+/// data, ...) together with the byte ranges of each buffer that changed in
+/// that step, so the render thread only uploads what changed.
+/// \code{.cpp}
+///     // simulation thread
+///     snapshot.transforms[0] = body_transform;
+///     auto *positions = snapshot.map<hermes::point3>(0, first, count);
+///     // render thread
+///     snapshot.upload(0, instance_memory, contiguous);
+/// \endcode
+class SceneSnapshot {
+public:
+  /// Byte range of a buffer
+  struct Range {
+    u64 offset{0};
+    u64 size{0};
+  };
+  /// Raw buffer data
+  struct Buffer {
+    std::vector<u8> data;
+    std::vector<Range> dirty; //!< ranges changed in this step
+  };
+  // ***********************************************************************
+  //                             METHODS
+  // ***********************************************************************
+  /// Resizes a buffer (creating it if necessary). A new size marks the whole
+  /// buffer as changed.
+  /// \param buffer buffer index
+  /// \param size_in_bytes
+  void resizeBuffer(u32 buffer, u64 size_in_bytes);
+  /// Copies data into a buffer region and marks it as changed
+  /// \param buffer buffer index (must exist)
+  /// \param offset in bytes
+  /// \param data
+  /// \param size in bytes
+  void write(u32 buffer, u64 offset, const void *data, u64 size);
+  /// Marks a buffer region as changed and gives write access to it
+  /// \tparam T element type
+  /// \param buffer buffer index (must exist)
+  /// \param first first element
+  /// \param count number of elements
+  /// \return pointer to the first element
+  template<typename T>
+  T *map(u32 buffer, u64 first, u64 count) {
+    markDirty(buffer, first * sizeof(T), count * sizeof(T));
+    return reinterpret_cast<T *>(buffers[buffer].data.data() + first * sizeof(T));
+  }
+  /// Marks a buffer region as changed
+  /// \param buffer buffer index (must exist)
+  /// \param offset in bytes
+  /// \param size in bytes
+  void markDirty(u32 buffer, u64 offset, u64 size);
+  /// Uploads a buffer to device memory (resizing it if needed)
+  /// \param buffer buffer index
+  /// \param memory destination
+  /// \param only_dirty upload only the changed ranges, valid when memory
+  /// already holds the data of the previous step
+  void upload(u32 buffer, DeviceMemory &memory, bool only_dirty) const;
+  // ***********************************************************************
+  //                          PUBLIC FIELDS
+  // ***********************************************************************
+  u64 step{0};   //!< simulation step that produced this snapshot
+  f64 time{0};   //!< simulation time (seconds)
+  std::vector<hermes::Transform> transforms;
+  std::vector<Buffer> buffers;
+};
+
+/// Triple-buffered mailbox of scene snapshots between a simulation thread
+/// (producer) and the render thread (consumer).
+/// Snapshot buffers are recycled, so before handing one to the producer,
+/// beginWrite brings it up to date with the last published snapshot by
+/// copying only the ranges changed since that buffer was last written (a full
+/// copy only happens when the buffer is too old).
+class SnapshotMailbox {
+public:
+  // ***********************************************************************
+  //                        PRODUCER METHODS
+  // ***********************************************************************
+  /// \return snapshot to be written, holding the last published state with
+  /// empty dirty lists and step = last published step + 1
+  SceneSnapshot &beginWrite();
+  /// Publishes the snapshot returned by beginWrite
+  void publish();
+  // ***********************************************************************
+  //                        CONSUMER METHODS
+  // ***********************************************************************
+  /// \param contiguous receives true if the returned snapshot directly
+  /// follows the previously acquired one (its dirty ranges are enough to
+  /// update resources built from the previous one)
+  /// \return latest snapshot if a new one was published, nullptr otherwise
+  const SceneSnapshot *acquire(bool &contiguous);
+  /// \return number of snapshots the consumer never saw
+  [[nodiscard]] u64 skippedCount() const;
+
+private:
+  /// dirty ranges of each buffer published at a given step
+  struct History {
+    u64 step{0};
+    std::vector<std::vector<SceneSnapshot::Range>> dirty;
+  };
+  static constexpr size_t max_history_size = 8;
+
+  TripleBuffer<SceneSnapshot> snapshots_;
+  std::deque<History> history_;     //!< producer side
+  u64 acquired_step_{0};            //!< consumer side
+  u64 skipped_count_{0};            //!< consumer side
+};
+
+}
+
+#endif //CIRCE_CIRCE_GL_UTILS_SCENE_SNAPSHOT_H
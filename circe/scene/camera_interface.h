@@ -31,10 +31,22 @@
 #include <hermes/geometry/plane.h>
 #include <hermes/geometry/frustum.h>
 
+#include <cstring>
 #include <utility>
 
 namespace circe {
 
+/// Exact comparison of transform matrices, used to detect camera changes
+/// between frames (any change, however small, invalidates cached results).
+/// \param a
+/// \param b
+/// \return true if both matrices are bitwise identical
+inline bool sameTransform(const hermes::Transform &a, const hermes::Transform &b) {
+  auto ma = a.matrix();
+  auto mb = b.matrix();
+  return std::memcmp(&ma[0][0], &mb[0][0], 16 * sizeof(ma[0][0])) == 0;
+}
+
 class CameraInterface {
 public:
   /// \param p projection type
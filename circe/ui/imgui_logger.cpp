@@ -27,10 +27,21 @@
 
 #include <circe/ui/imgui_logger.h>
 #include <circe/imgui/imgui.h>
+#include <cstdint>
+#include <cstring>
 
 namespace circe {
 
-HLogger::HLogger() {
+HLogger::HLogger() : HLogger(1024) {}
+
+HLogger::HLogger(size_t ring_capacity) {
+  size_t capacity = 1;
+  while (capacity < ring_capacity)
+    capacity <<= 1;
+  ring_.reset(new Record[capacity]);
+  ring_mask_ = capacity - 1;
+  for (size_t i = 0; i < capacity; ++i)
+    ring_[i].sequence.store(i, std::memory_order_relaxed);
   setMaxLogCount(10);
   // config hermes log
   hermes::Log::abbreviation_size = 5;
@@ -43,11 +54,19 @@ HLogger::HLogger() {
 }
 
 HLogger::~HLogger() {
-
+  hermes::Log::log_callback = nullptr;
 }
 
 void HLogger::render() {
-  ImGui::Combo("##log_combo", &current_mode_, "All\0Info\0Warn\0Error\0Critical\0");
+  drain();
+
+  if (ImGui::Combo("##log_combo", &current_mode_, "All\0Info\0Warn\0Error\0Critical\0"))
+    rebuildView();
+
+  if (u64 dropped = droppedCount()) {
+    ImGui::SameLine();
+    ImGui::TextDisabled("%lu dropped", static_cast<unsigned long>(dropped));
+  }
 
   ImGui::SameLine(ImGui::GetWindowContentRegionWidth() - 60);
 
@@ -59,52 +78,95 @@ void HLogger::render() {
 
   ImGui::BeginChild("Log", ImVec2(0, 150), true, ImGuiWindowFlags_HorizontalScrollbar);
 
-  size_t current_line = next_cache_index_ >= max_cache_size_ ? 0 : next_cache_index_;
-  do {
-    if (current_line >= logged_messages_count)
-      break;
-    auto options = cache_[current_line].options;
-    const auto &color = colorFrom(cache_[current_line].options);
-    const char *message = cache_[current_line].message.c_str();
-    current_line = (current_line + 1) % max_cache_size_;
-    // filter
-    if (current_mode_ == 1 && !HERMES_MASK_BIT(options, hermes::logging_options::info))
-      continue;
-    if (current_mode_ == 2 && !HERMES_MASK_BIT(options, hermes::logging_options::warn))
-      continue;
-    if (current_mode_ == 3 && !HERMES_MASK_BIT(options, hermes::logging_options::error))
-      continue;
-    if (current_mode_ == 4 && !HERMES_MASK_BIT(options, hermes::logging_options::critical))
-      continue;
-
-    ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(color.r, color.g, color.b, color.a));
-    ImGui::Text("%s", message);
-    ImGui::PopStyleColor(1);
-  } while (current_line != next_cache_index_);
+  // only visible lines are submitted
+  ImGuiListClipper clipper(static_cast<int>(view_.size()));
+  while (clipper.Step())
+    for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i) {
+      const auto &entry = history_[view_[i] - history_front_id_];
+      const auto &color = colorFrom(entry.options);
+      ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(color.r, color.g, color.b, color.a));
+      ImGui::TextUnformatted(entry.message.c_str());
+      ImGui::PopStyleColor(1);
+    }
 
   ImGui::EndChild();
 }
 
 void HLogger::setMaxLogCount(size_t max_log_count) {
-  max_cache_size_ = max_log_count;
-  cache_.resize(max_log_count);
+  max_log_count_ = max_log_count;
+  while (history_.size() > max_log_count_) {
+    history_.pop_front();
+    history_front_id_++;
+  }
+  while (!view_.empty() && view_.front() < history_front_id_)
+    view_.pop_front();
 }
 
 void HLogger::logMessage(const hermes::Str &m, hermes::logging_options options) {
   if (!enabled_)
     return;
-  if (cache_.empty())
-    return;
-  logged_messages_count++;
-  if (next_cache_index_ == cache_.size()) {
-    if (cache_.size() < max_cache_size_) {
-      cache_.push_back({m, options});
+  // claim a slot (bounded mpmc queue by D. Vyukov, used here with a single consumer)
+  u64 position = enqueue_position_.load(std::memory_order_relaxed);
+  Record *record = nullptr;
+  while (true) {
+    record = &ring_[position & ring_mask_];
+    u64 sequence = record->sequence.load(std::memory_order_acquire);
+    auto diff = static_cast<std::int64_t>(sequence - position);
+    if (diff == 0) {
+      if (enqueue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+        break;
+    } else if (diff < 0) {
+      // full: the consumer has not drained this slot yet
+      dropped_count_.fetch_add(1, std::memory_order_relaxed);
+      return;
     } else
-      next_cache_index_ = 0;
+      position = enqueue_position_.load(std::memory_order_relaxed);
+  }
+  const char *text = m.c_str();
+  size_t size = std::strlen(text);
+  if (size > record_text_size) {
+    size = record_text_size;
+    truncated_count_.fetch_add(1, std::memory_order_relaxed);
+  }
+  std::memcpy(record->text, text, size);
+  record->size = static_cast<u32>(size);
+  record->options = options;
+  // publish
+  record->sequence.store(position + 1, std::memory_order_release);
+}
+
+void HLogger::drain() {
+  // at most one lap, producers may keep publishing while we drain
+  for (size_t n = 0; n <= ring_mask_; ++n) {
+    Record &record = ring_[dequeue_position_ & ring_mask_];
+    if (record.sequence.load(std::memory_order_acquire) != dequeue_position_ + 1)
+      break;
+    u64 id = history_front_id_ + history_.size();
+    history_.push_back({std::string(record.text, record.size), record.options});
+    if (passesFilter(record.options))
+      view_.push_back(id);
+    // give the slot back to producers, for the next lap
+    record.sequence.store(dequeue_position_ + ring_mask_ + 1, std::memory_order_release);
+    dequeue_position_++;
+  }
+  setMaxLogCount(max_log_count_);
+}
+
+void HLogger::rebuildView() {
+  view_.clear();
+  for (size_t i = 0; i < history_.size(); ++i)
+    if (passesFilter(history_[i].options))
+      view_.push_back(history_front_id_ + i);
+}
+
+bool HLogger::passesFilter(const hermes::logging_options &options) const {
+  switch (current_mode_) {
+  case 1: return HERMES_MASK_BIT(options, hermes::logging_options::info);
+  case 2: return HERMES_MASK_BIT(options, hermes::logging_options::warn);
+  case 3: return HERMES_MASK_BIT(options, hermes::logging_options::error);
+  case 4: return HERMES_MASK_BIT(options, hermes::logging_options::critical);
+  default: return true;
   }
-  cache_[next_cache_index_].message = m;
-  cache_[next_cache_index_].options = options;
-  next_cache_index_ = (next_cache_index_ + 1) % max_cache_size_;
 }
 
 void HLogger::enable() {
@@ -115,6 +177,14 @@ void HLogger::disable() {
   enabled_ = false;
 }
 
+u64 HLogger::droppedCount() const {
+  return dropped_count_.load(std::memory_order_relaxed);
+}
+
+u64 HLogger::truncatedCount() const {
+  return truncated_count_.load(std::memory_order_relaxed);
+}
+
 const circe::Color &HLogger::colorFrom(const hermes::logging_options &options) const {
   if (HERMES_MASK_BIT(options, hermes::logging_options::info))
     return info_color;
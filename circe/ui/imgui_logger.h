@@ -30,28 +30,54 @@
 
 #include <hermes/logging/logging.h>
 #include <circe/colors/color.h>
+#include <atomic>
+#include <deque>
+#include <memory>
 
 namespace circe {
 
 // *********************************************************************************************************************
 //                                                                                                            HLogger
 // *********************************************************************************************************************
+/// ImGui log window fed by hermes::Log.
+/// Any thread may log: messages are copied into a lock-free bounded
+/// multi-producer single-consumer ring of preallocated fixed-size records
+/// (no allocation, no lock on the logging thread). Messages that do not fit
+/// a record are truncated, messages that find the ring full are dropped and
+/// counted. render() (UI thread) drains the ring into a bounded history and
+/// keeps the filtered view incrementally, so a frame only touches new
+/// messages plus the visible lines.
 class HLogger {
 public:
+  /// Maximum message length stored in a record (longer messages are truncated)
+  static constexpr size_t record_text_size = 256;
   // *******************************************************************************************************************
   //                                                                                                     CONSTRUCTORS
   // *******************************************************************************************************************
   HLogger();
+  /// \param ring_capacity number of records shared by producers (rounded up to a power of two)
+  explicit HLogger(size_t ring_capacity);
   ~HLogger();
+  HLogger(const HLogger &) = delete;
+  HLogger &operator=(const HLogger &) = delete;
   // *******************************************************************************************************************
   //                                                                                                          METHODS
   // *******************************************************************************************************************
+  /// \param max_log_count number of messages kept in the history
   void setMaxLogCount(size_t max_log_count);
+  /// \note thread-safe, never blocks
   void logMessage(const hermes::Str &m, hermes::logging_options options);
   void render();
   void enable();
   void disable();
   // *******************************************************************************************************************
+  //                                                                                                           FIELDS
+  // *******************************************************************************************************************
+  /// \return number of messages dropped because the ring was full
+  [[nodiscard]] u64 droppedCount() const;
+  /// \return number of messages truncated to record_text_size
+  [[nodiscard]] u64 truncatedCount() const;
+  // *******************************************************************************************************************
   //                                                                                                    PUBLIC FIELDS
   // *******************************************************************************************************************
 
@@ -62,17 +88,37 @@ public:
 
 private:
   [[nodiscard]] const circe::Color &colorFrom(const hermes::logging_options &options) const;
+  [[nodiscard]] bool passesFilter(const hermes::logging_options &options) const;
+  /// moves the records published by producers into the history
+  void drain();
+  /// rebuilds the filtered view from the history (filter changes only)
+  void rebuildView();
 
+  /// Ring slot, sequence tells which lap of the ring the slot belongs to
+  struct Record {
+    std::atomic<u64> sequence{0};
+    hermes::logging_options options{};
+    u32 size{0};
+    char text[record_text_size]{};
+  };
   struct LogMessage {
-    hermes::Str message;
+    std::string message;
     hermes::logging_options options;
   };
   int current_mode_{0};
-  bool enabled_{true};
-  size_t logged_messages_count{0};
-  size_t next_cache_index_{0};
-  size_t max_cache_size_{0};
-  std::vector<LogMessage> cache_;
+  std::atomic<bool> enabled_{true};
+  // ring
+  std::unique_ptr<Record[]> ring_;
+  size_t ring_mask_{0};
+  std::atomic<u64> enqueue_position_{0};
+  u64 dequeue_position_{0};
+  std::atomic<u64> dropped_count_{0};
+  std::atomic<u64> truncated_count_{0};
+  // history (ui thread)
+  size_t max_log_count_{0};
+  std::deque<LogMessage> history_;
+  u64 history_front_id_{0};   //!< id of history_.front()
+  std::deque<u64> view_;      //!< ids of the history messages passing the filter
 };
 
 }
@@ -27,6 +27,7 @@
 
 #include <circe/imgui/imgui.h>
 #include <circe/ui/imgui_profiler.h>
+#include <circe/ui/trace_capture.h>
 #include <hermes/common/debug.h>
 
 namespace circe {
@@ -128,6 +129,14 @@ void HProfiler::render() {
       current_window_size_ = 1;
   }
   ImGui::PopItemWidth();
+  if (capture_) {
+    ImGui::SameLine();
+    if (ImGui::Button("save trace"))
+      capture_->save(hermes::Path(capture_path_));
+    if (ImGui::IsItemHovered())
+      ImGui::SetTooltip("%zu events, %lu hitches", capture_->eventCount(),
+                        static_cast<unsigned long>(capture_->hitchCount()));
+  }
   ImGui::SameLine(ImGui::GetWindowContentRegionWidth() - 60);
 
   stop_profiler_ = false;
@@ -182,44 +191,63 @@ void HProfiler::render() {
   ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2(2.0f, 2.0f));
   ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0.0f, 2.0f));
 
+  // draws a block (begin/end given in ticks, end = 0 for open blocks)
+  auto draw_block = [&](const std::string &name, u32 argb_color, u64 begin, u64 end) -> bool {
+    u64 block_start = window_start < begin ? begin - window_start : 0;
+    u64 block_end = end ? end : window_end;
+    block_end = window_start < block_end ? block_end - window_start : 0;
+    u64 block_duration = block_end - block_start;
+    // intersect block
+    if ((end && end < window_start) || !block_duration)
+      return false;
+
+    f64 start_res = circe::ticks2res(block_start, resolution_);
+    f64 end_res = circe::ticks2res(block_end, resolution_);
+
+    ImGui::SetCursorPosX(start_res * ms2pixel);
+    ImGui::PushItemWidth(end_res * ms2pixel);
+    ImU32 color = ImColor(hermes::argb_colors::argb2rgba(argb_color));
+    ImGui::PushStyleColor(ImGuiCol_Button, color);
+    ImGui::PushStyleColor(ImGuiCol_ButtonHovered, color);
+    ImGui::PushStyleColor(ImGuiCol_ButtonActive, color);
+    hermes::Str s;
+    s.append(name, ' ', prettyTicks(block_end - block_start));
+    ImGui::Button(s.c_str(), ImVec2((end_res - start_res) * ms2pixel, 0.0f));
+    if (ImGui::IsItemHovered())
+      ImGui::SetTooltip("%s", s.c_str());
+    ImGui::SameLine();
+    ImGui::PopItemWidth();
+    ImGui::PopStyleColor(3);
+    return true;
+  };
+
   bool block_found = true;
   for (u32 level = 0; block_found; ++level) {
     block_found = false;
     hermes::profiler::Profiler::iterateBlocks([&](const hermes::profiler::Profiler::Block &block) {
       if (block.level == level) {
-        u64 block_start = window_start < block.begin() ? block.begin() - window_start : 0;
-        u64 block_end = block.end() ? block.end() : window_end;
-        block_end = window_start < block_end ? block_end - window_start : 0;
-        u64 block_duration = block_end - block_start;
-        // intersect block
-        if ((block.end() && block.end() < window_start) || !block_duration)
-          return;
-
-        f64 start = circe::ticks2res(block_start, resolution_);
-        f64 end = circe::ticks2res(block_end, resolution_);
-
         const auto &desc = hermes::profiler::Profiler::blockDescriptor(block);
-        ImGui::SetCursorPosX(start * ms2pixel);
-        ImGui::PushItemWidth(end * ms2pixel);
-        ImU32 color = ImColor(hermes::argb_colors::argb2rgba(desc.color));
-        ImGui::PushStyleColor(ImGuiCol_Button, color);
-        ImGui::PushStyleColor(ImGuiCol_ButtonHovered, color);
-        ImGui::PushStyleColor(ImGuiCol_ButtonActive, color);
-        hermes::Str s;
-        s.append(desc.name, ' ', prettyTicks(block_end - block_start));
-        ImGui::Button(s.c_str(), ImVec2((end - start) * ms2pixel, 0.0f));
-        if (ImGui::IsItemHovered())
-          ImGui::SetTooltip("%s", s.c_str());
-        ImGui::SameLine();
-        ImGui::PopItemWidth();
-        ImGui::PopStyleColor(3);
-
-        block_found = true;
+        if (draw_block(desc.name, desc.color, block.begin(), block.end()))
+          block_found = true;
       }
     });
     ImGui::NewLine();
   }
 
+  // extra tracks (ex: gpu timers)
+  for (const auto &track : tracks_) {
+    ImGui::TextDisabled("%s", track.name.c_str());
+    block_found = true;
+    for (u32 level = 0; block_found; ++level) {
+      block_found = false;
+      track.source([&](const TrackBlock &block) {
+        if (block.level == level && draw_block(block.name, block.color, block.begin, block.end))
+          block_found = true;
+      });
+      ImGui::NewLine();
+    }
+  }
+
   ImGui::PopStyleVar(3);
 
   ImGui::EndChild();
@@ -230,6 +258,8 @@ void HProfiler::render() {
 }
 
 void HProfiler::update() {
+  if (capture_)
+    capture_->newFrame();
   if (stop_profiler_) {
     HERMES_DISABLE_PROFILER
     if (!current_time)
@@ -241,6 +271,15 @@ void HProfiler::update() {
   }
 }
 
+void HProfiler::addTrack(const std::string &name, TrackSource source) {
+  tracks_.push_back({name, std::move(source)});
+}
+
+void HProfiler::setCapture(TraceCapture *capture, const std::string &path) {
+  capture_ = capture;
+  capture_path_ = path;
+}
+
 void HProfiler::setTimeWindow(u64 window_size, Resolution window_resolution) {
   switch (window_resolution) {
   case HProfiler::Resolution::TICKS:window_size_ = window_size;
@@ -29,9 +29,14 @@
 #define CIRCE_CIRCE_IMGUI_IMGUI_PROFILER_H
 
 #include <hermes/common/profiler.h>
+#include <functional>
+#include <string>
+#include <vector>
 
 namespace circe {
 
+class TraceCapture;
+
 // *********************************************************************************************************************
 //                                                                                                      HProfiler
 // *********************************************************************************************************************
@@ -44,6 +49,18 @@ public:
     MILLISECONDS = 3,
     SECONDS = 4
   };
+  /// Block measured outside hermes::profiler (ex: GPU timer queries). Times are
+  /// given in hermes::profiler ticks, so they share the CPU timeline.
+  struct TrackBlock {
+    std::string name;
+    u64 begin{0};
+    u64 end{0};
+    u32 level{0};
+    u32 color{0};
+  };
+  /// A track source iterates over its blocks, just like
+  /// hermes::profiler::Profiler::iterateBlocks does for CPU blocks
+  using TrackSource = std::function<void(const std::function<void(const TrackBlock &)> &)>;
   // *******************************************************************************************************************
   //                                                                                                     CONSTRUCTORS
   // *******************************************************************************************************************
@@ -62,12 +79,30 @@ public:
   void render();
   void setTimeWindow(u64 window_size, Resolution window_resolution = Resolution::NANOSECONDS);
   void update();
+  /// Registers an extra timeline track, drawn below the CPU blocks
+  /// \param name track label
+  /// \param source block provider
+  void addTrack(const std::string &name, TrackSource source);
+  /// Attaches a rolling capture: update() feeds it every frame and render()
+  /// shows a button to save it
+  /// \param capture (nullptr detaches)
+  /// \param path file written by the save button
+  void setCapture(TraceCapture *capture, const std::string &path = "trace.json");
   // *******************************************************************************************************************
   //                                                                                                    PUBLIC FIELDS
   // *******************************************************************************************************************
 private:
+  struct Track {
+    std::string name;
+    TrackSource source;
+  };
+
   u64 ticks2res(u64 ticks);
 
+  std::vector<Track> tracks_;
+  TraceCapture *capture_{nullptr};
+  std::string capture_path_;
+
   u64 current_time{0};
   u64 window_size_{hermes::profiler::ms2ticks(3)};
   Resolution resolution_{Resolution::MILLISECONDS};
@@ -37,6 +37,7 @@ enum class app_options {
   none = 0x00, //!< default setup
   no_viewport = 0x04, //!< starts with no viewport
   no_input = 0x08, //!< viewports will not process input
+  on_demand = 0x10, //!< renders only on input, camera changes or redraw requests
 };
 CIRCE_ENABLE_BITMASK_OPERATORS(app_options);
 
@@ -46,6 +47,7 @@ enum class viewport_options {
   orthographic = 0x01, //!< starts with an orthographic camera
   perspective = 0x02, //!< starts with a perspective camera
   no_input = 0x08, //!< viewports will not process input
+  cached = 0x10, //!< renders into an offscreen target, redrawn only when the viewport changes
 };
 CIRCE_ENABLE_BITMASK_OPERATORS(viewport_options);
 
@@ -0,0 +1,166 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file trace_capture.cpp
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+
+#include <circe/ui/trace_capture.h>
+#include <hermes/common/debug.h>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+namespace circe {
+
+namespace {
+
+// thread rows of the exported trace
+constexpr u32 frame_row = 0;
+constexpr u32 cpu_row = 1;
+
+std::string jsonEscape(const std::string &s) {
+  std::string r;
+  r.reserve(s.size());
+  for (char c : s) {
+    if (c == '"' || c == '\\')
+      r += '\\';
+    if (static_cast<unsigned char>(c) < 0x20)
+      continue;
+    r += c;
+  }
+  return r;
+}
+
+}
+
+TraceCapture::TraceCapture(f64 window_seconds) : window_seconds(window_seconds) {}
+
+TraceCapture::~TraceCapture() = default;
+
+void TraceCapture::addTrack(const std::string &name, HProfiler::TrackSource source) {
+  tracks_.push_back({name, std::move(source), 0});
+}
+
+void TraceCapture::newFrame() {
+  if (!enabled)
+    return;
+  u64 now = hermes::profiler::now();
+  // blocks finishing after the last collection end after all blocks collected
+  // so far, so the newest end seen is enough to avoid duplicates
+  u64 cpu_end = last_cpu_end_;
+  hermes::profiler::Profiler::iterateBlocks([&](const hermes::profiler::Profiler::Block &block) {
+    if (!block.end() || block.end() <= last_cpu_end_)
+      return;
+    const auto &desc = hermes::profiler::Profiler::blockDescriptor(block);
+    events_.push_back({desc.name, block.begin(), block.end(), cpu_row, desc.color});
+    cpu_end = std::max(cpu_end, block.end());
+  });
+  last_cpu_end_ = cpu_end;
+  for (u32 i = 0; i < tracks_.size(); ++i) {
+    auto &track = tracks_[i];
+    u64 track_end = track.last_end;
+    track.source([&](const HProfiler::TrackBlock &block) {
+      if (!block.end || block.end <= track.last_end)
+        return;
+      events_.push_back({block.name, block.begin, block.end, cpu_row + 1 + i, block.color});
+      track_end = std::max(track_end, block.end);
+    });
+    track.last_end = track_end;
+  }
+  // frame marker
+  if (frame_begin_)
+    events_.push_back({"frame " + std::to_string(frame_index_), frame_begin_, now, frame_row, 0});
+  // trim
+  u64 window = hermes::profiler::ns2ticks(static_cast<u64>(window_seconds * 1e9));
+  while (!events_.empty() && events_.front().end + window < now)
+    events_.pop_front();
+  // hitch detection (at most one save per window)
+  if (frame_begin_ && hitch_threshold_ms > 0 &&
+      hermes::profiler::ticks2ns(now - frame_begin_) > hitch_threshold_ms * 1e6 &&
+      (!last_hitch_save_ || last_hitch_save_ + window < now)) {
+    if (save(hermes::Path(hitch_file_prefix + std::to_string(frame_index_) + ".json"))) {
+      last_hitch_save_ = now;
+      hitch_count_++;
+    }
+  }
+  frame_begin_ = now;
+  frame_index_++;
+}
+
+void TraceCapture::clear() {
+  events_.clear();
+}
+
+std::string TraceCapture::chromeTrace() const {
+  u64 origin = hermes::profiler::Profiler::initTime();
+  auto us = [&](u64 ticks) -> f64 {
+    return static_cast<f64>(hermes::profiler::ticks2ns(ticks > origin ? ticks - origin : 0)) * 1e-3;
+  };
+  std::ostringstream s;
+  s.precision(3);
+  s << std::fixed;
+  s << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+  auto thread_name = [&](u32 row, const std::string &name) {
+    s << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << row
+      << ",\"args\":{\"name\":\"" << jsonEscape(name) << "\"}},\n";
+  };
+  thread_name(frame_row, "frames");
+  thread_name(cpu_row, "CPU");
+  for (u32 i = 0; i < tracks_.size(); ++i)
+    thread_name(cpu_row + 1 + i, tracks_[i].name);
+  bool first = true;
+  for (const auto &event : events_) {
+    if (!first)
+      s << ",\n";
+    first = false;
+    s << "{\"name\":\"" << jsonEscape(event.name) << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.row
+      << ",\"ts\":" << us(event.begin) << ",\"dur\":" << us(event.end) - us(event.begin) << "}";
+  }
+  // metadata entries end with a comma
+  if (first)
+    s << "{\"name\":\"empty\",\"ph\":\"i\",\"pid\":0,\"tid\":0,\"ts\":0}";
+  s << "\n]}\n";
+  return s.str();
+}
+
+bool TraceCapture::save(const hermes::Path &path) const {
+  std::ofstream file(path.fullName());
+  if (!file.good()) {
+    HERMES_LOG_ERROR("failed to open trace file {}", path.fullName());
+    return false;
+  }
+  file << chromeTrace();
+  return file.good();
+}
+
+size_t TraceCapture::eventCount() const {
+  return events_.size();
+}
+
+u64 TraceCapture::hitchCount() const {
+  return hitch_count_;
+}
+
+}
@@ -0,0 +1,124 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file trace_capture.h
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+
+#ifndef CIRCE_CIRCE_UI_TRACE_CAPTURE_H
+#define CIRCE_CIRCE_UI_TRACE_CAPTURE_H
+
+#include <circe/ui/imgui_profiler.h>
+#include <hermes/common/file_system.h>
+#include <deque>
+
+namespace circe {
+
+/// Rolling capture of the last seconds of profiler blocks, saved on demand as
+/// Chrome trace JSON (chrome://tracing, ui.perfetto.dev).
+/// Once per frame, newFrame() moves the blocks that finished since the last
+/// frame from hermes::profiler (and from extra tracks, ex: GPU timers) into
+/// the capture and adds a frame marker. Events older than the window are
+/// dropped, so memory stays bounded and idle cost is a walk over the (capped)
+/// profiler block list.
+/// A trace can be saved at any time, or automatically when a frame takes
+/// longer than hitch_threshold_ms, so rare hitches can be inspected after
+/// the fact:
+/// \code{.cpp}
+///     TraceCapture capture(10.0);
+///     capture.addTrack("GPU", [&](const auto &f) { gpu_timer.iterateBlocks(f); });
+///     capture.hitch_threshold_ms = 50;
+///     // every frame
+///     capture.newFrame();
+///     // on a key press
+///     capture.save("frame.json");
+/// \endcode
+/// \note hermes::profiler blocks carry no thread information, CPU blocks go
+/// to a single CPU thread row and each extra track gets its own row.
+class TraceCapture {
+public:
+  // *******************************************************************************************************************
+  //                                                                                                     CONSTRUCTORS
+  // *******************************************************************************************************************
+  /// \param window_seconds length of the rolling capture
+  explicit TraceCapture(f64 window_seconds = 10.0);
+  ~TraceCapture();
+  // *******************************************************************************************************************
+  //                                                                                                          METHODS
+  // *******************************************************************************************************************
+  /// Registers an extra block source, captured in its own thread row
+  /// \param name row label
+  /// \param source block provider
+  void addTrack(const std::string &name, HProfiler::TrackSource source);
+  /// Collects finished blocks, marks a frame boundary and trims old events
+  void newFrame();
+  /// Drops all captured events
+  void clear();
+  /// \return captured events as Chrome trace JSON
+  [[nodiscard]] std::string chromeTrace() const;
+  /// Writes the captured events as Chrome trace JSON
+  /// \param path output file
+  /// \return true if the file was written
+  bool save(const hermes::Path &path) const;
+  // *******************************************************************************************************************
+  //                                                                                                           FIELDS
+  // *******************************************************************************************************************
+  /// \return number of captured events (blocks and frames)
+  [[nodiscard]] size_t eventCount() const;
+  /// \return number of traces saved because of hitches
+  [[nodiscard]] u64 hitchCount() const;
+  // *******************************************************************************************************************
+  //                                                                                                    PUBLIC FIELDS
+  // *******************************************************************************************************************
+  f64 window_seconds{10.0};             //!< length of the rolling capture
+  f64 hitch_threshold_ms{0.0};          //!< frame time that triggers a save (0 = disabled)
+  std::string hitch_file_prefix{"hitch_"}; //!< hitch traces go to <prefix><frame>.json
+  bool enabled{true};                   //!< false: newFrame does nothing
+
+private:
+  struct Event {
+    std::string name;
+    u64 begin{0};
+    u64 end{0};
+    u32 row{0};
+    u32 color{0};
+  };
+  struct Track {
+    std::string name;
+    HProfiler::TrackSource source;
+    u64 last_end{0}; //!< end of the newest block already captured
+  };
+
+  std::deque<Event> events_;
+  std::vector<Track> tracks_;
+  u64 last_cpu_end_{0};
+  u64 frame_begin_{0};
+  u64 frame_index_{0};
+  u64 last_hitch_save_{0};
+  u64 hitch_count_{0};
+};
+
+}
+
+#endif //CIRCE_CIRCE_UI_TRACE_CAPTURE_H
@@ -27,6 +27,7 @@
 
 #include <circe/vk/core/logical_device.h>
 #include <circe/vk/utils/vk_debug.h>
+#include <algorithm>
 
 namespace circe::vk {
 
@@ -54,6 +55,14 @@ const PhysicalDevice &LogicalDevice::Ref::physicalDevice() const {
   return *device_->physical_device_;
 }
 
+const VkPhysicalDeviceFeatures &LogicalDevice::Ref::enabledFeatures() const {
+  return device_->vk_enabled_features_;
+}
+
+bool LogicalDevice::Ref::isExtensionEnabled(const std::string &extension_name) const {
+  return device_->isExtensionEnabled(extension_name);
+}
+
 LogicalDevice::LogicalDevice() = default;
 
 [[maybe_unused]] LogicalDevice::LogicalDevice(
@@ -68,6 +77,8 @@ LogicalDevice::LogicalDevice() = default;
 LogicalDevice::LogicalDevice(LogicalDevice &&other) noexcept {
   vk_device_ = other.vk_device_;
   physical_device_ = other.physical_device_;
+  vk_enabled_features_ = other.vk_enabled_features_;
+  enabled_extensions_ = std::move(other.enabled_extensions_);
   other.vk_device_ = VK_NULL_HANDLE;
 }
 
@@ -79,6 +90,8 @@ LogicalDevice &LogicalDevice::operator=(LogicalDevice &&other) noexcept {
   destroy();
   vk_device_ = other.vk_device_;
   physical_device_ = other.physical_device_;
+  vk_enabled_features_ = other.vk_enabled_features_;
+  enabled_extensions_ = std::move(other.enabled_extensions_);
   other.vk_device_ = VK_NULL_HANDLE;
   return *this;
 }
@@ -90,6 +103,8 @@ bool LogicalDevice::init(const PhysicalDevice *physical_device,
                          const std::vector<const char *> &validation_layers) {
   destroy();
   physical_device_ = physical_device;
+  vk_enabled_features_ = desired_features;
+  enabled_extensions_.assign(desired_extensions.begin(), desired_extensions.end());
 
   for (auto &extension : desired_extensions)
     if (!physical_device->isExtensionSupported(extension)) {
@@ -159,6 +174,15 @@ const PhysicalDevice *LogicalDevice::physicalDevice() const {
   return physical_device_;
 }
 
+const VkPhysicalDeviceFeatures &LogicalDevice::enabledFeatures() const {
+  return vk_enabled_features_;
+}
+
+bool LogicalDevice::isExtensionEnabled(const std::string &extension_name) const {
+  return std::find(enabled_extensions_.begin(), enabled_extensions_.end(), extension_name) !=
+      enabled_extensions_.end();
+}
+
 bool LogicalDevice::good() const { return vk_device_ != VK_NULL_HANDLE; }
 
 u32
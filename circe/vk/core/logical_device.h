@@ -114,6 +114,11 @@ public:
                                        VkMemoryPropertyFlags required_flags,
                                        VkMemoryPropertyFlags preferred_flags) const;
     const PhysicalDevice& physicalDevice() const;
+    /// \return features enabled at device creation
+    [[nodiscard]] const VkPhysicalDeviceFeatures &enabledFeatures() const;
+    /// \param extension_name
+    /// \return true if the extension was enabled at device creation
+    [[nodiscard]] bool isExtensionEnabled(const std::string &extension_name) const;
 
   private:
     explicit Ref(const LogicalDevice *device);
@@ -168,6 +173,11 @@ public:
   [[nodiscard]] VkDevice handle() const;
   ///\return const PhysicalDevice&
   [[nodiscard]] const PhysicalDevice *physicalDevice() const;
+  /// \return features enabled at device creation
+  [[nodiscard]] const VkPhysicalDeviceFeatures &enabledFeatures() const;
+  /// \param extension_name
+  /// \return true if the extension was enabled at device creation
+  [[nodiscard]] bool isExtensionEnabled(const std::string &extension_name) const;
   /// Checks physical device object construction success
   ///\return bool true if this can be used
   [[nodiscard]] bool good() const;
@@ -186,6 +196,8 @@ public:
 private:
   const PhysicalDevice *physical_device_{nullptr};
   VkDevice vk_device_{VK_NULL_HANDLE};
+  VkPhysicalDeviceFeatures vk_enabled_features_{};
+  std::vector<std::string> enabled_extensions_;
 };
 
 } // namespace circe
@@ -323,6 +323,10 @@ const VkPhysicalDeviceProperties &PhysicalDevice::properties() const {
 const VkPhysicalDeviceFeatures &PhysicalDevice::features() const {
   return vk_features_;
 }
+
+const std::vector<VkQueueFamilyProperties> &PhysicalDevice::queueFamilyProperties() const {
+  return vk_queue_families_;
+}
 [[maybe_unused]] VkSampleCountFlagBits
 PhysicalDevice::maxUsableSampleCount(bool include_depth_buffer) const {
   VkSampleCountFlags counts =
@@ -162,6 +162,8 @@ public:
                       VkSurfaceCapabilitiesKHR &surface_capabilities) const;
   [[nodiscard]] const VkPhysicalDeviceProperties &properties() const;
   [[nodiscard]] const VkPhysicalDeviceFeatures &features() const;
+  /// \return properties of each queue family, indexed by family index
+  [[nodiscard]] const std::vector<VkQueueFamilyProperties> &queueFamilyProperties() const;
   ///\return VkSampleCountFlagBits the highest sample count supported by the
   /// color buffer
   ///\param include_depth_buffer **[in | default = true]** if true, computes the
@@ -133,7 +133,7 @@ ImageMemoryBarrier::ImageMemoryBarrier(const Image &image,
   vk_image_memory_barrier_.subresourceRange.baseMipLevel = 0;
   vk_image_memory_barrier_.subresourceRange.levelCount = image.mipLevels();
   vk_image_memory_barrier_.subresourceRange.baseArrayLayer = 0;
-  vk_image_memory_barrier_.subresourceRange.layerCount = 1;
+  vk_image_memory_barrier_.subresourceRange.layerCount = image.layers();
 
   if (old_layout == VK_IMAGE_LAYOUT_UNDEFINED &&
       new_layout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) {
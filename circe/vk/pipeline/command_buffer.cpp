@@ -116,6 +116,29 @@ bool CommandBuffer::begin(VkCommandBufferUsageFlags flags) const {
   return true;
 }
 
+bool CommandBuffer::beginSecondary(const RenderPass::Ref &renderpass, u32 subpass,
+                                   const Framebuffer *framebuffer,
+                                   VkCommandBufferUsageFlags flags) const {
+  HERMES_VALIDATE_EXP_WITH_WARNING(vk_command_buffer_, "using bad command buffer.")
+  HERMES_VALIDATE_EXP_WITH_WARNING(renderpass.good(), "using bad renderpass.")
+  VkCommandBufferInheritanceInfo inheritance_info = {
+      VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO, // VkStructureType sType
+      nullptr,             // const void                     * pNext
+      renderpass.handle(), // VkRenderPass                     renderPass
+      subpass,             // u32                              subpass
+      framebuffer ? framebuffer->handle() : VK_NULL_HANDLE, // VkFramebuffer framebuffer
+      VK_FALSE,            // VkBool32                         occlusionQueryEnable
+      0,                   // VkQueryControlFlags              queryFlags
+      0                    // VkQueryPipelineStatisticFlags    pipelineStatistics
+  };
+  VkCommandBufferBeginInfo info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+                                   nullptr,
+                                   flags | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT,
+                                   &inheritance_info};
+  R_CHECK_VULKAN(vkBeginCommandBuffer(vk_command_buffer_, &info), false)
+  return true;
+}
+
 bool CommandBuffer::end() const {
   HERMES_VALIDATE_EXP_WITH_WARNING(vk_command_buffer_, "using bad command buffer.")
   R_CHECK_VULKAN(vkEndCommandBuffer(vk_command_buffer_), false)
@@ -302,6 +325,20 @@ void CommandBuffer::drawIndexed(u32 index_count, u32 instance_count,
                    vertex_offset, first_instance);
 }
 
+void CommandBuffer::drawIndexedIndirect(const Buffer &buffer, VkDeviceSize offset,
+                                        u32 draw_count, u32 stride) const {
+  HERMES_VALIDATE_EXP_WITH_WARNING(vk_command_buffer_, "using bad command buffer.")
+  vkCmdDrawIndexedIndirect(vk_command_buffer_, buffer.handle(), offset, draw_count, stride);
+}
+
+void CommandBuffer::executeCommands(const std::vector<VkCommandBuffer> &command_buffers) const {
+  HERMES_VALIDATE_EXP_WITH_WARNING(vk_command_buffer_, "using bad command buffer.")
+  if (command_buffers.empty())
+    return;
+  vkCmdExecuteCommands(vk_command_buffer_, static_cast<u32>(command_buffers.size()),
+                       command_buffers.data());
+}
+
 void CommandBuffer::transitionImageLayout(
     const ImageMemoryBarrier &barrier, VkPipelineStageFlags src_stages,
     VkPipelineStageFlags dst_stages) const {
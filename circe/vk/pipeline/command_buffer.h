@@ -96,6 +96,20 @@ public:
   ///\param flags **[in]**
   ///\return bool
   [[nodiscard]] bool begin(VkCommandBufferUsageFlags flags = 0) const;
+  ///\brief Starts recording a secondary command buffer that will be executed
+  /// entirely inside a render pass instance.
+  ///\note VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT is always added to
+  /// flags.
+  ///\param renderpass **[in]** render pass the commands will execute within
+  ///\param subpass **[in]** subpass index within renderpass
+  ///\param framebuffer **[in | optional]** framebuffer (if known) the commands
+  /// will render into
+  ///\param flags **[in]**
+  ///\return bool
+  [[nodiscard]] bool beginSecondary(const RenderPass::Ref &renderpass, u32 subpass,
+                                    const Framebuffer *framebuffer = nullptr,
+                                    VkCommandBufferUsageFlags flags =
+                                    VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT) const;
   ///\brief
   ///
   ///\return bool
@@ -313,6 +327,20 @@ public:
   void drawIndexed(u32 index_count, u32 instance_count = 1,
                    u32 first_index = 0, int32_t vertex_offset = 0,
                    u32 first_instance = 0) const;
+  ///\brief Draws indexed primitives with parameters read from a buffer of
+  /// VkDrawIndexedIndirectCommand.
+  ///\note draw_count > 1 requires the multiDrawIndirect device feature.
+  ///\param buffer **[in]** indirect buffer
+  ///\param offset **[in]** byte offset of the first command
+  ///\param draw_count **[in]** number of draws
+  ///\param stride **[in]** byte stride between commands
+  void drawIndexedIndirect(const Buffer &buffer, VkDeviceSize offset,
+                           u32 draw_count, u32 stride) const;
+  ///\brief Executes secondary command buffers from this primary command buffer
+  ///\note If called inside a render pass, it must have been started with
+  /// VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS.
+  ///\param command_buffers **[in]** secondary command buffers
+  void executeCommands(const std::vector<VkCommandBuffer> &command_buffers) const;
   ///\brief
   ///
   ///\param barrier **[in]**
@@ -0,0 +1,245 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+/// \file geometry_buffer.cpp
+/// \author FilipeCN (filipedecn@gmail.com)
+/// \date 2026-10-19
+///
+/// \brief
+
+
+#include <circe/vk/scene/geometry_buffer.h>
+#include <circe/vk/utils/vk_debug.h>
+#include <algorithm>
+#include <cstring>
+
+namespace circe::vk {
+
+GeometryBuffer::GeometryBuffer() = default;
+
+GeometryBuffer::~GeometryBuffer() {
+  destroy();
+}
+
+bool GeometryBuffer::init(const LogicalDevice::Ref &logical_device, VkQueue copy_queue,
+                          u32 queue_family_index, u32 vertex_stride, u32 vertex_capacity,
+                          u32 index_capacity, VkDeviceSize staging_size) {
+  destroy();
+  HERMES_VALIDATE_EXP_WITH_WARNING(logical_device.good(), "using bad device.")
+  HERMES_VALIDATE_EXP_WITH_WARNING(vertex_stride && vertex_capacity && index_capacity,
+                                   "empty geometry buffer.")
+  device_ = logical_device;
+  queue_ = copy_queue;
+  family_index_ = queue_family_index;
+  vertex_stride_ = vertex_stride;
+  vertex_capacity_ = vertex_capacity;
+  index_capacity_ = index_capacity;
+  vertices_m_.setDevice(device_);
+  indices_m_.setDevice(device_);
+  staging_m_.setDevice(device_);
+  indirect_m_.setDevice(device_);
+  // shared device local buffers
+  VkMemoryRequirements memory_requirements{};
+  HERMES_RETURN_VALUE_IF_NOT(vertices_.init(device_, static_cast<VkDeviceSize>(vertex_capacity) * vertex_stride,
+                                            VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT),
+                             false)
+  HERMES_RETURN_VALUE_IF_NOT(vertices_.memoryRequirements(memory_requirements), false)
+  HERMES_RETURN_VALUE_IF_NOT(vertices_m_.allocate(memory_requirements, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT), false)
+  HERMES_RETURN_VALUE_IF_NOT(vertices_m_.bind(vertices_), false)
+  HERMES_RETURN_VALUE_IF_NOT(indices_.init(device_, static_cast<VkDeviceSize>(index_capacity) * sizeof(u32),
+                                           VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT),
+                             false)
+  HERMES_RETURN_VALUE_IF_NOT(indices_.memoryRequirements(memory_requirements), false)
+  HERMES_RETURN_VALUE_IF_NOT(indices_m_.allocate(memory_requirements, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT), false)
+  HERMES_RETURN_VALUE_IF_NOT(indices_m_.bind(indices_), false)
+  // persistently mapped staging buffer, reused by all uploads
+  HERMES_RETURN_VALUE_IF_NOT(staging_.init(device_, staging_size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT), false)
+  HERMES_RETURN_VALUE_IF_NOT(staging_.memoryRequirements(memory_requirements), false)
+  HERMES_RETURN_VALUE_IF_NOT(staging_m_.allocate(memory_requirements, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+      VK_MEMORY_PROPERTY_HOST_COHERENT_BIT), false)
+  HERMES_RETURN_VALUE_IF_NOT(staging_m_.bind(staging_), false)
+  HERMES_RETURN_VALUE_IF_NOT(staging_m_.map(), false)
+  return true;
+}
+
+void GeometryBuffer::destroy() {
+  staging_m_.unmap();
+  indirect_m_.unmap();
+  vertices_.destroy();
+  indices_.destroy();
+  staging_.destroy();
+  indirect_.destroy();
+  vertices_m_.destroy();
+  indices_m_.destroy();
+  staging_m_.destroy();
+  indirect_m_.destroy();
+  vertex_copies_.clear();
+  index_copies_.clear();
+  draws_.clear();
+  staging_offset_ = 0;
+  vertex_count_ = index_count_ = indirect_draw_count_ = 0;
+}
+
+bool GeometryBuffer::good() const {
+  return vertices_.good() && indices_.good() && staging_.good();
+}
+
+bool GeometryBuffer::allocate(u32 vertex_count, u32 index_count, Range &range) {
+  if (vertex_count_ + vertex_count > vertex_capacity_ || index_count_ + index_count > index_capacity_) {
+    HERMES_LOG_WARNING("geometry buffer is full.");
+    return false;
+  }
+  range.vertex_base = vertex_count_;
+  range.vertex_count = vertex_count;
+  range.index_base = index_count_;
+  range.index_count = index_count;
+  vertex_count_ += vertex_count;
+  index_count_ += index_count;
+  return true;
+}
+
+bool GeometryBuffer::upload(const Range &range, const void *vertex_data, const u32 *index_data) {
+  HERMES_VALIDATE_EXP_WITH_WARNING(good(), "using bad geometry buffer.")
+  if (vertex_data && range.vertex_count)
+    HERMES_RETURN_VALUE_IF_NOT(stage(vertex_data, static_cast<VkDeviceSize>(range.vertex_count) * vertex_stride_,
+                                     true, static_cast<VkDeviceSize>(range.vertex_base) * vertex_stride_), false)
+  if (index_data && range.index_count)
+    HERMES_RETURN_VALUE_IF_NOT(stage(index_data, static_cast<VkDeviceSize>(range.index_count) * sizeof(u32),
+                                     false, static_cast<VkDeviceSize>(range.index_base) * sizeof(u32)), false)
+  return true;
+}
+
+bool GeometryBuffer::stage(const void *data, VkDeviceSize size, bool to_vertices, VkDeviceSize dst_offset) {
+  auto *src = reinterpret_cast<const u8 *>(data);
+  while (size) {
+    if (staging_offset_ == staging_.size())
+      HERMES_RETURN_VALUE_IF_NOT(flush(), false)
+    // data larger than the staging buffer is split into multiple copies
+    VkDeviceSize chunk_size = std::min(size, staging_.size() - staging_offset_);
+    std::memcpy(reinterpret_cast<u8 *>(staging_m_.mapped()) + staging_offset_, src, chunk_size);
+    (to_vertices ? vertex_copies_ : index_copies_).push_back({staging_offset_, dst_offset, chunk_size});
+    staging_offset_ += chunk_size;
+    dst_offset += chunk_size;
+    src += chunk_size;
+    size -= chunk_size;
+  }
+  return true;
+}
+
+bool GeometryBuffer::flush() {
+  if (vertex_copies_.empty() && index_copies_.empty())
+    return true;
+  HERMES_VALIDATE_EXP_WITH_WARNING(queue_ != VK_NULL_HANDLE, "geometry buffer without copy queue.")
+  CommandPool::submitCommandBuffer(device_, family_index_, queue_, [&](CommandBuffer &cb) {
+    if (!vertex_copies_.empty())
+      vkCmdCopyBuffer(cb.handle(), staging_.handle(), vertices_.handle(),
+                      vertex_copies_.size(), vertex_copies_.data());
+    if (!index_copies_.empty())
+      vkCmdCopyBuffer(cb.handle(), staging_.handle(), indices_.handle(),
+                      index_copies_.size(), index_copies_.data());
+  });
+  vertex_copies_.clear();
+  index_copies_.clear();
+  staging_offset_ = 0;
+  return true;
+}
+
+void GeometryBuffer::clear() {
+  vertex_count_ = index_count_ = 0;
+  vertex_copies_.clear();
+  index_copies_.clear();
+  staging_offset_ = 0;
+  clearDraws();
+}
+
+void GeometryBuffer::bind(const CommandBuffer &command_buffer) const {
+  command_buffer.bindVertexBuffers(0, {vertices_.handle()}, {0});
+  command_buffer.bindIndexBuffer(indices_, 0, VK_INDEX_TYPE_UINT32);
+}
+
+u32 GeometryBuffer::pushDraw(const Range &range, u32 instance_count, u32 first_instance) {
+  draws_.push_back({
+                       range.index_count,                       // u32 indexCount
+                       instance_count,                          // u32 instanceCount
+                       range.index_base,                        // u32 firstIndex
+                       static_cast<int32_t>(range.vertex_base), // int32_t vertexOffset
+                       first_instance                           // u32 firstInstance
+                   });
+  return draws_.size() - 1;
+}
+
+void GeometryBuffer::clearDraws() {
+  draws_.clear();
+}
+
+bool GeometryBuffer::updateIndirectCommands() {
+  HERMES_VALIDATE_EXP_WITH_WARNING(device_.good(), "using bad device.")
+  VkDeviceSize size = draws_.size() * sizeof(VkDrawIndexedIndirectCommand);
+  if (!size) {
+    indirect_draw_count_ = 0;
+    return true;
+  }
+  if (!indirect_.good() || indirect_.size() < size) {
+    // grow geometrically to avoid reallocations when draws are added
+    VkDeviceSize capacity = std::max(size, 2 * (indirect_.good() ? indirect_.size() : 0));
+    indirect_m_.unmap();
+    HERMES_RETURN_VALUE_IF_NOT(indirect_.init(device_, capacity, VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT), false)
+    VkMemoryRequirements memory_requirements{};
+    HERMES_RETURN_VALUE_IF_NOT(indirect_.memoryRequirements(memory_requirements), false)
+    HERMES_RETURN_VALUE_IF_NOT(indirect_m_.allocate(memory_requirements, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+        VK_MEMORY_PROPERTY_HOST_COHERENT_BIT), false)
+    HERMES_RETURN_VALUE_IF_NOT(indirect_m_.bind(indirect_), false)
+    HERMES_RETURN_VALUE_IF_NOT(indirect_m_.map(), false)
+  }
+  std::memcpy(indirect_m_.mapped(), draws_.data(), size);
+  indirect_draw_count_ = draws_.size();
+  return true;
+}
+
+void GeometryBuffer::drawIndirect(const CommandBuffer &command_buffer) const {
+  if (!indirect_draw_count_)
+    return;
+  if (device_.enabledFeatures().multiDrawIndirect) {
+    command_buffer.drawIndexedIndirect(indirect_, 0, indirect_draw_count_,
+                                       sizeof(VkDrawIndexedIndirectCommand));
+    return;
+  }
+  // one indirect call per command still avoids binding per mesh buffers
+  for (u32 i = 0; i < indirect_draw_count_; ++i)
+    command_buffer.drawIndexedIndirect(indirect_, i * sizeof(VkDrawIndexedIndirectCommand), 1,
+                                       sizeof(VkDrawIndexedIndirectCommand));
+}
+
+const Buffer &GeometryBuffer::vertices() const { return vertices_; }
+
+const Buffer &GeometryBuffer::indices() const { return indices_; }
+
+const Buffer &GeometryBuffer::indirectCommands() const { return indirect_; }
+
+u32 GeometryBuffer::vertexStride() const { return vertex_stride_; }
+
+u32 GeometryBuffer::drawCount() const { return indirect_draw_count_; }
+
+u32 GeometryBuffer::vertexCount() const { return vertex_count_; }
+
+u32 GeometryBuffer::indexCount() const { return index_count_; }
+
+} // namespace circe::vk
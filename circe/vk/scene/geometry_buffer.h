@@ -0,0 +1,180 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+/// \file geometry_buffer.h
+/// \author FilipeCN (filipedecn@gmail.com)
+/// \date 2026-10-19
+///
+/// \brief
+
+
+#ifndef CIRCE_VK_SCENE_GEOMETRY_BUFFER_H
+#define CIRCE_VK_SCENE_GEOMETRY_BUFFER_H
+
+#include <circe/vk/pipeline/command_buffer.h>
+#include <circe/vk/storage/device_memory.h>
+
+namespace circe::vk {
+
+/// Device-local vertex and index buffers shared by many meshes.
+/// Meshes are sub-allocated from a single vertex buffer and a single index
+/// buffer, so a whole scene can be drawn with one bound buffer pair and a
+/// single vkCmdDrawIndexedIndirect call. All meshes must share the same
+/// interleaved vertex format (vertex stride).
+/// Uploads go through a persistently mapped staging buffer and are batched:
+/// copies are only submitted (and waited) on flush(), or when the staging
+/// buffer runs out of space.
+/// \code{.cpp}
+///     GeometryBuffer geometry;
+///     geometry.init(device.ref(), queue, family_index, stride, 1 << 20, 3 << 20);
+///     vk::Model a, b;
+///     a.loadFromModel(model_a, geometry);
+///     b.loadFromModel(model_b, geometry);
+///     geometry.flush();
+///     a.pushDraws(geometry);
+///     b.pushDraws(geometry);
+///     geometry.updateIndirectCommands();
+///     // record_command_buffer_callback
+///     geometry.bind(cb);
+///     geometry.drawIndirect(cb);
+/// \endcode
+class GeometryBuffer {
+public:
+  /// Region of the shared buffers owned by a mesh
+  struct Range {
+    u32 vertex_base{0};  //!< index of the first vertex
+    u32 vertex_count{0};
+    u32 index_base{0};   //!< index of the first index
+    u32 index_count{0};
+  };
+  // ***********************************************************************
+  //                           CONSTRUCTORS
+  // ***********************************************************************
+  GeometryBuffer();
+  GeometryBuffer(const GeometryBuffer &other) = delete;
+  ~GeometryBuffer();
+  // ***********************************************************************
+  //                           OPERATORS
+  // ***********************************************************************
+  GeometryBuffer &operator=(const GeometryBuffer &other) = delete;
+  // ***********************************************************************
+  //                            CREATION
+  // ***********************************************************************
+  /// \param logical_device
+  /// \param copy_queue queue used to submit the upload copies
+  /// \param queue_family_index family of copy_queue
+  /// \param vertex_stride size in bytes of a single vertex
+  /// \param vertex_capacity maximum number of vertices
+  /// \param index_capacity maximum number of (32 bit) indices
+  /// \param staging_size size in bytes of the staging buffer
+  /// \return bool true if success
+  bool init(const LogicalDevice::Ref &logical_device, VkQueue copy_queue,
+            u32 queue_family_index, u32 vertex_stride, u32 vertex_capacity,
+            u32 index_capacity, VkDeviceSize staging_size = 1u << 24);
+  ///
+  void destroy();
+  /// \return true if init succeeded
+  [[nodiscard]] bool good() const;
+  // ***********************************************************************
+  //                           METHODS
+  // ***********************************************************************
+  /// Reserves space for a mesh. Space is never released individually, call
+  /// clear() to reuse the whole buffers.
+  /// \param vertex_count
+  /// \param index_count
+  /// \param range **[out]** reserved region
+  /// \return bool false if there is not enough space left
+  bool allocate(u32 vertex_count, u32 index_count, Range &range);
+  /// Stages the data of a mesh to be copied into its region.
+  /// \note vertex indices are relative to the first vertex of the range
+  /// \param range region returned by allocate
+  /// \param vertex_data range.vertex_count * vertexStride() bytes
+  /// \param index_data range.index_count indices
+  /// \return bool true if success
+  bool upload(const Range &range, const void *vertex_data, const u32 *index_data);
+  /// Submits all staged copies in a single command buffer and waits for it.
+  /// \return bool true if success
+  bool flush();
+  /// Releases all sub-allocations and draw commands
+  void clear();
+  /// Binds the vertex buffer (at binding 0) and the index buffer
+  /// \param command_buffer
+  void bind(const CommandBuffer &command_buffer) const;
+  /// Appends an indexed draw of a range to the host list of indirect commands
+  /// \param range
+  /// \param instance_count
+  /// \param first_instance
+  /// \return index of the draw command
+  u32 pushDraw(const Range &range, u32 instance_count = 1, u32 first_instance = 0);
+  /// Clears the host list of indirect commands
+  void clearDraws();
+  /// Copies the host list of indirect commands into the indirect buffer.
+  /// \note The indirect buffer is host visible, the caller must make sure
+  /// the GPU is not reading it while it is updated.
+  /// \return bool true if success
+  bool updateIndirectCommands();
+  /// Draws all commands of the indirect buffer with a single
+  /// vkCmdDrawIndexedIndirect (one call per command if multiDrawIndirect was
+  /// not enabled on the logical device)
+  /// \param command_buffer
+  void drawIndirect(const CommandBuffer &command_buffer) const;
+  // ***********************************************************************
+  //                            FIELDS
+  // ***********************************************************************
+  [[nodiscard]] const Buffer &vertices() const;
+  [[nodiscard]] const Buffer &indices() const;
+  [[nodiscard]] const Buffer &indirectCommands() const;
+  [[nodiscard]] u32 vertexStride() const;
+  /// \return number of draw commands in the indirect buffer
+  [[nodiscard]] u32 drawCount() const;
+  /// \return number of allocated vertices
+  [[nodiscard]] u32 vertexCount() const;
+  /// \return number of allocated indices
+  [[nodiscard]] u32 indexCount() const;
+
+private:
+  bool stage(const void *data, VkDeviceSize size, bool to_vertices, VkDeviceSize dst_offset);
+
+  LogicalDevice::Ref device_;
+  VkQueue queue_{VK_NULL_HANDLE};
+  u32 family_index_{0};
+  u32 vertex_stride_{0};
+  u32 vertex_capacity_{0};
+  u32 index_capacity_{0};
+  u32 vertex_count_{0};
+  u32 index_count_{0};
+  Buffer vertices_, indices_;
+  DeviceMemory vertices_m_, indices_m_;
+  // staging
+  Buffer staging_;
+  DeviceMemory staging_m_;
+  VkDeviceSize staging_offset_{0};
+  std::vector<VkBufferCopy> vertex_copies_, index_copies_;
+  // indirect draws
+  std::vector<VkDrawIndexedIndirectCommand> draws_;
+  Buffer indirect_;
+  DeviceMemory indirect_m_;
+  u32 indirect_draw_count_{0};
+};
+
+} // namespace circe::vk
+
+#endif // CIRCE_VK_SCENE_GEOMETRY_BUFFER_H
@@ -28,7 +28,9 @@
 #include <circe/vk/scene/scene_model.h>
 #include <circe/vk/storage/buffer.h>
 #include <circe/vk/pipeline/command_buffer.h>
+#include <circe/scene/model.h>
 #include <hermes/geometry/vector.h>
+#include <numeric>
 
 #define TINYOBJLOADER_IMPLEMENTATION
 #include <tiny_obj_loader.h>
@@ -61,6 +63,93 @@ template<> struct hash<Vertex> {
 
 namespace circe::vk {
 
+namespace {
+
+u32 dataTypeSize(hermes::DataType type) {
+#define MATCH_TYPE(TT, R) \
+  if (hermes::DataType::TT == type) \
+    return R;
+  MATCH_TYPE(I8, 1)
+  MATCH_TYPE(U8, 1)
+  MATCH_TYPE(I16, 2)
+  MATCH_TYPE(U16, 2)
+  MATCH_TYPE(F16, 2)
+  MATCH_TYPE(I32, 4)
+  MATCH_TYPE(U32, 4)
+  MATCH_TYPE(F32, 4)
+  MATCH_TYPE(F64, 8)
+#undef MATCH_TYPE
+  return 0;
+}
+
+/// same row split used by gl::VertexAttributes
+u32 componentsPerRow(u32 component_count) {
+  if (component_count % 3 == 0)
+    return 3;
+  if (component_count % 4 == 0)
+    return 4;
+  if (component_count % 2 == 0)
+    return 2;
+  return 1;
+}
+
+} // namespace
+
+VkFormat vertexAttributeFormat(hermes::DataType type, u32 component_count) {
+  if (!component_count || component_count > 4)
+    return VK_FORMAT_UNDEFINED;
+#define MATCH_TYPE(TT, F1, F2, F3, F4) \
+  if (hermes::DataType::TT == type) { \
+    const VkFormat formats[4] = {F1, F2, F3, F4}; \
+    return formats[component_count - 1]; \
+  }
+  MATCH_TYPE(I8, VK_FORMAT_R8_SINT, VK_FORMAT_R8G8_SINT, VK_FORMAT_R8G8B8_SINT, VK_FORMAT_R8G8B8A8_SINT)
+  MATCH_TYPE(U8, VK_FORMAT_R8_UINT, VK_FORMAT_R8G8_UINT, VK_FORMAT_R8G8B8_UINT, VK_FORMAT_R8G8B8A8_UINT)
+  MATCH_TYPE(I16, VK_FORMAT_R16_SINT, VK_FORMAT_R16G16_SINT, VK_FORMAT_R16G16B16_SINT, VK_FORMAT_R16G16B16A16_SINT)
+  MATCH_TYPE(U16, VK_FORMAT_R16_UINT, VK_FORMAT_R16G16_UINT, VK_FORMAT_R16G16B16_UINT, VK_FORMAT_R16G16B16A16_UINT)
+  MATCH_TYPE(F16, VK_FORMAT_R16_SFLOAT, VK_FORMAT_R16G16_SFLOAT, VK_FORMAT_R16G16B16_SFLOAT,
+             VK_FORMAT_R16G16B16A16_SFLOAT)
+  MATCH_TYPE(I32, VK_FORMAT_R32_SINT, VK_FORMAT_R32G32_SINT, VK_FORMAT_R32G32B32_SINT, VK_FORMAT_R32G32B32A32_SINT)
+  MATCH_TYPE(U32, VK_FORMAT_R32_UINT, VK_FORMAT_R32G32_UINT, VK_FORMAT_R32G32B32_UINT, VK_FORMAT_R32G32B32A32_UINT)
+  MATCH_TYPE(F32, VK_FORMAT_R32_SFLOAT, VK_FORMAT_R32G32_SFLOAT, VK_FORMAT_R32G32B32_SFLOAT,
+             VK_FORMAT_R32G32B32A32_SFLOAT)
+  MATCH_TYPE(F64, VK_FORMAT_R64_SFLOAT, VK_FORMAT_R64G64_SFLOAT, VK_FORMAT_R64G64B64_SFLOAT,
+             VK_FORMAT_R64G64B64A64_SFLOAT)
+#undef MATCH_TYPE
+  return VK_FORMAT_UNDEFINED;
+}
+
+u32 vertexStride(const hermes::AoS &aos) {
+  u32 stride = 0;
+  for (const auto &field : aos.fields())
+    stride += field.component_count * dataTypeSize(field.type);
+  return stride;
+}
+
+bool setupVertexInputState(const hermes::AoS &aos,
+                           GraphicsPipeline::VertexInputState &vertex_input_state,
+                           u32 binding, u32 first_location) {
+  u32 location = first_location;
+  u32 offset = 0;
+  for (const auto &field : aos.fields()) {
+    u32 row_size = componentsPerRow(field.component_count);
+    VkFormat format = vertexAttributeFormat(field.type, row_size);
+    if (format == VK_FORMAT_UNDEFINED) {
+      HERMES_LOG_WARNING("No vertex format for aos field {}.", field.name);
+      return false;
+    }
+    u32 row_bytes = row_size * dataTypeSize(field.type);
+    for (u32 row = 0; row < field.component_count / row_size; ++row) {
+      vertex_input_state.addAttributeDescription(location, binding, format, offset);
+      // 64 bit three and four component formats consume two locations
+      location += row_bytes > 16 ? 2 : 1;
+      offset += row_bytes;
+    }
+  }
+  vertex_input_state.addBindingDescription(binding, offset, VK_VERTEX_INPUT_RATE_VERTEX);
+  return true;
+}
+
 Model::Model() = default;
 
 Model::Model(const LogicalDevice::Ref &device, VkQueue copy_queue, uint32_t queue_family_index) : device_{device} {
@@ -210,6 +299,38 @@ bool Model::loadFromData(const std::vector<float> &vertices,
   return true;
 }
 
+bool Model::loadFromModel(const circe::Model &model, GeometryBuffer &geometry) {
+  const auto &aos = model.data();
+  if (vertexStride(aos) != geometry.vertexStride()) {
+    HERMES_LOG_WARNING("model vertex stride does not match the geometry buffer.");
+    return false;
+  }
+  u32 vertex_count = aos.size();
+  // the GPU reads the (non-negative) i32 indices as u32
+  std::vector<u32> sequential_indices;
+  const u32 *index_data = reinterpret_cast<const u32 *>(model.indices().data());
+  u32 index_count = model.indices().size();
+  if (!index_count) {
+    sequential_indices.resize(vertex_count);
+    std::iota(sequential_indices.begin(), sequential_indices.end(), 0u);
+    index_data = sequential_indices.data();
+    index_count = vertex_count;
+  }
+  GeometryBuffer::Range range;
+  HERMES_RETURN_VALUE_IF_NOT(geometry.allocate(vertex_count, index_count, range), false)
+  HERMES_RETURN_VALUE_IF_NOT(geometry.upload(range, aos.data(), index_data), false)
+  shapes_ = {{range.vertex_base, range.vertex_count, range.index_base, range.index_count}};
+  return true;
+}
+
+void Model::pushDraws(GeometryBuffer &geometry, u32 instance_count, u32 first_instance) const {
+  for (const auto &shape : shapes_)
+    geometry.pushDraw({shape.vertex_base, shape.vertex_count, shape.index_base, shape.index_count},
+                      instance_count, first_instance);
+}
+
+const std::vector<Model::Shape> &Model::shapes() const { return shapes_; }
+
 const Buffer &Model::vertices() const { return vertices_; }
 
 const Buffer &Model::indices() const { return indices_; }
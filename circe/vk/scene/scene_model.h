@@ -30,11 +30,39 @@
 #ifndef CIRCE_VK_SCENE_MODEL_H
 #define CIRCE_VK_SCENE_MODEL_H
 
-#include <circe/vk/storage/device_memory.h>
+#include <circe/vk/scene/geometry_buffer.h>
+#include <circe/vk/pipeline/pipeline.h>
+#include <hermes/storage/array_of_structures.h>
 #include <hermes/common/defs.h>
 
+namespace circe {
+class Model;
+}
+
 namespace circe::vk {
 
+/// Maps a hermes data type to the vertex attribute format with the given
+/// number of components (1 to 4)
+/// \param type
+/// \param component_count
+/// \return VK_FORMAT_UNDEFINED if there is no matching format
+VkFormat vertexAttributeFormat(hermes::DataType type, u32 component_count);
+/// \param aos
+/// \return size in bytes of a single (interleaved) element of aos
+u32 vertexStride(const hermes::AoS &aos);
+/// Describes the interleaved layout of an AoS in the vertex input state of a
+/// graphics pipeline. Fields are mapped to consecutive locations, in order,
+/// matrix fields (9 or 16 components) take one location per row, as in
+/// gl::VertexBuffer.
+/// \param aos
+/// \param vertex_input_state **[out]**
+/// \param binding
+/// \param first_location location of the first field
+/// \return bool false if a field has no matching vertex format
+bool setupVertexInputState(const hermes::AoS &aos,
+                           GraphicsPipeline::VertexInputState &vertex_input_state,
+                           u32 binding = 0, u32 first_location = 0);
+
 /** @brief Vertex layout components */
 typedef enum VertexComponent {
   VERTEX_COMPONENT_POSITION = 0x0,
@@ -148,11 +176,26 @@ public:
   ///\return bool
   bool loadFromData(const std::vector<float> &vertices,
                     const std::vector<u32> &indices);
+  ///\brief Sub-allocates the model geometry from a shared geometry buffer and
+  /// stages its upload (geometry.flush() submits the copies).
+  ///\note Models without indices get sequential indices.
+  ///\param model **[in]** the vertex stride of its data must match geometry's
+  ///\param geometry **[in]**
+  ///\return bool
+  bool loadFromModel(const circe::Model &model, GeometryBuffer &geometry);
+  ///\brief Appends the indirect draw commands of the shapes of this model to
+  /// the geometry buffer it was loaded into.
+  ///\param geometry **[in]**
+  ///\param instance_count **[in]**
+  ///\param first_instance **[in]**
+  void pushDraws(GeometryBuffer &geometry, u32 instance_count = 1,
+                 u32 first_instance = 0) const;
   // ***********************************************************************
   //                            FIELDS
   // ***********************************************************************
   [[nodiscard]] const Buffer &vertices() const;
   [[nodiscard]] const Buffer &indices() const;
+  [[nodiscard]] const std::vector<Shape> &shapes() const;
 
 private:
   LogicalDevice::Ref device_;
@@ -64,6 +64,7 @@ bool Buffer::good() const { return vk_buffer_ != VK_NULL_HANDLE; }
 void Buffer::destroy() {
   if (logical_device_.good() && VK_NULL_HANDLE != vk_buffer_)
     vkDestroyBuffer(logical_device_.handle(), vk_buffer_, nullptr);
+  vk_buffer_ = VK_NULL_HANDLE;
 }
 
 bool Buffer::init(const LogicalDevice::Ref &logical_device, VkDeviceSize size,
@@ -56,12 +56,23 @@ Image::View Image::Ref::view(VkImageViewType view_type, VkFormat format, VkImage
 
 Image::View::View(VkDevice vk_device, VkImage vk_image, VkImageViewType view_type,
                   VkFormat format, VkImageAspectFlags aspect)
+    : View(vk_device, vk_image, view_type, format,
+           {aspect, 0, 1, 0, VK_REMAINING_ARRAY_LAYERS}) {}
+
+Image::View::View(VkDevice vk_device, VkImage vk_image, VkImageViewType view_type,
+                  VkFormat format, const VkImageSubresourceRange &subresource_range,
+                  VkImageUsageFlags usage)
     : vk_image_(vk_image), vk_device_{vk_device} {
   HERMES_VALIDATE_EXP_WITH_WARNING(vk_image_, "using bad image.")
   HERMES_VALIDATE_EXP_WITH_WARNING(vk_device_, "using bad device.")
+  VkImageViewUsageCreateInfoKHR usage_create_info = {
+      VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO_KHR, // VkStructureType sType
+      nullptr, // const void               * pNext
+      usage    // VkImageUsageFlags          usage
+  };
   VkImageViewCreateInfo image_view_create_info = {
       VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO, // VkStructureType sType
-      nullptr,         // const void               * pNext
+      usage ? &usage_create_info : nullptr, // const void * pNext
       0,               // VkImageViewCreateFlags     flags
       vk_image_, // VkImage                    image
       view_type,       // VkImageViewType            viewType
@@ -73,14 +84,8 @@ Image::View::View(VkDevice vk_device, VkImage vk_image, VkImageViewType view_typ
           VK_COMPONENT_SWIZZLE_IDENTITY, // VkComponentSwizzle         b
           VK_COMPONENT_SWIZZLE_IDENTITY  // VkComponentSwizzle         a
       },
-      {
-          // VkImageSubresourceRange    subresourceRange
-          aspect,             // VkImageAspectFlags         aspectMask
-          0,                  // u32                   baseMipLevel
-          1, // u32 levelCount VK_REMAINING_MIP_LEVELS
-          0,                  // u32                   baseArrayLayer
-          VK_REMAINING_ARRAY_LAYERS // u32                   layerCount
-      }};
+      subresource_range // VkImageSubresourceRange    subresourceRange
+  };
 
   CHECK_VULKAN(vkCreateImageView(vk_device_,
                                  &image_view_create_info, nullptr,
@@ -131,6 +136,8 @@ Image::View::~View() {
 }
 
 Image::View &Image::View::operator=(View &&other) noexcept {
+  destroy();
+  vk_image_ = other.vk_image_;
   vk_device_ = other.vk_device_;
   vk_image_view_ = other.vk_image_view_;
   other.vk_image_view_ = VK_NULL_HANDLE;
@@ -154,8 +161,9 @@ Image::Image() = default;
 Image::Image(const LogicalDevice::Ref &logical_device, VkImageType type,
              VkFormat format, VkExtent3D size, u32 num_mipmaps,
              u32 num_layers, VkSampleCountFlagBits samples,
-             VkImageUsageFlags usage_scenarios, bool cubemap) {
-  init(logical_device, type, format, size, num_mipmaps, num_layers, samples, usage_scenarios, cubemap);
+             VkImageUsageFlags usage_scenarios, bool cubemap,
+             VkImageCreateFlags flags) {
+  init(logical_device, type, format, size, num_mipmaps, num_layers, samples, usage_scenarios, cubemap, flags);
 }
 
 Image::Image(Image &&other) noexcept {
@@ -174,6 +182,9 @@ Image &Image::operator=(Image &&other) noexcept {
   format_ = other.format_;
   size_ = other.size_;
   mip_levels_ = other.mip_levels_;
+  layers_ = other.layers_;
+  usage_ = other.usage_;
+  flags_ = other.flags_;
   return *this;
 }
 
@@ -185,7 +196,8 @@ bool Image::init(const LogicalDevice::Ref &logical_device,
                  u32 num_layers,
                  VkSampleCountFlagBits samples,
                  VkImageUsageFlags usage_scenarios,
-                 bool cubemap) {
+                 bool cubemap,
+                 VkImageCreateFlags flags) {
   destroy();
 
 
@@ -193,19 +205,22 @@ bool Image::init(const LogicalDevice::Ref &logical_device,
   format_ = format;
   size_ = size;
   mip_levels_ = num_mipmaps;
+  layers_ = cubemap ? 6 * num_layers : num_layers;
+  usage_ = usage_scenarios;
+  flags_ = flags;
 
   HERMES_VALIDATE_EXP_WITH_WARNING(logical_device_.good(), "using bad device.")
 
   VkImageCreateInfo image_create_info = {
       VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO, // VkStructureType          sType
       nullptr,                             // const void             * pNext
-      cubemap ? VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT
-              : 0u, // VkImageCreateFlags       flags
+      (cubemap ? VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT
+               : 0u) | flags, // VkImageCreateFlags       flags
       type,         // VkImageType              imageType
       format,       // VkFormat                 format
       size,         // VkExtent3D               extent
       mip_levels_,  // u32                 mipLevels
-      cubemap ? 6 * num_layers : num_layers, // u32 arrayLayers
+      layers_,      // u32                 arrayLayers
       samples,                               // VkSampleCountFlagBits    samples
       VK_IMAGE_TILING_OPTIMAL,               // VkImageTiling            tiling
       usage_scenarios,                       // VkImageUsageFlags        usage
@@ -257,12 +272,36 @@ bool Image::memoryRequirements(
 
 u32 Image::mipLevels() const { return mip_levels_; }
 
+u32 Image::layers() const { return layers_; }
+
 VkExtent3D Image::size() const { return size_; }
 
 VkFormat Image::format() const { return format_; }
 
+VkImageUsageFlags Image::usage() const { return usage_; }
+
+VkImageCreateFlags Image::createFlags() const { return flags_; }
+
+VkImageUsageFlags Image::viewUsage(VkFormat v_format) const {
+  if (!(flags_ & VK_IMAGE_CREATE_EXTENDED_USAGE_BIT_KHR) || !(usage_ & VK_IMAGE_USAGE_STORAGE_BIT))
+    return 0;
+  VkFormatProperties format_properties{};
+  if (logical_device_.physicalDevice().formatProperties(v_format, format_properties) &&
+      (format_properties.optimalTilingFeatures & VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT))
+    return 0;
+  return usage_ & ~static_cast<VkImageUsageFlags>(VK_IMAGE_USAGE_STORAGE_BIT);
+}
+
 Image::View Image::view(VkImageViewType view_type, VkFormat v_format, VkImageAspectFlags aspect) const {
-  return Image::View(logical_device_.handle(), vk_image_, view_type, v_format, aspect);
+  return Image::View(logical_device_.handle(), vk_image_, view_type, v_format,
+                     {aspect, 0, 1, 0, VK_REMAINING_ARRAY_LAYERS}, viewUsage(v_format));
+}
+
+Image::View Image::view(VkImageViewType view_type, VkFormat v_format, VkImageAspectFlags aspect,
+                        u32 base_mip_level, u32 level_count,
+                        u32 base_layer, u32 layer_count) const {
+  return Image::View(logical_device_.handle(), vk_image_, view_type, v_format,
+                     {aspect, base_mip_level, level_count, base_layer, layer_count}, viewUsage(v_format));
 }
 
 Image::Ref Image::ref() const {
@@ -77,6 +77,15 @@ public:
     View(VkDevice vk_device, VkImage vk_image,
          VkImageViewType view_type, VkFormat format,
          VkImageAspectFlags aspect);
+    /// Creates a image view of a range of mip levels and layers
+    /// \param view_type **[in]**
+    /// \param format **[in]** data format
+    /// \param subresource_range **[in]** mip levels and layers seen by the view
+    /// \param usage **[in]** usage allowed for the view (0 = image usage)
+    View(VkDevice vk_device, VkImage vk_image,
+         VkImageViewType view_type, VkFormat format,
+         const VkImageSubresourceRange &subresource_range,
+         VkImageUsageFlags usage = 0);
     ///
     /// \param image
     /// \param view_type
@@ -145,10 +154,12 @@ public:
   /// \param samples **[in]** number of samples
   /// \param usage_scenarios **[in]**
   /// \param cubemap **[in]**
+  /// \param flags **[in]** additional create flags (ex:
+  /// VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT)
   Image(const LogicalDevice::Ref &logical_device, VkImageType type, VkFormat format,
         VkExtent3D size, u32 num_mipmaps, u32 num_layers,
         VkSampleCountFlagBits samples, VkImageUsageFlags usage_scenarios,
-        bool cubemap);
+        bool cubemap, VkImageCreateFlags flags = 0);
   Image(const Image &other) = delete;
   Image(Image &&other) noexcept;
   ~Image();
@@ -171,10 +182,12 @@ public:
   /// \param samples **[in]** number of samples
   /// \param usage_scenarios **[in]**
   /// \param cubemap **[in]**
+  /// \param flags **[in]** additional create flags (ex:
+  /// VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT)
   bool init(const LogicalDevice::Ref &logical_device, VkImageType type, VkFormat format,
             VkExtent3D size, u32 num_mipmaps, u32 num_layers,
             VkSampleCountFlagBits samples, VkImageUsageFlags usage_scenarios,
-            bool cubemap);
+            bool cubemap, VkImageCreateFlags flags = 0);
   ///
   void destroy();
   // ***********************************************************************
@@ -186,10 +199,16 @@ public:
   [[nodiscard]] VkImage handle() const;
   ///\return u32 number of mipmap levels
   [[nodiscard]] u32 mipLevels() const;
+  ///\return u32 number of array layers (6 per cube for cubemaps)
+  [[nodiscard]] u32 layers() const;
   ///\return VkExtent3D image dimensions (in texels)
   [[nodiscard]] VkExtent3D size() const;
   ///\return VkFormat
   [[nodiscard]] VkFormat format() const;
+  ///\return VkImageUsageFlags usage given on creation
+  [[nodiscard]] VkImageUsageFlags usage() const;
+  ///\return VkImageCreateFlags flags given on creation
+  [[nodiscard]] VkImageCreateFlags createFlags() const;
   // ***********************************************************************
   //                           QUERIES
   // ***********************************************************************
@@ -220,6 +239,18 @@ public:
   /// \param aspect
   /// \return
   [[nodiscard]] View view(VkImageViewType view_type, VkFormat format, VkImageAspectFlags aspect) const;
+  ///
+  /// \param view_type
+  /// \param format
+  /// \param aspect
+  /// \param base_mip_level first mip level seen by the view
+  /// \param level_count number of mip levels seen by the view
+  /// \param base_layer first layer seen by the view
+  /// \param layer_count number of layers seen by the view
+  /// \return
+  [[nodiscard]] View view(VkImageViewType view_type, VkFormat format, VkImageAspectFlags aspect,
+                          u32 base_mip_level, u32 level_count,
+                          u32 base_layer = 0, u32 layer_count = VK_REMAINING_ARRAY_LAYERS) const;
 
   Image::Ref ref() const;
 
@@ -229,6 +260,15 @@ private:
   VkFormat format_{};
   VkExtent3D size_{};
   u32 mip_levels_{1};
+  u32 layers_{1};
+  VkImageUsageFlags usage_{0};
+  VkImageCreateFlags flags_{0};
+
+  /// Images created with VK_IMAGE_CREATE_EXTENDED_USAGE_BIT may have usages
+  /// that some view formats do not support (ex: storage for sRGB views)
+  /// \param format view format
+  /// \return usage restricted to what format supports (0 = image usage)
+  [[nodiscard]] VkImageUsageFlags viewUsage(VkFormat format) const;
 };
 
 
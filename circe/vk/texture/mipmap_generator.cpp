@@ -0,0 +1,244 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+/// \file mipmap_generator.cpp
+/// \author FilipeCN (filipedecn@gmail.com)
+/// \date 2026-10-19
+///
+/// \brief
+
+
+#include <circe/vk/texture/mipmap_generator.h>
+#include <circe/vk/utils/vk_debug.h>
+#include <algorithm>
+
+namespace circe::vk {
+
+MipmapGenerator::MipmapGenerator() = default;
+
+MipmapGenerator::~MipmapGenerator() {
+  destroy();
+}
+
+bool MipmapGenerator::init(const LogicalDevice::Ref &logical_device, const hermes::Path &shader_file) {
+  destroy();
+  HERMES_VALIDATE_EXP_WITH_WARNING(logical_device.good(), "using bad device.")
+  logical_device_ = logical_device;
+  shader_module_.setDevice(logical_device_);
+  HERMES_LOG_AND_RETURN_VALUE_IF_NOT(shader_module_.load(shader_file.fullName()), false,
+                                     "Could not load downsample shader.")
+  // set 0: level 0, levels 1-12, tile counters, tile texels
+  pipeline_layout_ = PipelineLayout(logical_device_);
+  auto &descriptor_set_layout = pipeline_layout_.descriptorSetLayout(pipeline_layout_.createLayoutSet(0));
+  descriptor_set_layout.addLayoutBinding(0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1,
+                                         VK_SHADER_STAGE_COMPUTE_BIT);
+  descriptor_set_layout.addLayoutBinding(1, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, max_level_count - 1,
+                                         VK_SHADER_STAGE_COMPUTE_BIT);
+  descriptor_set_layout.addLayoutBinding(2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1,
+                                         VK_SHADER_STAGE_COMPUTE_BIT);
+  descriptor_set_layout.addLayoutBinding(3, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1,
+                                         VK_SHADER_STAGE_COMPUTE_BIT);
+  HERMES_RETURN_VALUE_IF_NOT(descriptor_set_layout.init(), false)
+  pipeline_layout_.addPushConstantRange(VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(PushConstants));
+  HERMES_RETURN_VALUE_IF_NOT(pipeline_layout_.init(), false)
+  PipelineShaderStage stage(VK_SHADER_STAGE_COMPUTE_BIT, shader_module_, "main", nullptr, 0);
+  pipeline_ = ComputePipeline(logical_device_, stage, pipeline_layout_.ref());
+  pipeline_.addShaderStage(stage);
+  HERMES_RETURN_VALUE_IF_NOT(pipeline_.init(), false)
+  // level 0 is read with texelFetch
+  return sampler_.init(logical_device_, VK_FILTER_NEAREST, VK_FILTER_NEAREST,
+                       VK_SAMPLER_MIPMAP_MODE_NEAREST,
+                       VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE,
+                       VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE,
+                       VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE,
+                       0.f, VK_FALSE, 1.f, VK_FALSE, VK_COMPARE_OP_NEVER,
+                       0.f, 0.f, VK_BORDER_COLOR_FLOAT_TRANSPARENT_BLACK, VK_FALSE);
+}
+
+void MipmapGenerator::destroy() {
+  pipeline_.destroy();
+  pipeline_layout_.destroy();
+  sampler_.destroy();
+  shader_module_.destroy();
+}
+
+bool MipmapGenerator::good() const {
+  return pipeline_.good();
+}
+
+VkFormat MipmapGenerator::storageFormat(VkFormat format) {
+  switch (format) {
+  case VK_FORMAT_R8_SRGB: return VK_FORMAT_R8_UNORM;
+  case VK_FORMAT_R8G8_SRGB: return VK_FORMAT_R8G8_UNORM;
+  case VK_FORMAT_R8G8B8A8_SRGB: return VK_FORMAT_R8G8B8A8_UNORM;
+  case VK_FORMAT_B8G8R8A8_SRGB: return VK_FORMAT_B8G8R8A8_UNORM;
+  case VK_FORMAT_A8B8G8R8_SRGB_PACK32: return VK_FORMAT_A8B8G8R8_UNORM_PACK32;
+  default: return format;
+  }
+}
+
+VkImageCreateFlags MipmapGenerator::imageCreateFlags(VkFormat format) {
+  if (storageFormat(format) == format)
+    return 0;
+  return VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT | VK_IMAGE_CREATE_EXTENDED_USAGE_BIT_KHR;
+}
+
+bool MipmapGenerator::supports(const Image &image) const {
+  if (!image.good() || !(image.usage() & VK_IMAGE_USAGE_STORAGE_BIT))
+    return false;
+  auto required_flags = imageCreateFlags(image.format());
+  if ((image.createFlags() & required_flags) != required_flags)
+    return false;
+  return supports(image.format(), image.size(), image.mipLevels());
+}
+
+bool MipmapGenerator::supports(VkFormat format, VkExtent3D size, u32 mip_levels) const {
+  if (!good())
+    return false;
+  const auto &features = logical_device_.enabledFeatures();
+  if (!features.shaderStorageImageWriteWithoutFormat || !features.shaderStorageImageArrayDynamicIndexing)
+    return false;
+  // each level is a 2x2 box filter of the previous one, odd sizes (that would
+  // need 3-texel footprints) are left to the blit path
+  auto isPowerOfTwo = [](u32 n) { return n && !(n & (n - 1)); };
+  if (!isPowerOfTwo(size.width) || !isPowerOfTwo(size.height))
+    return false;
+  // the second reduction step covers at most 64x64 tiles of 64x64 texels
+  if (mip_levels > max_level_count || size.depth != 1 || size.width > 4096 || size.height > 4096)
+    return false;
+  // storage usage on a format without storage support (sRGB)
+  if (storageFormat(format) != format && !logical_device_.isExtensionEnabled(VK_KHR_MAINTENANCE2_EXTENSION_NAME))
+    return false;
+  VkFormatProperties format_properties{};
+  if (!logical_device_.physicalDevice().formatProperties(format, format_properties) ||
+      !(format_properties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT))
+    return false;
+  if (!logical_device_.physicalDevice().formatProperties(storageFormat(format), format_properties))
+    return false;
+  return format_properties.optimalTilingFeatures & VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT;
+}
+
+bool MipmapGenerator::generate(const Image &image, u32 queue_family_index, VkQueue queue) {
+  HERMES_VALIDATE_EXP_WITH_WARNING(good(), "using bad mipmap generator.")
+  HERMES_VALIDATE_EXP_WITH_WARNING(queue, "using bad queue.")
+  HERMES_LOG_AND_RETURN_VALUE_IF_NOT(supports(image), false, "Image not supported by mipmap generator.")
+  const u32 layer_count = image.layers();
+  const u32 level_count = image.mipLevels() - 1;
+  PushConstants push_constants{
+      level_count,
+      (image.size().width + 63) / 64,
+      (image.size().height + 63) / 64,
+      storageFormat(image.format()) != image.format()
+  };
+  // views: level 0 (sampled, decodes sRGB) and levels 1-12 (storage), unused
+  // storage slots alias the last level so the descriptor array is fully valid
+  auto source_view = image.view(VK_IMAGE_VIEW_TYPE_2D_ARRAY, image.format(), VK_IMAGE_ASPECT_COLOR_BIT,
+                                0, 1, 0, layer_count);
+  std::vector<Image::View> level_views;
+  for (u32 i = 1; i < max_level_count; ++i)
+    level_views.emplace_back(image.view(VK_IMAGE_VIEW_TYPE_2D_ARRAY, storageFormat(image.format()),
+                                        VK_IMAGE_ASPECT_COLOR_BIT,
+                                        std::min(i, std::max(level_count, 1u)), 1, 0, layer_count));
+  // counters of finished tiles and the reduced texel of each tile, per layer
+  Buffer counters(logical_device_, layer_count * sizeof(u32),
+                  VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+  DeviceMemory counters_memory(counters, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+  HERMES_RETURN_VALUE_IF_NOT(counters_memory.bind(counters), false)
+  Buffer tiles(logical_device_,
+               layer_count * push_constants.tile_count_x * push_constants.tile_count_y * 4 * sizeof(f32),
+               VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+  DeviceMemory tiles_memory(tiles, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+  HERMES_RETURN_VALUE_IF_NOT(tiles_memory.bind(tiles), false)
+  // descriptor set
+  DescriptorPool descriptor_pool(logical_device_, 1);
+  descriptor_pool.setPoolSize(VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1);
+  descriptor_pool.setPoolSize(VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, max_level_count - 1);
+  descriptor_pool.setPoolSize(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 2);
+  std::vector<VkDescriptorSet> descriptor_sets;
+  HERMES_RETURN_VALUE_IF_NOT(descriptor_pool.allocate(pipeline_layout_.descriptorSetLayouts(), descriptor_sets),
+                             false)
+  VkDescriptorImageInfo source_info = {sampler_.handle(), source_view.handle(), VK_IMAGE_LAYOUT_GENERAL};
+  std::vector<VkDescriptorImageInfo> level_infos;
+  for (const auto &view : level_views)
+    level_infos.push_back({VK_NULL_HANDLE, view.handle(), VK_IMAGE_LAYOUT_GENERAL});
+  VkDescriptorBufferInfo counters_info = {counters.handle(), 0, VK_WHOLE_SIZE};
+  VkDescriptorBufferInfo tiles_info = {tiles.handle(), 0, VK_WHOLE_SIZE};
+  std::vector<VkWriteDescriptorSet> writes(4);
+  for (u32 i = 0; i < writes.size(); ++i) {
+    writes[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    writes[i].dstSet = descriptor_sets[0];
+    writes[i].dstBinding = i;
+    writes[i].dstArrayElement = 0;
+    writes[i].descriptorCount = 1;
+  }
+  writes[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+  writes[0].pImageInfo = &source_info;
+  writes[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+  writes[1].descriptorCount = level_infos.size();
+  writes[1].pImageInfo = level_infos.data();
+  writes[2].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+  writes[2].pBufferInfo = &counters_info;
+  writes[3].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+  writes[3].pBufferInfo = &tiles_info;
+  vkUpdateDescriptorSets(logical_device_.handle(), writes.size(), writes.data(), 0, nullptr);
+
+  CommandPool::submitCommandBuffer(
+      logical_device_, queue_family_index, queue, [&](CommandBuffer &cb) {
+        // level 0 keeps its contents, the other levels are discarded
+        ImageMemoryBarrier barrier(image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL);
+        auto &vk_barrier = barrier.handle();
+        vk_barrier.subresourceRange.levelCount = 1;
+        vk_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        vk_barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        cb.transitionImageLayout(barrier, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                 VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+        vk_barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        vk_barrier.subresourceRange.baseMipLevel = 1;
+        vk_barrier.subresourceRange.levelCount = level_count;
+        vk_barrier.srcAccessMask = 0;
+        vk_barrier.dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        cb.transitionImageLayout(barrier, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                                 VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+        cb.fill(counters, 0u);
+        VkMemoryBarrier fill_barrier = {VK_STRUCTURE_TYPE_MEMORY_BARRIER, nullptr,
+                                        VK_ACCESS_TRANSFER_WRITE_BIT,
+                                        VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT};
+        vkCmdPipelineBarrier(cb.handle(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                             0, 1, &fill_barrier, 0, nullptr, 0, nullptr);
+        // a single dispatch for all levels and layers
+        cb.bind(pipeline_);
+        cb.bind(VK_PIPELINE_BIND_POINT_COMPUTE, &pipeline_layout_, 0, descriptor_sets);
+        cb.pushConstants(pipeline_layout_, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(PushConstants),
+                         &push_constants);
+        cb.dispatch(push_constants.tile_count_x, push_constants.tile_count_y, layer_count);
+        vk_barrier.oldLayout = VK_IMAGE_LAYOUT_GENERAL;
+        vk_barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        vk_barrier.subresourceRange.baseMipLevel = 0;
+        vk_barrier.subresourceRange.levelCount = image.mipLevels();
+        vk_barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        vk_barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        cb.transitionImageLayout(barrier, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                 VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+      });
+  return true;
+}
+
+} // namespace circe::vk
@@ -0,0 +1,135 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+/// \file mipmap_generator.h
+/// \author FilipeCN (filipedecn@gmail.com)
+/// \date 2026-10-19
+///
+/// \brief
+
+
+#ifndef CIRCE_VK_TEXTURE_MIPMAP_GENERATOR_H
+#define CIRCE_VK_TEXTURE_MIPMAP_GENERATOR_H
+
+#include <circe/vk/pipeline/command_buffer.h>
+#include <circe/vk/texture/sampler.h>
+
+namespace circe::vk {
+
+/// Generates the mip chain of images with a single compute dispatch.
+/// Based on the single pass downsampler idea: each workgroup reduces a 64x64
+/// tile of level 0 into the next 6 levels using shared memory, and the last
+/// workgroup of each layer reduces the tiles into the remaining levels (up to
+/// 12 levels, 4096x4096 images). All layers are processed by the same
+/// dispatch.
+/// Differently from the blit path, the format only needs to support storage
+/// images, and filtering is always performed in linear space. sRGB images are
+/// written through a UNORM view, so they must be created with
+/// VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT and VK_IMAGE_CREATE_EXTENDED_USAGE_BIT
+/// (sRGB formats do not support storage), which needs VK_KHR_maintenance2
+/// enabled on the device.
+/// \note The compute shader (circe/vk/shaders/downsample.comp) writes storage
+/// images without format qualifier and indexes an array of storage images, so
+/// the device must be created with the shaderStorageImageWriteWithoutFormat and
+/// shaderStorageImageArrayDynamicIndexing features.
+/// \note Only power of two sizes are supported (not necessarily square).
+/// \note Images need VK_IMAGE_USAGE_SAMPLED_BIT, VK_IMAGE_USAGE_STORAGE_BIT and
+/// the create flags given by imageCreateFlags().
+/// \code{.cpp}
+///     if (generator.supports(format, size, mip_levels)) {
+///       usage |= VK_IMAGE_USAGE_STORAGE_BIT;
+///       flags |= MipmapGenerator::imageCreateFlags(format);
+///     }
+/// \endcode
+class MipmapGenerator {
+public:
+  /// maximum number of levels (including level 0) generated by a dispatch
+  static constexpr u32 max_level_count = 13;
+  // ***********************************************************************
+  //                           CONSTRUCTORS
+  // ***********************************************************************
+  MipmapGenerator();
+  MipmapGenerator(const MipmapGenerator &other) = delete;
+  ~MipmapGenerator();
+  // ***********************************************************************
+  //                           OPERATORS
+  // ***********************************************************************
+  MipmapGenerator &operator=(const MipmapGenerator &other) = delete;
+  // ***********************************************************************
+  //                            CREATION
+  // ***********************************************************************
+  /// \param logical_device
+  /// \param shader_file SPIR-V of circe/vk/shaders/downsample.comp (built into
+  /// CIRCE_VK_SHADERS_PATH "/downsample.comp.spv" when glslc is available)
+  /// \return bool true if success
+  bool init(const LogicalDevice::Ref &logical_device, const hermes::Path &shader_file);
+  ///
+  void destroy();
+  /// \return true if init succeeded
+  [[nodiscard]] bool good() const;
+  // ***********************************************************************
+  //                           METHODS
+  // ***********************************************************************
+  /// \param image
+  /// \return true if the mip chain of image can be generated by this generator
+  /// (power of two size, supported format, required device features, usage
+  /// and create flags)
+  [[nodiscard]] bool supports(const Image &image) const;
+  /// Checks an image before its creation
+  /// \param format
+  /// \param size level 0 size
+  /// \param mip_levels
+  /// \return true if the mip chain of such an image can be generated by this
+  /// generator (when created with storage usage and imageCreateFlags(format))
+  [[nodiscard]] bool supports(VkFormat format, VkExtent3D size, u32 mip_levels) const;
+  /// Generates levels 1 to image.mipLevels() - 1 of all layers from level 0.
+  /// \note Level 0 is expected in VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, all
+  /// levels end in VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL.
+  /// \param image
+  /// \param queue_family_index
+  /// \param queue
+  /// \return bool true if success
+  bool generate(const Image &image, u32 queue_family_index, VkQueue queue);
+  /// \param format
+  /// \return the format used to write into images of the given format
+  static VkFormat storageFormat(VkFormat format);
+  /// \param format
+  /// \return create flags required by images of the given format
+  static VkImageCreateFlags imageCreateFlags(VkFormat format);
+
+private:
+  struct PushConstants {
+    u32 level_count;
+    u32 tile_count_x;
+    u32 tile_count_y;
+    u32 srgb;
+  };
+
+  LogicalDevice::Ref logical_device_;
+  ShaderModule shader_module_;
+  PipelineLayout pipeline_layout_;
+  ComputePipeline pipeline_;
+  Sampler sampler_;
+};
+
+} // namespace circe::vk
+
+#endif // CIRCE_VK_TEXTURE_MIPMAP_GENERATOR_H
@@ -38,7 +38,7 @@ Texture::Texture() = default;
 
 Texture::Texture(const LogicalDevice::Ref &logical_device,
                  const std::string &filename, uint32_t queue_family_index,
-                 VkQueue queue)
+                 VkQueue queue, MipmapGenerator *mipmap_generator)
     : logical_device_(logical_device) {
   HERMES_VALIDATE_EXP_WITH_WARNING(logical_device_.good(), "using bad device.");
   HERMES_VALIDATE_EXP_WITH_WARNING(queue, "using bad queue.");
@@ -53,60 +53,34 @@ Texture::Texture(const LogicalDevice::Ref &logical_device,
   uint32_t
       mip_levels = static_cast<uint32_t>(std::floor(std::log2((tex_width > tex_height) ? tex_width : tex_height))) + 1;
   VkDeviceSize image_size = tex_width * tex_height * 4;
-
-  Buffer staging_buffer(logical_device_, image_size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
-  DeviceMemory staging_buffer_memory(staging_buffer, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
-      VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-  staging_buffer_memory.bind(staging_buffer);
-  staging_buffer_memory.copy(pixels, staging_buffer.size());
-  stbi_image_free(pixels);
   // Allocate image data on device
   VkExtent3D size = {};
   size.width = tex_width;
   size.height = tex_height;
   size.depth = 1;
+  VkImageUsageFlags usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT |
+      VK_IMAGE_USAGE_SAMPLED_BIT;
+  VkImageCreateFlags flags = 0;
+  if (mipmap_generator && mipmap_generator->supports(tex_image_format, size, mip_levels)) {
+    // sRGB levels are written through a UNORM view
+    usage |= VK_IMAGE_USAGE_STORAGE_BIT;
+    flags |= MipmapGenerator::imageCreateFlags(tex_image_format);
+  }
   image_.init(logical_device_, VK_IMAGE_TYPE_2D, tex_image_format, size, mip_levels, 1,
-              VK_SAMPLE_COUNT_1_BIT,
-              VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT |
-                  VK_IMAGE_USAGE_SAMPLED_BIT, false);
-  image_memory_ = DeviceMemory(image_, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-  image_memory_.bind(image_);
-  // copy data to device
-  CommandPool::submitCommandBuffer(
-      logical_device_, queue_family_index, queue, [&](CommandBuffer &cb) {
-        ImageMemoryBarrier barrier(image_, VK_IMAGE_LAYOUT_UNDEFINED,
-                                   VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
-        cb.transitionImageLayout(barrier, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-                                 VK_PIPELINE_STAGE_TRANSFER_BIT);
-        VkBufferImageCopy region = {};
-        region.bufferOffset = 0;
-        region.bufferRowLength = 0;
-        region.bufferImageHeight = 0;
-        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-        region.imageSubresource.mipLevel = 0;
-        region.imageSubresource.baseArrayLayer = 0;
-        region.imageSubresource.layerCount = 1;
-        region.imageOffset = {0, 0, 0};
-        region.imageExtent = {size.width, size.height, 1};
-        cb.copy(staging_buffer, image_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, {region});
-        // ImageMemoryBarrier after_barrier(
-        //     *image_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-        //     VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
-        // cb.transitionImageLayout(after_barrier,
-        // VK_PIPELINE_STAGE_TRANSFER_BIT,
-        //                          VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
-      });
-  generateMipmaps(queue, queue_family_index);
+              VK_SAMPLE_COUNT_1_BIT, usage, false, flags);
+  upload(pixels, image_size, queue_family_index, queue, mipmap_generator);
+  stbi_image_free(pixels);
 }
 
 Texture::Texture(const LogicalDevice::Ref &logical_device, VkImageType type,
                  VkFormat format, VkExtent3D size, uint32_t num_mipmaps,
                  uint32_t num_layers, VkSampleCountFlagBits samples,
-                 VkImageUsageFlags usage_scenarios, bool cubemap)
+                 VkImageUsageFlags usage_scenarios, bool cubemap,
+                 VkImageCreateFlags flags)
     : logical_device_(logical_device) {
   HERMES_VALIDATE_EXP_WITH_WARNING(logical_device_.good(), "using bad device.")
   image_.init(logical_device_, type, format, size, num_mipmaps,
-              num_layers, samples, usage_scenarios, cubemap);
+              num_layers, samples, usage_scenarios, cubemap, flags);
 }
 
 Texture::Texture(Texture &&other) noexcept {
@@ -175,9 +149,59 @@ void Texture::setData(const unsigned char *data, uint32_t queue_family_index,
                                  VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
       });
 }
+
+bool Texture::upload(const void *data, VkDeviceSize size, u32 queue_family_index,
+                     VkQueue queue, MipmapGenerator *mipmap_generator) {
+  HERMES_VALIDATE_EXP_WITH_WARNING(logical_device_.good(), "using bad device.")
+  HERMES_VALIDATE_EXP_WITH_WARNING(image_.good(), "using bad image.")
+  HERMES_VALIDATE_EXP_WITH_WARNING(queue, "using bad queue.")
+  Buffer staging_buffer(logical_device_, size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+  DeviceMemory staging_buffer_memory(staging_buffer, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+      VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+  HERMES_RETURN_VALUE_IF_NOT(staging_buffer_memory.bind(staging_buffer), false)
+  HERMES_RETURN_VALUE_IF_NOT(staging_buffer_memory.copy(data, size), false)
+  if (!image_memory_.good()) {
+    image_memory_ = DeviceMemory(image_, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    HERMES_RETURN_VALUE_IF_NOT(image_memory_.bind(image_), false)
+  }
+  // copy data to device, all layers in a single region
+  CommandPool::submitCommandBuffer(
+      logical_device_, queue_family_index, queue, [&](CommandBuffer &cb) {
+        ImageMemoryBarrier barrier(image_, VK_IMAGE_LAYOUT_UNDEFINED,
+                                   VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+        cb.transitionImageLayout(barrier, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                                 VK_PIPELINE_STAGE_TRANSFER_BIT);
+        VkBufferImageCopy region = {};
+        region.bufferOffset = 0;
+        region.bufferRowLength = 0;
+        region.bufferImageHeight = 0;
+        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.mipLevel = 0;
+        region.imageSubresource.baseArrayLayer = 0;
+        region.imageSubresource.layerCount = image_.layers();
+        region.imageOffset = {0, 0, 0};
+        region.imageExtent = image_.size();
+        cb.copy(staging_buffer, image_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, {region});
+        if (image_.mipLevels() == 1) {
+          ImageMemoryBarrier after_barrier(
+              image_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+              VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+          cb.transitionImageLayout(after_barrier, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                   VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+        }
+      });
+  if (image_.mipLevels() > 1)
+    generateMipmaps(queue, queue_family_index, mipmap_generator);
+  return true;
+}
+
 const Image *Texture::image() const { return &image_; }
 
-void Texture::generateMipmaps(VkQueue queue, uint32_t queue_family_index) {
+void Texture::generateMipmaps(VkQueue queue, uint32_t queue_family_index,
+                              MipmapGenerator *mipmap_generator) {
+  if (mipmap_generator && mipmap_generator->supports(image_) &&
+      mipmap_generator->generate(image_, queue_family_index, queue))
+    return;
   // check first if we have support for the blit command:
   VkFormatProperties format_properties;
   logical_device_.physicalDevice().formatProperties(image_.format(), format_properties);
@@ -200,7 +224,7 @@ void Texture::generateMipmaps(VkQueue queue, uint32_t queue_family_index) {
         vk_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
         vk_barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
         vk_barrier.subresourceRange.baseArrayLayer = 0;
-        vk_barrier.subresourceRange.layerCount = 1;
+        vk_barrier.subresourceRange.layerCount = image_.layers();
         vk_barrier.subresourceRange.levelCount = 1;
 
         int32_t mip_width = image_.size().width;
@@ -221,14 +245,14 @@ void Texture::generateMipmaps(VkQueue queue, uint32_t queue_family_index) {
           blit.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
           blit.srcSubresource.mipLevel = i - 1;
           blit.srcSubresource.baseArrayLayer = 0;
-          blit.srcSubresource.layerCount = 1;
+          blit.srcSubresource.layerCount = image_.layers();
           blit.dstOffsets[0] = {0, 0, 0};
           blit.dstOffsets[1] = {mip_width > 1 ? mip_width / 2 : 1,
                                 mip_height > 1 ? mip_height / 2 : 1, 1};
           blit.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
           blit.dstSubresource.mipLevel = i;
           blit.dstSubresource.baseArrayLayer = 0;
-          blit.dstSubresource.layerCount = 1;
+          blit.dstSubresource.layerCount = image_.layers();
           // record command
           cb.blit(image_, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, image_,
                   VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, {blit},
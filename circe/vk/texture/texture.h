@@ -29,6 +29,7 @@
 #define CIRCE_VK_TEXTURE_IMAGE_H
 
 #include <circe/vk/storage/device_memory.h>
+#include <circe/vk/texture/mipmap_generator.h>
 #include <string>
 #include <memory>
 
@@ -45,9 +46,11 @@ public:
   /// \param filename
   /// \param queue_family_index
   /// \param queue
+  /// \param mipmap_generator (optional) generates the mip chain with a compute
+  /// dispatch instead of blits
   explicit Texture(const LogicalDevice::Ref &logical_device,
                    const std::string &filename, uint32_t queue_family_index,
-                   VkQueue queue);
+                   VkQueue queue, MipmapGenerator *mipmap_generator = nullptr);
   /// \param logical_device **[in]** logical device (on which the image
   /// will be created)
   /// \param type **[in]** number of dimensions of the image
@@ -59,10 +62,12 @@ public:
   /// \param samples **[in]** number of samples
   /// \param usage_scenarios **[in]**
   /// \param cubemap **[in]**
+  /// \param flags **[in]** additional image create flags
   Texture(const LogicalDevice::Ref &logical_device, VkImageType type,
           VkFormat format, VkExtent3D size, uint32_t num_mipmaps,
           uint32_t num_layers, VkSampleCountFlagBits samples,
-          VkImageUsageFlags usage_scenarios, bool cubemap);
+          VkImageUsageFlags usage_scenarios, bool cubemap,
+          VkImageCreateFlags flags = 0);
   Texture(const Texture& other) = delete;
   Texture(Texture&& other) noexcept;
   virtual ~Texture();
@@ -78,15 +83,32 @@ public:
   [[nodiscard]] bool good() const;
   void setData(const unsigned char *data, uint32_t queue_family_index,
                VkQueue queue);
+  /// Uploads level 0 of all layers and generates the remaining mip levels.
+  /// Memory is allocated on the first call.
+  /// \note Layers are expected tightly packed, one after the other. The image
+  /// ends in VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL.
+  /// \param data **[in]** level 0 texels of all layers
+  /// \param size **[in]** data size in bytes
+  /// \param queue_family_index **[in]**
+  /// \param queue **[in]**
+  /// \param mipmap_generator **[in]** (optional) compute mip chain generator
+  /// \return bool true if success
+  bool upload(const void *data, VkDeviceSize size, u32 queue_family_index,
+              VkQueue queue, MipmapGenerator *mipmap_generator = nullptr);
+  /// Generates the mip chain of all layers from level 0 (in
+  /// VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL). The compute generator is used when
+  /// given and compatible with the image, otherwise levels are blitted.
+  ///\param queue **[in]**
+  ///\param queue_family_index **[in]**
+  ///\param mipmap_generator **[in]** (optional)
+  void generateMipmaps(VkQueue queue, uint32_t queue_family_index,
+                       MipmapGenerator *mipmap_generator = nullptr);
   // ***********************************************************************
   //                           FIELDS
   // ***********************************************************************
   [[nodiscard]] const Image *image() const;
 
 private:
-  ///\param queue **[in]**
-  ///\param queue_family_index **[in]**
-  void generateMipmaps(VkQueue queue, uint32_t queue_family_index);
   LogicalDevice::Ref logical_device_;
   Image image_;
   DeviceMemory image_memory_;
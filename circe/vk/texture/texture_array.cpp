@@ -0,0 +1,97 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+/// \file texture_array.cpp
+/// \author FilipeCN (filipedecn@gmail.com)
+/// \date 2026-10-19
+///
+/// \brief
+
+
+#include <circe/vk/texture/texture_array.h>
+#include <circe/vk/utils/vk_debug.h>
+#include <stb_image.h>
+#include <cmath>
+
+namespace circe::vk {
+
+TextureArray::TextureArray() = default;
+
+TextureArray::~TextureArray() = default;
+
+bool TextureArray::add(const std::string &filename) {
+  int width, height, channels;
+  stbi_uc *pixels = stbi_load(filename.c_str(), &width, &height, &channels, STBI_rgb_alpha);
+  if (!pixels) {
+    HERMES_LOG_WARNING("could not load texture image file {}", filename);
+    return false;
+  }
+  bool success = add(pixels, width, height);
+  stbi_image_free(pixels);
+  return success;
+}
+
+bool TextureArray::add(const u8 *rgba, u32 width, u32 height) {
+  if (!layer_count_) {
+    width_ = width;
+    height_ = height;
+  } else if (width != width_ || height != height_) {
+    HERMES_LOG_WARNING("texture array layers must have the same size.");
+    return false;
+  }
+  data_.insert(data_.end(), rgba, rgba + static_cast<size_t>(width) * height * 4);
+  layer_count_++;
+  return true;
+}
+
+bool TextureArray::build(const LogicalDevice::Ref &logical_device, u32 queue_family_index, VkQueue queue,
+                         Texture &texture, MipmapGenerator *mipmap_generator,
+                         VkFormat format, bool mipmaps) const {
+  HERMES_VALIDATE_EXP_WITH_WARNING(logical_device.good(), "using bad device.")
+  HERMES_VALIDATE_EXP_WITH_WARNING(layer_count_, "empty texture array.")
+  u32 mip_levels = 1;
+  if (mipmaps)
+    mip_levels = static_cast<u32>(std::floor(std::log2(std::max(width_, height_)))) + 1;
+  VkImageUsageFlags usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT |
+      VK_IMAGE_USAGE_SAMPLED_BIT;
+  VkImageCreateFlags flags = 0;
+  if (mipmap_generator && mip_levels > 1 &&
+      mipmap_generator->supports(format, {width_, height_, 1}, mip_levels)) {
+    usage |= VK_IMAGE_USAGE_STORAGE_BIT;
+    flags |= MipmapGenerator::imageCreateFlags(format);
+  }
+  texture = Texture(logical_device, VK_IMAGE_TYPE_2D, format, {width_, height_, 1}, mip_levels,
+                    layer_count_, VK_SAMPLE_COUNT_1_BIT, usage, false, flags);
+  return texture.upload(data_.data(), data_.size(), queue_family_index, queue, mipmap_generator);
+}
+
+void TextureArray::clear() {
+  data_.clear();
+  layer_count_ = width_ = height_ = 0;
+}
+
+u32 TextureArray::layerCount() const { return layer_count_; }
+
+u32 TextureArray::width() const { return width_; }
+
+u32 TextureArray::height() const { return height_; }
+
+} // namespace circe::vk
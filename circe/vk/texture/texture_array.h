@@ -0,0 +1,97 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+/// \file texture_array.h
+/// \author FilipeCN (filipedecn@gmail.com)
+/// \date 2026-10-19
+///
+/// \brief
+
+
+#ifndef CIRCE_VK_TEXTURE_TEXTURE_ARRAY_H
+#define CIRCE_VK_TEXTURE_TEXTURE_ARRAY_H
+
+#include <circe/vk/texture/texture.h>
+
+namespace circe::vk {
+
+/// Packs many same-sized RGBA8 images into the layers of a single texture.
+/// All layers share one image, one allocation and one descriptor, are
+/// uploaded with a single copy and get their mip chains generated together.
+/// \code{.cpp}
+///     TextureArray builder;
+///     for (const auto &filename : filenames)
+///       builder.add(filename);
+///     Texture albedos;
+///     builder.build(device.ref(), family_index, queue, albedos, &mipmap_generator);
+///     // sample it as sampler2DArray with the layer index
+/// \endcode
+class TextureArray {
+public:
+  // ***********************************************************************
+  //                           CONSTRUCTORS
+  // ***********************************************************************
+  TextureArray();
+  ~TextureArray();
+  // ***********************************************************************
+  //                           METHODS
+  // ***********************************************************************
+  /// Loads an image file into a new layer
+  /// \param filename
+  /// \return bool false if the file could not be read or has a different size
+  bool add(const std::string &filename);
+  /// Appends a new layer
+  /// \param rgba width * height texels (4 bytes each)
+  /// \param width
+  /// \param height
+  /// \return bool false if the size differs from the other layers
+  bool add(const u8 *rgba, u32 width, u32 height);
+  /// Creates a texture containing all layers added so far
+  /// \param logical_device
+  /// \param queue_family_index
+  /// \param queue
+  /// \param texture **[out]**
+  /// \param mipmap_generator (optional) compute mip chain generator
+  /// \param format texel format (VK_FORMAT_R8G8B8A8_SRGB or VK_FORMAT_R8G8B8A8_UNORM)
+  /// \param mipmaps generate the full mip chain
+  /// \return bool true if success
+  bool build(const LogicalDevice::Ref &logical_device, u32 queue_family_index, VkQueue queue,
+             Texture &texture, MipmapGenerator *mipmap_generator = nullptr,
+             VkFormat format = VK_FORMAT_R8G8B8A8_SRGB, bool mipmaps = true) const;
+  /// Removes all layers
+  void clear();
+  // ***********************************************************************
+  //                            FIELDS
+  // ***********************************************************************
+  [[nodiscard]] u32 layerCount() const;
+  [[nodiscard]] u32 width() const;
+  [[nodiscard]] u32 height() const;
+
+private:
+  u32 width_{0};
+  u32 height_{0};
+  u32 layer_count_{0};
+  std::vector<u8> data_; //!< level 0 texels, layer after layer
+};
+
+} // namespace circe::vk
+
+#endif // CIRCE_VK_TEXTURE_TEXTURE_ARRAY_H
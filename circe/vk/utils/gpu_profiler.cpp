@@ -0,0 +1,185 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+/// \file gpu_profiler.cpp
+/// \author FilipeCN (filipedecn@gmail.com)
+/// \date 2026-10-19
+///
+/// \brief
+
+#include <circe/vk/utils/gpu_profiler.h>
+#include <circe/vk/utils/vk_debug.h>
+#include <algorithm>
+
+namespace circe::vk {
+
+GpuProfiler::Scope::Scope(GpuProfiler &profiler, const CommandBuffer &command_buffer,
+                          u32 frame_index, const std::string &name, u32 color)
+    : profiler_(profiler), command_buffer_(command_buffer), frame_index_(frame_index) {
+  scope_id_ = profiler_.beginScope(command_buffer_, frame_index_, name, color);
+}
+
+GpuProfiler::Scope::~Scope() {
+  profiler_.endScope(command_buffer_, frame_index_, scope_id_);
+}
+
+GpuProfiler::GpuProfiler() = default;
+
+GpuProfiler::~GpuProfiler() {
+  destroy();
+}
+
+bool GpuProfiler::init(const LogicalDevice::Ref &logical_device, u32 frame_count,
+                       u32 max_scopes_per_frame, u32 queue_family_index) {
+  destroy();
+  HERMES_VALIDATE_EXP_WITH_WARNING(logical_device.good(), "using bad device.")
+  logical_device_ = logical_device;
+  const auto &limits = logical_device_.physicalDevice().properties().limits;
+  HERMES_VALIDATE_EXP_WITH_WARNING(limits.timestampComputeAndGraphics,
+                                   "device may not support timestamps on all queues.")
+  timestamp_period_ = limits.timestampPeriod;
+  const auto &queue_families = logical_device_.physicalDevice().queueFamilyProperties();
+  HERMES_VALIDATE_EXP_WITH_WARNING(queue_family_index < queue_families.size(), "invalid queue family index.")
+  u32 valid_bits = queue_families[queue_family_index].timestampValidBits;
+  HERMES_VALIDATE_EXP_WITH_WARNING(valid_bits, "queue family does not support timestamps.")
+  timestamp_mask_ = valid_bits >= 64 ? ~0ull : (1ull << valid_bits) - 1;
+  max_scopes_per_frame_ = max_scopes_per_frame;
+  frames_.resize(frame_count);
+  VkQueryPoolCreateInfo info = {
+      VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO, // VkStructureType sType
+      nullptr,                   // const void                    * pNext
+      0,                         // VkQueryPoolCreateFlags          flags
+      VK_QUERY_TYPE_TIMESTAMP,   // VkQueryType                     queryType
+      2 * max_scopes_per_frame,  // u32                             queryCount
+      0                          // VkQueryPipelineStatisticFlags   pipelineStatistics
+  };
+  for (auto &frame : frames_)
+    R_CHECK_VULKAN(vkCreateQueryPool(logical_device_.handle(), &info, nullptr,
+                                     &frame.vk_query_pool), false)
+  return true;
+}
+
+void GpuProfiler::destroy() {
+  for (auto &frame : frames_)
+    if (logical_device_.good() && frame.vk_query_pool != VK_NULL_HANDLE)
+      vkDestroyQueryPool(logical_device_.handle(), frame.vk_query_pool, nullptr);
+  frames_.clear();
+  blocks_.clear();
+}
+
+bool GpuProfiler::good() const {
+  return !frames_.empty() && frames_[0].vk_query_pool != VK_NULL_HANDLE;
+}
+
+void GpuProfiler::reset(const CommandBuffer &command_buffer, u32 frame_index) {
+  HERMES_VALIDATE_EXP_WITH_WARNING(frame_index < frames_.size(), "invalid frame index.")
+  auto &frame = frames_[frame_index];
+  frame.scopes.clear();
+  frame.depth = 0;
+  vkCmdResetQueryPool(command_buffer.handle(), frame.vk_query_pool, 0, 2 * max_scopes_per_frame_);
+}
+
+u32 GpuProfiler::beginScope(const CommandBuffer &command_buffer, u32 frame_index,
+                            const std::string &name, u32 color) {
+  auto &frame = frames_[frame_index];
+  if (frame.scopes.size() >= max_scopes_per_frame_) {
+    HERMES_LOG_WARNING("gpu profiler: too many scopes in a single frame.");
+    return max_scopes_per_frame_;
+  }
+  u32 id = frame.scopes.size();
+  frame.scopes.push_back({name, color, frame.depth++, false});
+  vkCmdWriteTimestamp(command_buffer.handle(), VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                      frame.vk_query_pool, 2 * id);
+  return id;
+}
+
+void GpuProfiler::endScope(const CommandBuffer &command_buffer, u32 frame_index, u32 scope_id) {
+  auto &frame = frames_[frame_index];
+  if (scope_id >= frame.scopes.size())
+    return;
+  frame.scopes[scope_id].closed = true;
+  frame.depth--;
+  vkCmdWriteTimestamp(command_buffer.handle(), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                      frame.vk_query_pool, 2 * scope_id + 1);
+}
+
+bool GpuProfiler::resolve(u32 frame_index) {
+  HERMES_VALIDATE_EXP_WITH_WARNING(frame_index < frames_.size(), "invalid frame index.")
+  auto &frame = frames_[frame_index];
+  u64 previous_anchor = frame.cpu_anchor;
+  // results of the next submission of this slot will be anchored here
+  frame.cpu_anchor = hermes::profiler::now();
+  if (frame.scopes.empty() || !previous_anchor)
+    return false;
+  // each query yields its value followed by its availability, VK_NOT_READY
+  // only means that some of them are not available
+  u32 query_count = 2 * frame.scopes.size();
+  std::vector<u64> results(2 * query_count, 0);
+  VkResult result = vkGetQueryPoolResults(logical_device_.handle(), frame.vk_query_pool,
+                                          0, query_count, results.size() * sizeof(u64),
+                                          results.data(), 2 * sizeof(u64),
+                                          VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+  if (result != VK_SUCCESS && result != VK_NOT_READY)
+    return false;
+  // a region is usable when it was closed and both of its timestamps landed
+  auto available = [&](u32 scope_id) {
+    return frame.scopes[scope_id].closed && results[4 * scope_id + 1] && results[4 * scope_id + 3];
+  };
+  auto timestamp = [&](u32 query) { return results[2 * query] & timestamp_mask_; };
+  // regions begin in recording order, the first available one is the origin
+  u32 first = 0;
+  while (first < frame.scopes.size() && !available(first))
+    first++;
+  if (first == frame.scopes.size())
+    return false;
+  u64 gpu_origin = timestamp(2 * first);
+  auto to_ticks = [&](u64 t) -> u64 {
+    // differences are taken modulo the valid bits (timestamps may wrap)
+    u64 delta = (t - gpu_origin) & timestamp_mask_;
+    auto ns = static_cast<u64>(static_cast<f64>(delta) * timestamp_period_);
+    return previous_anchor + hermes::profiler::ns2ticks(ns);
+  };
+  for (u32 i = 0; i < frame.scopes.size(); ++i) {
+    if (!available(i))
+      continue;
+    const auto &scope = frame.scopes[i];
+    blocks_.push_back({scope.name, to_ticks(timestamp(2 * i)), to_ticks(timestamp(2 * i + 1)),
+                       scope.level, scope.color});
+  }
+  while (blocks_.size() > max_block_count_)
+    blocks_.pop_front();
+  return true;
+}
+
+void GpuProfiler::iterateBlocks(const std::function<void(const HProfiler::TrackBlock &)> &f) const {
+  for (const auto &block : blocks_)
+    f(block);
+}
+
+void GpuProfiler::setMaxBlockCount(size_t max_block_count) {
+  max_block_count_ = max_block_count;
+}
+
+const std::deque<HProfiler::TrackBlock> &GpuProfiler::blocks() const {
+  return blocks_;
+}
+
+} // namespace circe::vk
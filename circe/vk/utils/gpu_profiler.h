@@ -0,0 +1,175 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+/// \file gpu_profiler.h
+/// \author FilipeCN (filipedecn@gmail.com)
+/// \date 2026-10-19
+///
+/// \brief
+
+#ifndef CIRCE_VK_UTILS_GPU_PROFILER_H
+#define CIRCE_VK_UTILS_GPU_PROFILER_H
+
+#include <circe/vk/pipeline/command_buffer.h>
+#include <circe/ui/imgui_profiler.h>
+#include <deque>
+
+namespace circe::vk {
+
+/// Measures GPU execution time of command buffer regions with timestamp
+/// queries.
+/// Each frame slot (usually one per swapchain image, or per frame in flight)
+/// owns a VkQueryPool. Results of a frame slot are only read when the slot is
+/// about to be reused, when the fence of its previous submission has already
+/// been waited, so the host never stalls on queries. Resolved blocks are
+/// converted to hermes::profiler ticks and can be shown as an extra HProfiler
+/// track:
+/// \code{.cpp}
+///     gpu_profiler.init(device.ref(), swapchain_image_count);
+///     hprofiler.addTrack("GPU", [&](const auto &f) { gpu_profiler.iterateBlocks(f); });
+///     // RenderEngine::prepare_frame_callback
+///     gpu_profiler.resolve(image_index);
+///     // RenderEngine::record_command_buffer_callback
+///     gpu_profiler.reset(cb, image_index);
+///     {
+///       CIRCE_VK_GPU_SCOPE(gpu_profiler, cb, image_index, "shadows", color);
+///       ...
+///     }
+/// \endcode
+/// \note GPU and CPU clocks are not calibrated against each other: the first
+/// timestamp of a frame slot is aligned to the CPU time of the resolve() call
+/// that preceded its submission.
+class GpuProfiler {
+public:
+  /// RAII helper that writes the begin/end timestamps of a region
+  class Scope {
+  public:
+    Scope(GpuProfiler &profiler, const CommandBuffer &command_buffer, u32 frame_index,
+          const std::string &name, u32 color);
+    ~Scope();
+  private:
+    GpuProfiler &profiler_;
+    const CommandBuffer &command_buffer_;
+    u32 frame_index_;
+    u32 scope_id_;
+  };
+  // ***********************************************************************
+  //                           CONSTRUCTORS
+  // ***********************************************************************
+  GpuProfiler();
+  GpuProfiler(const GpuProfiler &other) = delete;
+  ~GpuProfiler();
+  // ***********************************************************************
+  //                           OPERATORS
+  // ***********************************************************************
+  GpuProfiler &operator=(const GpuProfiler &other) = delete;
+  // ***********************************************************************
+  //                            CREATION
+  // ***********************************************************************
+  /// \param logical_device
+  /// \param frame_count number of frame slots
+  /// \param max_scopes_per_frame maximum number of regions per frame slot
+  /// \param queue_family_index family of the queue the measured command
+  /// buffers are submitted to (defines the valid bits of its timestamps)
+  /// \return bool true if success
+  bool init(const LogicalDevice::Ref &logical_device, u32 frame_count,
+            u32 max_scopes_per_frame = 64, u32 queue_family_index = 0);
+  ///
+  void destroy();
+  /// \return true if init succeeded
+  [[nodiscard]] bool good() const;
+  // ***********************************************************************
+  //                           METHODS
+  // ***********************************************************************
+  /// Records the reset of the queries of a frame slot and starts a new list of
+  /// regions for it.
+  /// \note Must be recorded outside render passes, before any region of the
+  /// frame slot.
+  /// \param command_buffer
+  /// \param frame_index
+  void reset(const CommandBuffer &command_buffer, u32 frame_index);
+  /// Writes the begin timestamp of a region
+  /// \param command_buffer
+  /// \param frame_index
+  /// \param name region name
+  /// \param color region color (argb)
+  /// \return region id (used by endScope)
+  u32 beginScope(const CommandBuffer &command_buffer, u32 frame_index,
+                 const std::string &name, u32 color);
+  /// Writes the end timestamp of a region
+  /// \param command_buffer
+  /// \param frame_index
+  /// \param scope_id value returned by beginScope
+  void endScope(const CommandBuffer &command_buffer, u32 frame_index, u32 scope_id);
+  /// Reads the results of the last submission of a frame slot without waiting.
+  /// Regions whose timestamps are not available yet (or were never written)
+  /// are skipped, the other regions of the frame are kept.
+  /// \note Call it right before the frame slot is submitted again (after its
+  /// fence has been waited), the CPU time of this call is used to place the
+  /// next results of the slot on the CPU timeline.
+  /// \param frame_index
+  /// \return true if new results were read
+  bool resolve(u32 frame_index);
+  /// Iterates over the resolved blocks (HProfiler::TrackSource compatible)
+  /// \param f
+  void iterateBlocks(const std::function<void(const HProfiler::TrackBlock &)> &f) const;
+  // ***********************************************************************
+  //                            FIELDS
+  // ***********************************************************************
+  /// \param max_block_count maximum number of resolved blocks kept
+  void setMaxBlockCount(size_t max_block_count);
+  /// \return resolved blocks, from oldest to newest
+  [[nodiscard]] const std::deque<HProfiler::TrackBlock> &blocks() const;
+
+private:
+  struct ScopeInfo {
+    std::string name;
+    u32 color{0};
+    u32 level{0};
+    bool closed{false};
+  };
+  struct FrameQueries {
+    VkQueryPool vk_query_pool{VK_NULL_HANDLE};
+    std::vector<ScopeInfo> scopes;
+    u32 depth{0};
+    u64 cpu_anchor{0}; //!< profiler ticks of the resolve preceding the submission
+  };
+
+  LogicalDevice::Ref logical_device_;
+  f64 timestamp_period_{1.0}; //!< nanoseconds per timestamp tick
+  u64 timestamp_mask_{~0ull}; //!< valid bits of the timestamps
+  u32 max_scopes_per_frame_{0};
+  std::vector<FrameQueries> frames_;
+  std::deque<HProfiler::TrackBlock> blocks_;
+  size_t max_block_count_{200};
+};
+
+} // namespace circe::vk
+
+#define CIRCE_VK_GPU_SCOPE_CONCAT_(A, B) A##B
+#define CIRCE_VK_GPU_SCOPE_CONCAT(A, B) CIRCE_VK_GPU_SCOPE_CONCAT_(A, B)
+/// Measures the GPU time of the commands recorded until the end of the
+/// current C++ scope
+#define CIRCE_VK_GPU_SCOPE(PROFILER, COMMAND_BUFFER, FRAME_INDEX, NAME, COLOR)                                        \
+  circe::vk::GpuProfiler::Scope CIRCE_VK_GPU_SCOPE_CONCAT(circe_vk_gpu_scope_, __LINE__)                              \
+    (PROFILER, COMMAND_BUFFER, FRAME_INDEX, NAME, COLOR)
+
+#endif // CIRCE_VK_UTILS_GPU_PROFILER_H
@@ -0,0 +1,133 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+/// \file parallel_recorder.cpp
+/// \author FilipeCN (filipedecn@gmail.com)
+/// \date 2026-10-19
+///
+/// \brief
+
+#include <circe/vk/utils/parallel_recorder.h>
+#include <circe/vk/utils/vk_debug.h>
+#include <algorithm>
+
+namespace circe::vk {
+
+ParallelCommandRecorder::ParallelCommandRecorder() = default;
+
+ParallelCommandRecorder::~ParallelCommandRecorder() {
+  destroy();
+}
+
+bool ParallelCommandRecorder::init(const LogicalDevice::Ref &logical_device,
+                                   u32 queue_family_index,
+                                   u32 thread_count, u32 frame_count) {
+  destroy();
+  HERMES_VALIDATE_EXP_WITH_WARNING(logical_device.good(), "using bad device.")
+  logical_device_ = logical_device;
+  job_system_ = std::make_unique<JobSystem>(thread_count);
+  thread_count_ = job_system_->workerCount();
+  frame_count_ = frame_count;
+  // command pools are reset as a whole every time a frame slot is recorded
+  thread_resources_.resize(thread_count_ * frame_count_);
+  for (auto &resources : thread_resources_)
+    HERMES_RETURN_VALUE_IF_NOT(resources.command_pool.init(logical_device_,
+                                                           VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
+                                                           queue_family_index), false)
+  recorded_command_buffers_.resize(frame_count_);
+  return true;
+}
+
+void ParallelCommandRecorder::destroy() {
+  for (auto &resources : thread_resources_) {
+    resources.command_pool.freeCommandBuffers(resources.command_buffers);
+    resources.command_pool.destroy();
+  }
+  thread_resources_.clear();
+  recorded_command_buffers_.clear();
+  job_system_.reset();
+  thread_count_ = frame_count_ = 0;
+}
+
+bool ParallelCommandRecorder::good() const {
+  return job_system_ && !thread_resources_.empty();
+}
+
+bool ParallelCommandRecorder::record(u32 frame_index, const RenderPass::Ref &renderpass,
+                                     u32 subpass, const Framebuffer *framebuffer,
+                                     u32 draw_count, u32 chunk_size,
+                                     const ChunkRecordCallback &record_callback) {
+  HERMES_VALIDATE_EXP_WITH_WARNING(good(), "using bad parallel command recorder.")
+  HERMES_RETURN_VALUE_IF_NOT(frame_index < frame_count_, false)
+  chunk_size = std::max(1u, chunk_size);
+  // release all command buffers of this frame slot
+  for (u32 t = 0; t < thread_count_; ++t) {
+    auto &resources = thread_resources_[frame_index * thread_count_ + t];
+    HERMES_RETURN_VALUE_IF_NOT(resources.command_pool.reset(0), false)
+    resources.used_count = 0;
+  }
+  auto &recorded = recorded_command_buffers_[frame_index];
+  recorded.assign((draw_count + chunk_size - 1) / chunk_size, VK_NULL_HANDLE);
+  std::atomic<bool> success{true};
+  job_system_->parallelFor(draw_count, chunk_size, [&](u32 first, u32 count, u32 worker_index) {
+    auto &resources = thread_resources_[frame_index * thread_count_ + worker_index];
+    auto *command_buffer = nextCommandBuffer(resources);
+    if (!command_buffer || !command_buffer->beginSecondary(renderpass, subpass, framebuffer)) {
+      success = false;
+      return;
+    }
+    record_callback(*command_buffer, first, count, worker_index);
+    if (!command_buffer->end()) {
+      success = false;
+      return;
+    }
+    recorded[first / chunk_size] = command_buffer->handle();
+  });
+  return success;
+}
+
+CommandBuffer *ParallelCommandRecorder::nextCommandBuffer(ThreadResources &resources) {
+  if (resources.used_count == resources.command_buffers.size()) {
+    // grow geometrically, new buffers are appended to the ones we already own
+    u32 count = std::max<u32>(4, resources.command_buffers.size());
+    std::vector<CommandBuffer> new_command_buffers;
+    if (!resources.command_pool.allocateCommandBuffers(VK_COMMAND_BUFFER_LEVEL_SECONDARY,
+                                                       count, new_command_buffers))
+      return nullptr;
+    resources.command_buffers.insert(resources.command_buffers.end(),
+                                     new_command_buffers.begin(), new_command_buffers.end());
+  }
+  return &resources.command_buffers[resources.used_count++];
+}
+
+const std::vector<VkCommandBuffer> &ParallelCommandRecorder::commandBuffers(u32 frame_index) const {
+  return recorded_command_buffers_[frame_index];
+}
+
+u32 ParallelCommandRecorder::threadCount() const {
+  return thread_count_;
+}
+
+u32 ParallelCommandRecorder::frameCount() const {
+  return frame_count_;
+}
+
+} // namespace circe::vk
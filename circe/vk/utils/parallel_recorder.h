@@ -0,0 +1,133 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+/// \file parallel_recorder.h
+/// \author FilipeCN (filipedecn@gmail.com)
+/// \date 2026-10-19
+///
+/// \brief
+
+#ifndef CIRCE_VK_UTILS_PARALLEL_RECORDER_H
+#define CIRCE_VK_UTILS_PARALLEL_RECORDER_H
+
+#include <circe/vk/pipeline/command_buffer.h>
+#include <circe/common/job_system.h>
+
+namespace circe::vk {
+
+/// Records the draw list of a frame into secondary command buffers from
+/// multiple threads.
+/// The draw list is split into chunks that are distributed over a
+/// work-stealing job system. Each worker thread records its chunks into
+/// secondary command buffers allocated from its own command pool (command
+/// pools cannot be used concurrently). The resulting command buffers are kept
+/// in chunk order, so they can be executed by a primary command buffer with
+/// vkCmdExecuteCommands inside a render pass.
+/// \note There is one set of command pools per frame slot (usually one per
+/// swapchain image). Recording into a frame slot resets its pools, so the
+/// caller must make sure the GPU is not using that slot anymore.
+class ParallelCommandRecorder {
+public:
+  /// Records the draws [first, first + count) of the draw list into a
+  /// secondary command buffer that already begun recording
+  /// \param command_buffer secondary command buffer
+  /// \param first index of the first draw
+  /// \param count number of draws
+  /// \param worker_index index of the thread recording the chunk
+  using ChunkRecordCallback = std::function<void(CommandBuffer &command_buffer,
+                                                 u32 first, u32 count,
+                                                 u32 worker_index)>;
+  // ***********************************************************************
+  //                           CONSTRUCTORS
+  // ***********************************************************************
+  ParallelCommandRecorder();
+  ParallelCommandRecorder(const ParallelCommandRecorder &other) = delete;
+  ~ParallelCommandRecorder();
+  // ***********************************************************************
+  //                           OPERATORS
+  // ***********************************************************************
+  ParallelCommandRecorder &operator=(const ParallelCommandRecorder &other) = delete;
+  // ***********************************************************************
+  //                            CREATION
+  // ***********************************************************************
+  /// \param logical_device
+  /// \param queue_family_index queue family the primary command buffers are
+  /// submitted to
+  /// \param thread_count number of recording threads (0 = hardware concurrency)
+  /// \param frame_count number of frame slots
+  /// \return bool true if success
+  bool init(const LogicalDevice::Ref &logical_device, u32 queue_family_index,
+            u32 thread_count, u32 frame_count);
+  ///
+  void destroy();
+  /// \return true if init succeeded
+  [[nodiscard]] bool good() const;
+  // ***********************************************************************
+  //                           METHODS
+  // ***********************************************************************
+  /// Records a draw list of draw_count elements into secondary command buffers
+  /// of the given frame slot. Blocks until all chunks are recorded.
+  /// \param frame_index frame slot
+  /// \param renderpass render pass the secondary command buffers will execute in
+  /// \param subpass subpass index
+  /// \param framebuffer (optional) framebuffer to be rendered into
+  /// \param draw_count number of elements in the draw list
+  /// \param chunk_size maximum number of draws per secondary command buffer
+  /// \param record_callback records a chunk of draws
+  /// \return bool true if all chunks were recorded successfully
+  bool record(u32 frame_index, const RenderPass::Ref &renderpass, u32 subpass,
+              const Framebuffer *framebuffer, u32 draw_count, u32 chunk_size,
+              const ChunkRecordCallback &record_callback);
+  // ***********************************************************************
+  //                            FIELDS
+  // ***********************************************************************
+  /// \param frame_index
+  /// \return secondary command buffers of the last record of frame_index, in
+  /// chunk order
+  [[nodiscard]] const std::vector<VkCommandBuffer> &commandBuffers(u32 frame_index) const;
+  /// \return number of recording threads
+  [[nodiscard]] u32 threadCount() const;
+  /// \return number of frame slots
+  [[nodiscard]] u32 frameCount() const;
+
+private:
+  /// Command buffers owned by a single thread in a single frame slot
+  struct ThreadResources {
+    CommandPool command_pool;
+    std::vector<CommandBuffer> command_buffers;
+    size_t used_count{0}; //!< command buffers used by the current record
+  };
+
+  CommandBuffer *nextCommandBuffer(ThreadResources &resources);
+
+  LogicalDevice::Ref logical_device_;
+  std::unique_ptr<JobSystem> job_system_;
+  u32 thread_count_{0};
+  u32 frame_count_{0};
+  /// indexed by [frame_index * thread_count_ + worker_index]
+  std::vector<ThreadResources> thread_resources_;
+  /// secondary command buffers in chunk order, per frame slot
+  std::vector<std::vector<VkCommandBuffer>> recorded_command_buffers_;
+};
+
+} // namespace circe::vk
+
+#endif // CIRCE_VK_UTILS_PARALLEL_RECORDER_H
@@ -78,6 +78,13 @@ void RenderEngine::initSwapChain() {
   draw_command_pool_.allocateCommandBuffers(VK_COMMAND_BUFFER_LEVEL_PRIMARY,
                                             swap_chain_image_views_.size(),
                                             draw_command_buffers_);
+  // one frame slot of secondary command buffers per swapchain image
+  if (parallel_recording_thread_count_.has_value() &&
+      parallel_recorder_.frameCount() != swap_chain_image_views_.size())
+    if (!parallel_recorder_.init(logical_device_, queue_family_index_,
+                                 parallel_recording_thread_count_.value(),
+                                 swap_chain_image_views_.size()))
+      HERMES_LOG_ERROR("Could not create the parallel command recorder.");
 }
 
 void RenderEngine::destroySwapChain() {
@@ -128,6 +135,7 @@ bool RenderEngine::setupDevice(const LogicalDevice &logical_device,
 
   physical_device_ = logical_device.physicalDevice();
   logical_device_ = logical_device.ref();
+  queue_family_index_ = queue_family_index;
 
   swap_chain_.setLogicalDevice(logical_device_);
   HERMES_RETURN_VALUE_IF_NOT(draw_command_pool_.init(logical_device_,
@@ -212,6 +220,7 @@ void RenderEngine::destroy() {
   image_available_semaphores_.clear();
   in_flight_fences_.clear();
   images_in_flight_.clear();
+  parallel_recorder_.destroy();
   draw_command_pool_.destroy();
 }
 
@@ -227,6 +236,18 @@ std::vector<CommandBuffer> &RenderEngine::commandBuffers() {
   return draw_command_buffers_;
 }
 
+ParallelCommandRecorder &RenderEngine::parallelRecorder() {
+  return parallel_recorder_;
+}
+
+void RenderEngine::setupParallelRecording(u32 thread_count) {
+  parallel_recording_thread_count_ = thread_count;
+}
+
+void RenderEngine::setRecordEveryFrame(bool record_every_frame) {
+  record_every_frame_ = record_every_frame;
+}
+
 void RenderEngine::init() {
   initSwapChain();
   images_in_flight_.resize(swap_chain_image_views_.size(), VK_NULL_HANDLE);
@@ -257,6 +278,10 @@ void RenderEngine::draw(VkQueue graphics_queue, VkQueue presentation_queue) {
 
   if (prepare_frame_callback)
     prepare_frame_callback(image_index);
+  // the fence of this image has been waited above, so its command buffers
+  // (primary and secondary) are free to be recorded again
+  if (record_every_frame_ && record_command_buffer_callback)
+    record_command_buffer_callback(draw_command_buffers_[image_index], image_index);
 
   VkSubmitInfo submitInfo = {};
   submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
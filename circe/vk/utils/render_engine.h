@@ -34,6 +34,8 @@
 #include <circe/vk/pipeline/renderpass.h>
 #include <circe/vk/pipeline/command_buffer.h>
 #include <circe/vk/core/sync.h>
+#include <circe/vk/utils/parallel_recorder.h>
+#include <optional>
 
 namespace circe::vk {
 
@@ -78,6 +80,20 @@ public:
   /// \param graphics_queue
   /// \param presentation_queue
   void draw(VkQueue graphics_queue, VkQueue presentation_queue);
+  /// Enables multithreaded recording of secondary command buffers. The
+  /// parallel recorder gets one frame slot per swapchain image and is
+  /// available through parallelRecorder() after the swapchain is created.
+  /// \note Typical usage is, inside record_command_buffer_callback, to record
+  /// the draw list with parallelRecorder().record(image_index, ...) and then
+  /// execute the result inside a render pass started with
+  /// VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS.
+  /// \param thread_count number of recording threads (0 = hardware concurrency)
+  void setupParallelRecording(u32 thread_count);
+  /// By default, command buffers are recorded only when the swapchain is
+  /// (re)created. If enabled, the command buffer of the acquired swapchain
+  /// image is re-recorded every frame (after prepare_frame_callback).
+  /// \param record_every_frame
+  void setRecordEveryFrame(bool record_every_frame);
 
   // ***********************************************************************
   //                            FIELDS
@@ -94,6 +110,8 @@ public:
   [[nodiscard]] const std::vector<Image::View> &swapchainImageViews() const;
   /// \return
   std::vector<CommandBuffer> &commandBuffers();
+  /// \return
+  ParallelCommandRecorder &parallelRecorder();
   // ***********************************************************************
   //                           CALLBACKS
   // ***********************************************************************
@@ -135,6 +153,11 @@ private:
   // command buffers
   CommandPool draw_command_pool_; //!< command pool used for draw command buffers
   std::vector<CommandBuffer> draw_command_buffers_; //!< command buffers used for rendering
+  u32 queue_family_index_{0};
+  // parallel recording
+  ParallelCommandRecorder parallel_recorder_;
+  std::optional<u32> parallel_recording_thread_count_;
+  bool record_every_frame_{false};
   // synchronization
   std::vector<Semaphore> render_finished_semaphores_;
   std::vector<Semaphore> image_available_semaphores_;
@@ -59,9 +59,13 @@ struct ColorMapsExample : public circe::gl::BaseApp {
     auto width = ImGui::GetWindowWidth();
     auto draw_list = ImGui::GetWindowDrawList();
     auto step = width / palette.colors.size();
+    std::vector<float> values(palette.colors.size());
+    for (size_t i = 0; i < values.size(); ++i)
+      values[i] = (float) i;
+    auto colors = palette.map(values, 0.f, (float) values.size());
     for (size_t i = 0; i < palette.colors.size(); ++i) {
       auto x = (float) i * step;
-      auto color = palette((float) i / palette.colors.size());
+      const auto &color = colors[i];
       ImGui::SetCursorScreenPos(ImVec2(base_pos.x + x, base_pos.y));
       draw_list->AddRectFilled({base_pos.x + x, base_pos.y},
                                {base_pos.x + x + step, base_pos.y + 40},
@@ -78,13 +78,20 @@ public:
       std::cerr << "Failed to compile light model shader: " << light_model.program.err << std::endl;
     if (!g_pass_program.link(shaders_path, "g_pass"))
       std::cerr << "Failed to compile g_pass shader: " << g_pass_program.err << std::endl;
-    if (!l_pass_program.link(shaders_path, "l_pass"))
+    // the light pass reads its lights from the cluster light lists
+    std::string l_pass_path = std::string(SHADERS_PATH) + "/l_pass";
+    auto l_pass_fs = hermes::FileSystem::readFile(l_pass_path + ".frag");
+    l_pass_fs.insert(l_pass_fs.find('\n') + 1, circe::gl::ClusteredLighting::glsl());
+    l_pass_program.attach(circe::gl::Shader(hermes::Path(l_pass_path + ".vert"), GL_VERTEX_SHADER));
+    l_pass_program.attach(circe::gl::Shader(GL_FRAGMENT_SHADER, l_pass_fs));
+    if (!l_pass_program.link())
       std::cerr << "Failed to compile l_pass shader: " << l_pass_program.err << std::endl;
     l_pass_program.use();
     l_pass_program.setUniform("gPosition", 0);
     l_pass_program.setUniform("gNormal", 1);
     l_pass_program.setUniform("gAlbedoSpec", 2);
-    const unsigned int NR_LIGHTS = 32;
+    const unsigned int NR_LIGHTS = 2048;
+    std::vector<circe::gl::ClusteredLighting::Light> lights;
     std::srand(13);
     for (unsigned int i = 0; i < NR_LIGHTS; i++) {
       hermes::point3 position(((rand() % 100) / 100.0) * 5.0 - 2.5,
@@ -93,22 +100,23 @@ public:
       hermes::vec3 color(((rand() % 100) / 200.0f) + 0.5,
                         ((rand() % 100) / 200.0f) + 0.5,
                         ((rand() % 100) / 200.0f) + 0.5);
-      l_pass_program.setUniform("lights", "Color", i, color);
-      l_pass_program.setUniform("lights", "Position", i, position);
+      circe::gl::ClusteredLighting::Light light;
+      light.position = position;
+      light.color = color;
       const f32 constant = 1.0;
-      const f32 linear = 0.7;
-      const f32 quadratic = 1.8;
+      light.linear = 4.0;
+      light.quadratic = 40.0;
       // calculate radius of light volume/sphere
       const f32 max_brightness = color.max();
-      f32 radius =
-          (-linear + std::sqrt(linear * linear - 4 * quadratic * (constant - (256.0f / 5.0f) * max_brightness)))
-              / (2.0f * quadratic);
-      l_pass_program.setUniform("lights", "Linear", i, linear);
-      l_pass_program.setUniform("lights", "Quadratic", i, quadratic);
-      l_pass_program.setUniform("lights", "Radius", i, radius);
+      light.radius =
+          (-light.linear + std::sqrt(light.linear * light.linear
+                                         - 4 * light.quadratic * (constant - (256.0f / 5.0f) * max_brightness)))
+              / (2.0f * light.quadratic);
+      lights.emplace_back(light);
       light_positions_.emplace_back(position);
       light_colors_.emplace_back(color);
     }
+    lighting.setLights(lights);
   }
 
   void render(circe::CameraInterface *camera) override {
@@ -125,12 +133,17 @@ public:
         model.draw();
       }
     });
+    // assign lights to clusters
+    lighting.cull(*camera, {WIDTH, HEIGHT});
     // lightning pass
     g_position.bind(GL_TEXTURE0);
     g_normal.bind(GL_TEXTURE1);
     g_albedo_spec.bind(GL_TEXTURE2);
     l_pass_program.use();
     l_pass_program.setUniform("viewPos", camera->getPosition());
+    l_pass_program.setUniform("view", camera->getViewTransform());
+    lighting.setUniforms(l_pass_program);
+    lighting.bind();
     screen_quad.draw();
     // do some forward rendering
     g_framebuffer.blit(GL_DEPTH_BUFFER_BIT);
@@ -166,6 +179,7 @@ public:
   circe::gl::Program g_pass_program;
   // lightning pass shader
   circe::gl::Program l_pass_program;
+  circe::gl::ClusteredLighting lighting;
   // scene
   std::vector<hermes::point3> light_positions_;
   std::vector<hermes::vec3> light_colors_;
@@ -36,7 +36,17 @@ public:
     ProgramManager::setShaderSearchPath(std::string(SHADERS_PATH));
     auto instance_program = ProgramManager::push("instance");
     HERMES_ASSERT(instance_program);
-    instance_set.program_handle = *instance_program;
+    opaque_program = *instance_program;
+    instance_set.program_handle = opaque_program;
+    // transparent instances write into the oit targets
+    std::string oit_path = std::string(SHADERS_PATH) + "/instance_oit";
+    auto oit_fs = hermes::FileSystem::readFile(oit_path + ".frag");
+    oit_fs.insert(oit_fs.find('\n') + 1, WeightedBlendedOIT::glsl());
+    auto oit_program = ProgramManager::pushAndLink(std::vector<Shader>{
+        Shader(hermes::Path(oit_path + ".vert"), GL_VERTEX_SHADER),
+        Shader(GL_FRAGMENT_SHADER, oit_fs)});
+    HERMES_ASSERT(oit_program);
+    transparent_program = *oit_program;
 
     // setup UI
     object_type_ui.push("Sphere", MeshType::Sphere);
@@ -60,7 +70,21 @@ public:
 //    if (auto obj = circe::ImguiOpenDialog::file_dialog_button("Pick obj", ".obj"))
 //      obj_path = obj.path;
 
-    instance_set.draw(camera, hermes::Transform());
+    ImGui::Checkbox("transparent", &transparent);
+    ImGui::SliderFloat("opacity", &opacity, 0.f, 1.f);
+
+    if (transparent) {
+      // no sorting, all instances go in a single draw
+      instance_set.program_handle = transparent_program;
+      if (auto program = ProgramManager::program(transparent_program)) {
+        (*program)->use();
+        (*program)->setUniform("opacity", opacity);
+      }
+      oit.render([&]() { instance_set.draw(camera, hermes::Transform()); });
+    } else {
+      instance_set.program_handle = opaque_program;
+      instance_set.draw(camera, hermes::Transform());
+    }
 
     ImGui::End();
   }
@@ -98,6 +122,11 @@ public:
 
   // scene
   InstanceSet instance_set;
+  ProgramHandle opaque_program;
+  ProgramHandle transparent_program;
+  WeightedBlendedOIT oit;
+  bool transparent{false};
+  float opacity{0.4f};
 
   // UI
   circe::ImGuiRadioButtonSet<MeshType> object_type_ui;
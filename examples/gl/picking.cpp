@@ -185,7 +185,7 @@ struct MeshRTPikingExample {
   void pick(const circe::CameraInterface *camera) {
     auto &gd = circe::gl::GraphicsDisplay::instance();
     picker.pick(camera, gd.getMousePos());
-    if (picker.picked_primitive_index) {
+    if (picker.picked_index) {
       HERMES_PROFILE_SCOPE("pick update");
       // update vertex and edge states
       auto m = ssbo.memory()->mapped(GL_MAP_WRITE_BIT);
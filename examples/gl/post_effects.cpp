@@ -4,31 +4,37 @@
 #define WIDTH 800
 #define HEIGHT 800
 
-const char *fs = "#version 440 core\n"
-                 "out vec4 outColor;"
-                 "in vec2 texCoord;"
-                 "uniform sampler2D tex;"
-                 "void main() {"
-                 "ivec2 texel = ivec2(gl_FragCoord.xy);"
-                 "outColor = (texelFetchOffset(tex, texel, 0, ivec2(0, 0)) +"
-                 "texelFetchOffset(tex, texel, 0, ivec2(1, 1)) +"
-                 "texelFetchOffset(tex, texel, 0, ivec2(0, 1)) +"
-                 "texelFetchOffset(tex, texel, 0, ivec2(-1, 1)) +"
-                 "texelFetchOffset(tex, texel, 0, ivec2(-1, 0)) +"
-                 "texelFetchOffset(tex, texel, 0, ivec2(1, 0)) +"
-                 "texelFetchOffset(tex, texel, 0, ivec2(-1, -1)) +"
-                 "texelFetchOffset(tex, texel, 0, ivec2(1, -1)) +"
-                 "texelFetchOffset(tex, texel, 0, ivec2(0, -1))) / 9.0;"
-                 "}";
+// 3x3 box filter
+const char *box_blur = "  vec4 sum = vec4(0.0);\n"
+                       "  for (int y = -1; y <= 1; ++y)\n"
+                       "    for (int x = -1; x <= 1; ++x)\n"
+                       "      sum += tileFetch(ivec2(x, y));\n"
+                       "  return sum / 9.0;";
+
+class PostEffectsExample : public circe::gl::BaseApp {
+public:
+  PostEffectsExample() : BaseApp(WIDTH, HEIGHT, "Post Effects Example") {
+    // fxaa, blur and gamma run in two compute passes: gamma is fused into the
+    // store of the blur pass
+    auto &post_process = app->viewport().renderer->postProcess();
+    post_process.add(circe::gl::PostProcessChain::fxaa());
+    circe::gl::PostProcessChain::Stage blur;
+    blur.name = "boxBlur";
+    blur.type = circe::gl::PostProcessChain::Stage::Type::neighborhood;
+    blur.body = box_blur;
+    blur.radius = 1;
+    post_process.add(blur);
+    post_process.add(circe::gl::PostProcessChain::gammaCorrection());
+    post_process.setParameter("gamma", 2.2f);
+  }
+
+  void render(circe::CameraInterface *camera) override {
+    grid.draw(camera);
+  }
+
+  circe::gl::helpers::CartesianGrid grid;
+};
 
 int main() {
-  circe::gl::SceneApp<> app(WIDTH, HEIGHT, "Post Effects Example");
-  app.init();
-  app.viewports[0].renderer->addEffect(new circe::gl::GammaCorrection());
-  //  app.viewports[0].renderer->addEffect(new circe::FXAA());
-  //  app.viewports[0].renderer->addEffect(new circe::PostEffect(
-  //      new circe::Shader(circe_NO_VAO_VS, nullptr, fs)));
-  app.scene.add(new circe::gl::CartesianGrid(5));
-  app.run();
-  return 0;
-}
\ No newline at end of file
+  return PostEffectsExample().run();
+}
@@ -26,15 +26,37 @@
 ///\brief
 
 #include <circe/circe.h>
+#include "common.h"
 #include <hermes/common/profiler.h>
 #include <thread>
 
 struct ProfilerExample : public circe::gl::BaseApp {
   ProfilerExample() : circe::gl::BaseApp(800, 800, "Profiler Example") {
     hermes::profiler::Profiler::setMaxBlockCount(200);
+    mesh = circe::Shapes::icosphere(6, circe::shape_options::normal);
+    if (!mesh.program.link(hermes::Path(std::string(SHADERS_PATH)), "color"))
+      HERMES_LOG_ERROR("Failed to load model shader: ", mesh.program.err);
+    profiler_view.addTrack("GPU", [&](const auto &f) { gpu_timer.iterateBlocks(f); });
+    // keep the last 10s, dump frames slower than 100ms
+    capture.addTrack("GPU", [&](const auto &f) { gpu_timer.iterateBlocks(f); });
+    capture.hitch_threshold_ms = 100;
+    profiler_view.setCapture(&capture);
   }
 
   void render(circe::CameraInterface *camera) override {
+    gpu_timer.newFrame();
+    {
+      CIRCE_GL_PROFILE_SCOPE(gpu_timer, "spheres", hermes::argb_colors::Red300);
+      glEnable(GL_DEPTH_TEST);
+      mesh.program.use();
+      mesh.program.setUniform("view", camera->getViewTransform());
+      mesh.program.setUniform("projection", camera->getProjectionTransform());
+      mesh.program.setUniform("color", circe::Color::Red());
+      for (int i = 0; i < 50; ++i) {
+        mesh.program.setUniform("model", hermes::Transform::translate({i * 0.1f - 2.5f, 0.f, 0.f}));
+        mesh.draw();
+      }
+    }
     {
       HERMES_PROFILE_FUNCTION(hermes::argb_colors::GreenA200);
       ImGui::SetNextWindowSize(ImVec2(400.0f, 400.0f), ImGuiCond_FirstUseEver);
@@ -47,6 +69,10 @@ struct ProfilerExample : public circe::gl::BaseApp {
       HERMES_PROFILE_END_BLOCK
       HERMES_PROFILE_SCOPE("GUI", hermes::argb_colors::BlueA200);
       profiler_view.render();
+      if (ImGui::IsKeyPressed(GLFW_KEY_F9))
+        capture.save(hermes::Path(std::string("trace.json")));
+      for (const auto &average : gpu_timer.averages())
+        ImGui::Text("%s (gpu): %.3f ms", average.first.c_str(), average.second);
       logger_view.render();
       HERMES_LOG_VARIABLE(this->frame_counter_);
       if (this->frame_counter_ % 10 == 0)
@@ -58,6 +84,9 @@ struct ProfilerExample : public circe::gl::BaseApp {
   }
 
   circe::HProfiler profiler_view;
+  circe::gl::GpuTimer gpu_timer;
+  circe::TraceCapture capture{10.0};
+  circe::gl::SceneModel mesh;
   circe::HLogger logger_view;
 };
 
@@ -1,20 +1,40 @@
 // Created by filipecn on 9/3/18.
 #include <circe/circe.h>
-#define STB_IMAGE_WRITE_IMPLEMENTATION
-#include <stb_image_write.h>
 
-using namespace circe::gl;
+class SaveViewportExample : public circe::gl::BaseApp {
+public:
+  SaveViewportExample() : BaseApp(800, 800, "Save Viewport Example") {
+    options.path = "viewport_%05d.png";
+    // clicks start/stop recording the viewport into a png sequence
+    app->buttonCallback = [&](int button, int action, int modifiers) {
+      if (action != GLFW_RELEASE)
+        return;
+      if (recorder.isRecording())
+        recorder.stop();
+      else
+        recorder.start(options);
+    };
+  }
+
+  void render(circe::CameraInterface *camera) override {
+    grid.draw(camera);
+  }
+
+  void finishFrame() override {
+    // the viewport covers the window, its image is in the default framebuffer
+    if (recorder.isRecording())
+      recorder.captureFramebuffer(app->viewport().size());
+  }
+
+  circe::gl::helpers::CartesianGrid grid;
+  circe::gl::FrameRecorder recorder;
+  circe::gl::FrameRecorder::Options options;
+};
 
 int main() {
-  SceneApp<> app(800, 800);
-  app.scene.add(new CartesianGrid(5));
-  app.buttonCallback = [&](int button, int action, int modifiers) {
-    if (action == GLFW_RELEASE) {
-      std::vector<unsigned char> data;
-      size_t w = 0, h = 0;
-      app.viewports[0].renderer->currentPixels(data, w, h);
-      stbi_write_png("viewport.png", w, h, 4, data.data(), w * 4);
-    }
-  };
-  return app.run();
+  SaveViewportExample example;
+  int result = example.run();
+  // pending frames are written while the context is still alive
+  example.recorder.stop();
+  return result;
 }
@@ -4,7 +4,9 @@
 #define HEIGHT 400
 
 struct ViewportsExample : public circe::gl::BaseApp {
-  ViewportsExample() : circe::gl::BaseApp(2 * WIDTH, 2 * HEIGHT, "Viewports Example", circe::app_options::no_viewport) {
+  // static scene: frames are only rendered on input and camera changes
+  ViewportsExample() : circe::gl::BaseApp(2 * WIDTH, 2 * HEIGHT, "Viewports Example",
+                                          circe::app_options::no_viewport | circe::app_options::on_demand) {
     hermes::Path shaders_path(std::string(SHADERS_PATH));
     // setup viewports_
     //                |
@@ -24,6 +26,10 @@ struct ViewportsExample : public circe::gl::BaseApp {
     this->app->addViewport(0, HEIGHT, WIDTH, HEIGHT);
     // perspective view viewport
     this->app->addViewport(WIDTH, HEIGHT, WIDTH, HEIGHT);
+    // viewports are only redrawn when they change, moving one camera
+    // leaves the others untouched
+    for (size_t i = 0; i < 4; ++i)
+      this->app->viewport(i).enableRenderCache();
 
     // scene
     model = circe::Shapes::box(hermes::bbox3::unitBox(true), circe::shape_options::uv);
@@ -35,10 +41,13 @@ struct ViewportsExample : public circe::gl::BaseApp {
     top.update(&app->viewport(0).camera());
     front.update(&app->viewport(1).camera());
     perspective.update(&app->viewport(2).camera());
+    // the cameras viewport shows the other cameras
+    if (app->viewport(0).cameraChanged() || app->viewport(1).cameraChanged())
+      app->viewport(2).invalidate();
   }
 
   void render(circe::CameraInterface *camera) override {
-    static size_t current_viewport = 0;
+    size_t current_viewport = app->currentRenderingViewport();
 
     model.program.use();
     model.program.setUniform("projection", camera->getProjectionTransform());
@@ -55,8 +64,6 @@ struct ViewportsExample : public circe::gl::BaseApp {
     }
 
     cartesian_grid.draw(camera);
-
-    current_viewport = (current_viewport + 1) % 4;
   }
 
   circe::gl::SceneModel model;
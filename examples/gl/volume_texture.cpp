@@ -154,6 +154,7 @@ struct VolumeTextureExample : public circe::gl::BaseApp {
     for (auto ijk :  index_range)
       density[index_range.flatIndex(ijk)] = getMenger(domain_transform(ijk), max_extinction);
     t_density.setTexels(density.data());
+    majorant_grid.build(t_density, 8);
   }
 
   void prepareFrame() override {
@@ -188,10 +189,26 @@ struct VolumeTextureExample : public circe::gl::BaseApp {
 
     // UI
     ImGui::Begin("controls");
-    ImGui::InputInt("iterations", &max_iterations);
-    ImGui::InputInt("interactions", &max_interactions);
-    ImGui::SliderFloat("albedo", &albedo, 0, 1);
-    ImGui::InputFloat("extinction", &max_extinction);
+    bool changed = false;
+    changed |= ImGui::InputInt("iterations", &max_iterations);
+    changed |= ImGui::InputInt("interactions", &max_interactions);
+    changed |= ImGui::SliderFloat("albedo", &albedo, 0, 1);
+    changed |= ImGui::InputFloat("extinction", &max_extinction);
+    changed |= ImGui::Checkbox("local majorants", &use_majorant_grid);
+    // parameters change the image, start converging again
+    if (changed)
+      accumulator.reset();
+    ImGui::Checkbox("progressive", &progressive);
+    ImGui::Text("samples: %u", accumulator.sampleCount());
+    if (ImGui::Checkbox("dynamic resolution", &dynamic_resolution)) {
+      if (dynamic_resolution)
+        app->viewport(1).enableDynamicResolution(16.f);
+      else
+        app->viewport(1).disableDynamicResolution();
+    }
+    if (app->viewport(1).dynamic_resolution)
+      ImGui::Text("scale: %.2f gpu: %.2f ms", app->viewport(1).dynamic_resolution->scale(),
+                  app->viewport(1).dynamic_resolution->gpuTime());
     ImGui::Text("%s", hermes::Str::concat(current_pixel).c_str());
     ImGui::Text("%s", hermes::Str::concat(t0).c_str());
     ImGui::Text("%s", hermes::Str::concat(l).c_str());
@@ -200,7 +217,40 @@ struct VolumeTextureExample : public circe::gl::BaseApp {
   }
 
   void render1(circe::CameraInterface *camera) {
+    if (progressive) {
+      auto size = app->viewport(1).size();
+      if (accumulator.texture().size().width != size.width || accumulator.texture().size().height != size.height)
+        accumulator.resize(size);
+      accumulator.accumulate(*camera, [&](u32 sample_index) { drawVolume(camera, sample_index); });
+      accumulator.render();
+    } else
+      drawVolume(camera, frame_index++);
+
+    ImGuizmo::SetRect(this->app->viewport(1).position().i,
+                      0,
+                      this->app->viewport(1).size().width,
+                      this->app->viewport(1).size().height);
+    circe::Gizmo::update(camera, gizmo_transform, ImGuizmo::OPERATION::TRANSLATE);
+
+    auto next_pixel = app->viewport(1).project(gizmo_transform(hermes::point3()));
+    if (next_pixel != current_pixel) {
+      current_pixel = next_pixel;
+      rand_state = hermes::vec2(current_pixel.i, current_pixel.j) + hermes::vec2(0.234525, 0.5663);
+
+      auto p = app->viewport(1).viewCoordToNormDevCoord(hermes::point3(current_pixel.i, current_pixel.j, 0));
+      p = app->viewport(1).unProject(p);
+      raydir = hermes::normalize(p - app->viewport(1).camera().getPosition());
+      std::vector<hermes::point3> path;
+
+      l = traceVolume(app->viewport(1).camera().getPosition(), raydir, path);
+      camera_rays = circe::Shapes::curve(path);
+    }
+
+  }
+
+  void drawVolume(circe::CameraInterface *camera, u32 sample_index) {
     t_density.bind(GL_TEXTURE0);
+    majorant_grid.bind(GL_TEXTURE1);
     HERMES_ASSERT(box_model.program.use())
     box_model.program.setUniform("projection", camera->getProjectionTransform());
     box_model.program.setUniform("model", camera->getModelTransform());
@@ -210,6 +260,9 @@ struct VolumeTextureExample : public circe::gl::BaseApp {
     box_model.program.setUniform("max_iterations", max_iterations);
     box_model.program.setUniform("max_interactions", max_interactions);
     box_model.program.setUniform("max_extinction", max_extinction);
+    box_model.program.setUniform("majorant_tex", 1);
+    box_model.program.setUniform("use_majorant_grid", use_majorant_grid ? 1 : 0);
+    box_model.program.setUniform("sample_index", static_cast<int>(sample_index));
 
     box_model.program.setUniform("domain_box_lower", hermes::point3(-0.5));
     box_model.program.setUniform("domain_box_upper", hermes::point3(0.5));
@@ -225,27 +278,6 @@ struct VolumeTextureExample : public circe::gl::BaseApp {
     glCullFace(GL_BACK);
 
     box_model.draw();
-
-    ImGuizmo::SetRect(this->app->viewport(1).position().i,
-                      0,
-                      this->app->viewport(1).size().width,
-                      this->app->viewport(1).size().height);
-    circe::Gizmo::update(camera, gizmo_transform, ImGuizmo::OPERATION::TRANSLATE);
-
-    auto next_pixel = app->viewport(1).project(gizmo_transform(hermes::point3()));
-    if (next_pixel != current_pixel) {
-      current_pixel = next_pixel;
-      rand_state = hermes::vec2(current_pixel.i, current_pixel.j) + hermes::vec2(0.234525, 0.5663);
-
-      auto p = app->viewport(1).viewCoordToNormDevCoord(hermes::point3(current_pixel.i, current_pixel.j, 0));
-      p = app->viewport(1).unProject(p);
-      raydir = hermes::normalize(p - app->viewport(1).camera().getPosition());
-      std::vector<hermes::point3> path;
-
-      l = traceVolume(app->viewport(1).camera().getPosition(), raydir, path);
-      camera_rays = circe::Shapes::curve(path);
-    }
-
   }
 
   // WOODCOCK ALGORITHM
@@ -315,10 +347,16 @@ struct VolumeTextureExample : public circe::gl::BaseApp {
   int max_interactions{100};
   float max_extinction{100.f};
   float albedo{0.8f};
+  bool use_majorant_grid{true};
+  bool progressive{true};
+  bool dynamic_resolution{false};
+  u32 frame_index{0};
 
   // scene
   hermes::size3 volume_resolution{128, 128, 128};
   circe::gl::Texture t_density;
+  circe::gl::MacroCellGrid majorant_grid;
+  circe::gl::ProgressiveAccumulator accumulator;
   circe::gl::SceneModel box_model;
 
   // debug
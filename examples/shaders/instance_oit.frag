@@ -0,0 +1,14 @@
+#version 440 core
+// oit outputs and oitWrite (WeightedBlendedOIT::glsl()) are inserted after the version line
+
+in VERTEX {
+    vec4 color;
+    vec2 uv;
+    float view_depth;
+} vertex;
+
+uniform float opacity;
+
+void main() {
+    oitWrite(vec4(vertex.color.rgb, opacity), vertex.view_depth);
+}
@@ -1,4 +1,5 @@
-#version 330 core
+#version 430 core
+// cluster light list declarations (ClusteredLighting::glsl()) are inserted after the version line
 out vec4 FragColor;
 
 in vec2 TexCoords;
@@ -7,17 +8,8 @@ uniform sampler2D gPosition;
 uniform sampler2D gNormal;
 uniform sampler2D gAlbedoSpec;
 
-struct Light {
-    vec3 Position;
-    vec3 Color;
-
-    float Linear;
-    float Quadratic;
-    float Radius;
-};
-const int NR_LIGHTS = 32;
-uniform Light lights[NR_LIGHTS];
 uniform vec3 viewPos;
+uniform mat4 view;
 
 void main()
 {
@@ -30,21 +22,28 @@ void main()
     // then calculate lighting as usual
     vec3 lighting  = Diffuse * 0.1; // hard-coded ambient component
     vec3 viewDir  = normalize(viewPos - FragPos);
-    for(int i = 0; i < NR_LIGHTS; ++i)
+    // only the lights assigned to the cluster of this pixel
+    int cluster = clusterIndex(gl_FragCoord.xy, -(view * vec4(FragPos, 1.0)).z);
+    int light_count = clusterLightCount(cluster);
+    for(int i = 0; i < light_count; ++i)
     {
+        int light = clusterLight(cluster, i);
+        vec3 lightPosition = clusterLightPosition(light);
+        vec3 lightColor = clusterLightColor(light);
         // calculate distance between light source and current fragment
-        float distance = length(lights[i].Position - FragPos);
-        if(distance < lights[i].Radius)
+        float distance = length(lightPosition - FragPos);
+        if(distance < clusterLightRadius(light))
         {
             // diffuse
-            vec3 lightDir = normalize(lights[i].Position - FragPos);
-            vec3 diffuse = max(dot(Normal, lightDir), 0.0) * Diffuse * lights[i].Color;
+            vec3 lightDir = normalize(lightPosition - FragPos);
+            vec3 diffuse = max(dot(Normal, lightDir), 0.0) * Diffuse * lightColor;
             // specular
             vec3 halfwayDir = normalize(lightDir + viewDir);
             float spec = pow(max(dot(Normal, halfwayDir), 0.0), 16.0);
-            vec3 specular = lights[i].Color * spec * Specular;
+            vec3 specular = lightColor * spec * Specular;
             // attenuation
-            float attenuation = 1.0 / (1.0 + lights[i].Linear * distance + lights[i].Quadratic * distance * distance);
+            float attenuation = 1.0 / (1.0 + clusterLightLinear(light) * distance
+                + clusterLightQuadratic(light) * distance * distance);
             diffuse *= attenuation;
             specular *= attenuation;
             lighting += diffuse + specular;
@@ -52,4 +51,3 @@ void main()
     }
     FragColor = vec4(lighting, 1.0);
 }
-
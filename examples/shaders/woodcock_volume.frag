@@ -22,6 +22,11 @@ struct Camera {
 };
 
 layout(location = 16) uniform Camera camera;
+// macro cell min (r) / max (g) extinction, used as local majorants
+layout(location = 20) uniform sampler3D majorant_tex;
+layout(location = 21) uniform int use_majorant_grid;
+// index of the accumulated sample (progressive rendering)
+layout(location = 22) uniform int sample_index;
 
 vec2 noise_state;
 
@@ -61,7 +66,52 @@ float getExtinction(in vec3 p) {
     return texture(extinction_tex, p + vec3(0.5, 0.5, 0.5)).x;
 }
 
+// distance from p, along d, to the exit of the box [lower, upper]
+float boxExit(in vec3 p, in vec3 d, in vec3 lower, in vec3 upper) {
+    d = mix(d, vec3(1e-8), equal(d, vec3(0.0)));
+    vec3 t = max((lower - p) / d, (upper - p) / d);
+    return min(min(t.x, t.y), t.z);
+}
+
+// delta tracking with a piecewise constant majorant: free flights are sampled
+// against the majorant of the current macro cell and restarted at its exit
+// (exponential sampling is memoryless), empty cells are skipped entirely.
+bool sampleInteractionLocal(inout vec3 ray_pos, in vec3 ray_dir) {
+    vec3 cells = vec3(textureSize(majorant_tex, 0));
+    float t = 0.0f;
+    vec3 pos = ray_pos;
+    for (int step = 0; step < 256; ++step) {
+        pos = ray_pos + ray_dir * t;
+        if (!inVolume(pos)) {
+            return false;
+        }
+        vec3 uvw = pos + vec3(0.5, 0.5, 0.5);
+        vec3 c = clamp(floor(uvw * cells), vec3(0.0), cells - 1.0);
+        float majorant = texelFetch(majorant_tex, ivec3(c), 0).g;
+        float t_exit = t + boxExit(uvw, ray_dir, c / cells, (c + 1.0) / cells) + 1e-5;
+        if (majorant <= 0.0) {
+            t = t_exit;
+            continue;
+        }
+        float t_next = t - log(1.0f - noise()) / majorant;
+        if (t_next >= t_exit) {
+            t = t_exit;
+            continue;
+        }
+        t = t_next;
+        pos = ray_pos + ray_dir * t;
+        if (getExtinction(pos) >= noise() * majorant) {
+            break;
+        }
+    }
+    ray_pos = pos;
+    return true;
+}
+
 bool sampleInteraction(inout vec3 ray_pos, in vec3 ray_dir) {
+    if (use_majorant_grid != 0) {
+        return sampleInteractionLocal(ray_pos, ray_dir);
+    }
     float t = 0.0f;
     vec3 pos;
     for (int step = 0; step < 100; ++step) {
@@ -132,7 +182,7 @@ void main() {
     vec3 ray_pos = camera.pos;
     vec3 ray_dir = normalize(fPosition-camera.pos);
 
-    noise_state = gl_FragCoord.xy + vec2(0.234525, 0.5663);
+    noise_state = gl_FragCoord.xy + vec2(0.234525, 0.5663) + float(sample_index) * vec2(0.6180339, 0.3247179);
 
     vec3 value = traceVolume(ray_pos, ray_dir);
 
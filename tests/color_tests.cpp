@@ -0,0 +1,116 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file color_tests.cpp
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+
+#include <catch2/catch.hpp>
+
+#include <circe/colors/color_palette.h>
+#include <circe/common/job_system.h>
+#include <cmath>
+#include <limits>
+
+using namespace circe;
+
+namespace {
+
+/// Compares the batch mapping against operator() applied to each normalized
+/// value
+void checkMap(const ColorPalette &palette, const std::vector<float> &values,
+              float min_value, float max_value) {
+  const float alpha = 0.5f;
+  auto colors = palette.map(values, min_value, max_value, alpha);
+  REQUIRE(colors.size() == values.size());
+  float scale = max_value != min_value ? 1.f / (max_value - min_value) : 0.f;
+  for (size_t i = 0; i < values.size(); ++i) {
+    auto expected = palette((values[i] - min_value) * scale, alpha);
+    INFO("value " << values[i]);
+    REQUIRE(colors[i].r == Approx(expected.r).margin(1e-5));
+    REQUIRE(colors[i].g == Approx(expected.g).margin(1e-5));
+    REQUIRE(colors[i].b == Approx(expected.b).margin(1e-5));
+    REQUIRE(colors[i].a == expected.a);
+  }
+}
+
+}
+
+TEST_CASE("ColorPalette map", "[colors]") {
+  auto palette = ColorPalettes::Batlow();
+  // sweep includes out of range values and every palette color boundary
+  std::vector<float> values;
+  for (int i = -500; i <= 1500; ++i)
+    values.emplace_back(i / 1000.f);
+  for (size_t i = 0; i < palette.colors.size(); ++i)
+    values.emplace_back(static_cast<float>(i) / static_cast<float>(palette.colors.size() - 1));
+  values.emplace_back(std::numeric_limits<float>::infinity());
+  values.emplace_back(-std::numeric_limits<float>::infinity());
+  values.emplace_back(std::numeric_limits<float>::quiet_NaN());
+  SECTION("unit range") {
+    checkMap(palette, values, 0.f, 1.f);
+  }
+  SECTION("custom range") {
+    checkMap(palette, values, -0.25f, 0.75f);
+    checkMap(palette, values, 1.f, 0.f);
+  }
+  SECTION("empty range") {
+    checkMap(palette, values, 0.3f, 0.3f);
+    for (const auto &color : palette.map(values, 0.3f, 0.3f)) {
+      REQUIRE(color.r == palette.colors[0].r);
+      REQUIRE(color.g == palette.colors[0].g);
+      REQUIRE(color.b == palette.colors[0].b);
+    }
+  }
+  SECTION("NaN") {
+    auto color = palette.map({std::numeric_limits<float>::quiet_NaN()})[0];
+    REQUIRE(color.r == palette.colors[0].r);
+    REQUIRE(palette(std::numeric_limits<float>::quiet_NaN()).r == palette.colors[0].r);
+  }
+  SECTION("parallel") {
+    // larger than a single chunk
+    std::vector<float> many(300000);
+    for (size_t i = 0; i < many.size(); ++i)
+      many[i] = std::sin(static_cast<float>(i));
+    JobSystem jobs(4);
+    auto serial = palette.map(many, -1.f, 1.f);
+    auto parallel = palette.map(many, -1.f, 1.f, -1.f, &jobs);
+    for (size_t i = 0; i < many.size(); ++i) {
+      REQUIRE(serial[i].r == parallel[i].r);
+      REQUIRE(serial[i].g == parallel[i].g);
+      REQUIRE(serial[i].b == parallel[i].b);
+    }
+  }
+}
+
+TEST_CASE("ColorPalette range", "[colors]") {
+  float min_value = 0.f, max_value = 0.f;
+  ColorPalette::range(nullptr, 0, min_value, max_value);
+  REQUIRE(min_value == 0.f);
+  REQUIRE(max_value == 1.f);
+  const float values[] = {0.5f, -2.f, 3.f, 1.f};
+  ColorPalette::range(values, 4, min_value, max_value);
+  REQUIRE(min_value == -2.f);
+  REQUIRE(max_value == 3.f);
+}
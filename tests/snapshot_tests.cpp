@@ -0,0 +1,159 @@
+/// Copyright (c) 2026, FilipeCN.
+///
+/// The MIT License (MIT)
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+///
+///\file snapshot_tests.cpp
+///\author FilipeCN (filipedecn@gmail.com)
+///\date 2026-10-19
+///
+///\brief
+
+
+
+#include <catch2/catch.hpp>
+
+#include <circe/gl/utils/scene_snapshot.h>
+#include <random>
+
+using namespace circe::gl;
+
+namespace {
+
+/// Producer that mirrors every write into a reference copy of the buffers
+struct Producer {
+  /// Writes one step with a few sparse writes into each buffer
+  /// \param resize_buffer buffer to grow in this step (-1 for none)
+  void step(int resize_buffer = -1) {
+    auto &snapshot = mailbox.beginWrite();
+    ++published_step;
+    // the recycled snapshot must hold exactly the last published state
+    REQUIRE(snapshot.step == published_step);
+    checkBuffers(snapshot);
+    for (const auto &buffer : snapshot.buffers)
+      REQUIRE(buffer.dirty.empty());
+    for (u32 i = 0; i < reference.size(); ++i) {
+      if (static_cast<int>(i) == resize_buffer) {
+        reference[i].resize(reference[i].size() + 64, 0);
+        snapshot.resizeBuffer(i, reference[i].size());
+      }
+      std::uniform_int_distribution<u64> offset(0, reference[i].size() - 16);
+      for (int w = 0; w < 3; ++w) {
+        u64 o = offset(rng);
+        u8 data[16];
+        for (auto &b : data)
+          b = static_cast<u8>(rng());
+        snapshot.write(i, o, data, sizeof(data));
+        std::copy(data, data + sizeof(data), reference[i].begin() + o);
+      }
+      // typed write
+      auto first = offset(rng) / sizeof(u32);
+      *snapshot.map<u32>(i, first, 1) = static_cast<u32>(published_step);
+      auto *value = reinterpret_cast<u32 *>(reference[i].data() + first * sizeof(u32));
+      *value = static_cast<u32>(published_step);
+    }
+    snapshot.time = published_step * 0.01;
+    mailbox.publish();
+  }
+  /// Acquires the latest snapshot and checks it against the reference
+  /// \return true if the snapshot directly follows the previous one
+  bool acquire() {
+    bool contiguous = false;
+    const auto *snapshot = mailbox.acquire(contiguous);
+    REQUIRE(snapshot);
+    REQUIRE(snapshot->step == published_step);
+    REQUIRE(snapshot->time == published_step * 0.01);
+    checkBuffers(*snapshot);
+    return contiguous;
+  }
+  void checkBuffers(const SceneSnapshot &snapshot) const {
+    REQUIRE(snapshot.buffers.size() == reference.size());
+    for (size_t i = 0; i < reference.size(); ++i) {
+      INFO("step " << published_step << " buffer " << i);
+      REQUIRE(snapshot.buffers[i].data == reference[i]);
+    }
+  }
+
+  SnapshotMailbox mailbox;
+  std::vector<std::vector<u8>> reference;
+  u64 published_step{0};
+  std::mt19937 rng{7};
+};
+
+}
+
+TEST_CASE("SnapshotMailbox", "[snapshot]") {
+  Producer producer;
+  // first step creates the buffers
+  auto &snapshot = producer.mailbox.beginWrite();
+  REQUIRE(snapshot.step == 1);
+  producer.reference = {std::vector<u8>(1024), std::vector<u8>(256)};
+  for (u32 i = 0; i < producer.reference.size(); ++i) {
+    for (size_t j = 0; j < producer.reference[i].size(); ++j)
+      producer.reference[i][j] = static_cast<u8>(i + j);
+    snapshot.resizeBuffer(i, producer.reference[i].size());
+    snapshot.write(i, 0, producer.reference[i].data(), producer.reference[i].size());
+  }
+  producer.published_step = 1;
+  snapshot.time = 0.01;
+  producer.mailbox.publish();
+  bool contiguous = true;
+  REQUIRE(producer.mailbox.acquire(contiguous));
+  REQUIRE(!contiguous);
+  SECTION("every step") {
+    for (int s = 0; s < 50; ++s) {
+      producer.step();
+      REQUIRE(producer.acquire());
+    }
+    REQUIRE(producer.mailbox.skippedCount() == 0);
+  }
+  SECTION("skipped steps") {
+    u64 skipped = 0;
+    for (int s = 0; s < 50; ++s) {
+      // consumer only sees every (s % 4 + 1)-th step
+      int steps = s % 4 + 1;
+      for (int i = 0; i < steps; ++i)
+        producer.step();
+      skipped += steps - 1;
+      REQUIRE(producer.acquire() == (steps == 1));
+      // no new snapshot until the next publish
+      REQUIRE(!producer.mailbox.acquire(contiguous));
+    }
+    REQUIRE(producer.mailbox.skippedCount() == skipped);
+  }
+  SECTION("history too old") {
+    // the consumer holds the snapshot of step 1 while the producer runs for
+    // longer than the history covers, so once released it needs a full copy
+    for (int s = 0; s < 20; ++s)
+      producer.step();
+    REQUIRE(!producer.acquire());
+    for (int s = 0; s < 10; ++s) {
+      producer.step();
+      REQUIRE(producer.acquire());
+    }
+    REQUIRE(producer.mailbox.skippedCount() == 19);
+  }
+  SECTION("resized buffer") {
+    for (int s = 0; s < 20; ++s) {
+      producer.step(s % 5 == 0 ? s % 2 : -1);
+      if (s % 3)
+        REQUIRE(producer.acquire() == (s % 3 == 2));
+    }
+  }
+}
@@ -31,6 +31,10 @@
 #include <circe/vk/core/instance.h>
 #include <circe/vk/utils/render_engine.h>
 #include <circe/vk/pipeline/renderpass.h>
+#include <circe/vk/utils/parallel_recorder.h>
+#include <circe/vk/scene/scene_model.h>
+#include <hermes/geometry/point.h>
+#include <atomic>
 
 using namespace circe::vk;
 
@@ -75,3 +79,80 @@ TEST_CASE("Raw Sanity Check") {
 TEST_CASE("Instance") {
   REQUIRE(Instance("test").good());
 }
+
+TEST_CASE("AoS vertex input state") {
+  hermes::AoS aos;
+  aos.pushField<hermes::point3>("position");
+  aos.pushField<hermes::vec2>("uv");
+  aos.pushField<u32>("id");
+  REQUIRE(vertexStride(aos) == 24);
+  REQUIRE(vertexAttributeFormat(hermes::DataType::F32, 2) == VK_FORMAT_R32G32_SFLOAT);
+  REQUIRE(vertexAttributeFormat(hermes::DataType::F32, 5) == VK_FORMAT_UNDEFINED);
+  GraphicsPipeline::VertexInputState state;
+  REQUIRE(setupVertexInputState(aos, state, 0, 1));
+  const auto *info = state.info();
+  REQUIRE(info->vertexBindingDescriptionCount == 1);
+  REQUIRE(info->pVertexBindingDescriptions[0].stride == 24);
+  REQUIRE(info->vertexAttributeDescriptionCount == 3);
+  REQUIRE(info->pVertexAttributeDescriptions[1].location == 2);
+  REQUIRE(info->pVertexAttributeDescriptions[1].offset == 12);
+  REQUIRE(info->pVertexAttributeDescriptions[2].format == VK_FORMAT_R32_UINT);
+}
+
+// Records a draw list into secondary command buffers with a growing number of
+// threads. It runs headless, so it can be executed on software
+// implementations (ex: lavapipe):
+//    VK_ICD_FILENAMES=/usr/share/vulkan/icd.d/lvp_icd.x86_64.json circe_tests
+// Command buffers are only recorded, never submitted. Recording throughput is
+// measured by circe_bench "[vk]".
+TEST_CASE("ParallelCommandRecorder") {
+  Instance instance("parallel_recording_test");
+  REQUIRE(instance.good());
+  QueueFamilies queue_families;
+  auto physical_device = instance.pickPhysicalDevice(queue_families, VK_NULL_HANDLE);
+  REQUIRE(physical_device.good());
+  LogicalDevice logical_device;
+  REQUIRE(logical_device.init(&physical_device, {}, {}, queue_families));
+  u32 family_index = queue_families.family("graphics").family_index.value();
+  // a single color attachment renderpass is enough for secondary command
+  // buffer inheritance
+  RenderPass renderpass;
+  renderpass.addAttachment(VK_FORMAT_R8G8B8A8_UNORM, VK_SAMPLE_COUNT_1_BIT,
+                           VK_ATTACHMENT_LOAD_OP_CLEAR, VK_ATTACHMENT_STORE_OP_STORE,
+                           VK_ATTACHMENT_LOAD_OP_DONT_CARE, VK_ATTACHMENT_STORE_OP_DONT_CARE,
+                           VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+  renderpass.newSubpassDescription().addColorAttachmentRef(0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+  REQUIRE(renderpass.init(logical_device.ref()));
+
+  const u32 draw_count = 10000;
+  const u32 chunk_size = 1000;
+  const u32 frame_count = 2;
+  u32 max_thread_count = std::max(1u, std::thread::hardware_concurrency());
+  for (u32 thread_count = 1; thread_count <= max_thread_count; thread_count *= 2) {
+    ParallelCommandRecorder recorder;
+    REQUIRE(recorder.init(logical_device.ref(), family_index, thread_count, frame_count));
+    REQUIRE(recorder.threadCount() == thread_count);
+    // callbacks run on worker threads, results are checked after each record
+    std::atomic<u32> recorded_draws{0};
+    std::atomic<bool> valid_workers{true};
+    auto record_chunk = [&](CommandBuffer &cb, u32 first, u32 count, u32 worker_index) {
+      if (worker_index >= thread_count)
+        valid_workers = false;
+      for (u32 i = first; i < first + count; ++i)
+        cb.draw(3, 1, 0, i);
+      recorded_draws += count;
+    };
+    // the second round reuses the command buffers allocated by the first one
+    for (u32 round = 0; round < 2; ++round)
+      for (u32 frame = 0; frame < frame_count; ++frame) {
+        recorded_draws = 0;
+        REQUIRE(recorder.record(frame, renderpass.ref(), 0, nullptr, draw_count, chunk_size, record_chunk));
+        REQUIRE(recorded_draws == draw_count);
+        REQUIRE(valid_workers);
+        const auto &command_buffers = recorder.commandBuffers(frame);
+        REQUIRE(command_buffers.size() == draw_count / chunk_size);
+        for (auto command_buffer : command_buffers)
+          REQUIRE(command_buffer != VK_NULL_HANDLE);
+      }
+  }
+}